@@ -0,0 +1,153 @@
+#include "FAffine34.hpp"
+#include "../Mat3/FMat3.hpp"
+#include "../Mat4/FMat4.hpp"
+#include "../SIMD/AffineKernels.h"
+#include "../SIMD/Dispatch.hpp"
+
+#include <stdexcept>
+
+using namespace lm;
+
+lm::FAffine34::FAffine34(const FMat3& p_linear, const FVec3& p_translation)
+{
+    // FMat3 rows are the columns of the linear part
+    for (int row = 0; row < 3; row++)
+    {
+        m_rows[row] = FVec4(p_linear.m_matrix[0][row], p_linear.m_matrix[1][row], p_linear.m_matrix[2][row], p_translation[row]);
+    }
+}
+
+lm::FAffine34::FAffine34(const FMat4& p_matrix)
+{
+    for (int row = 0; row < 3; row++)
+    {
+        m_rows[row] = FVec4(p_matrix.m_matrix[0][row], p_matrix.m_matrix[1][row], p_matrix.m_matrix[2][row], p_matrix.m_matrix[3][row]);
+    }
+}
+
+FAffine34 lm::FAffine34::operator*(const FAffine34& p_other) const
+{
+    FAffine34 result;
+    simd::Affine34Multiply(*this, p_other, result);
+    return result;
+}
+
+FAffine34& lm::FAffine34::operator*=(const FAffine34& p_other)
+{
+    simd::Affine34Multiply(*this, p_other, *this);
+    return *this;
+}
+
+FVec3 lm::FAffine34::operator*(const FVec3& p_point) const
+{
+    return TransformPoint(*this, p_point);
+}
+
+bool lm::FAffine34::operator==(const FAffine34& p_other) const
+{
+    return m_rows[0] == p_other.m_rows[0] && m_rows[1] == p_other.m_rows[1] && m_rows[2] == p_other.m_rows[2];
+}
+
+bool lm::FAffine34::operator!=(const FAffine34& p_other) const
+{
+    return !(*this == p_other);
+}
+
+FMat4 lm::FAffine34::ToMat4() const
+{
+    return FMat4(
+        FVec4(m_rows[0].x, m_rows[1].x, m_rows[2].x, 0.0f),
+        FVec4(m_rows[0].y, m_rows[1].y, m_rows[2].y, 0.0f),
+        FVec4(m_rows[0].z, m_rows[1].z, m_rows[2].z, 0.0f),
+        FVec4(m_rows[0].w, m_rows[1].w, m_rows[2].w, 1.0f));
+}
+
+FMat3 lm::FAffine34::GetLinear() const
+{
+    return FMat3(
+        FVec3(m_rows[0].x, m_rows[1].x, m_rows[2].x),
+        FVec3(m_rows[0].y, m_rows[1].y, m_rows[2].y),
+        FVec3(m_rows[0].z, m_rows[1].z, m_rows[2].z));
+}
+
+FAffine34 lm::FAffine34::Multiply(const FAffine34& p_left, const FAffine34& p_right)
+{
+    FAffine34 result;
+    simd::Affine34Multiply(p_left, p_right, result);
+    return result;
+}
+
+FAffine34 lm::FAffine34::Inverse(const FAffine34& p_transform)
+{
+    FAffine34 result;
+    simd::Affine34Inverse(p_transform, result);
+    return result;
+}
+
+FVec3 lm::FAffine34::TransformPoint(const FAffine34& p_transform, const FVec3& p_point)
+{
+    const FVec4* rows = p_transform.m_rows;
+
+    return FVec3(
+        rows[0].x * p_point.x + rows[0].y * p_point.y + rows[0].z * p_point.z + rows[0].w,
+        rows[1].x * p_point.x + rows[1].y * p_point.y + rows[1].z * p_point.z + rows[1].w,
+        rows[2].x * p_point.x + rows[2].y * p_point.y + rows[2].z * p_point.z + rows[2].w);
+}
+
+FVec3 lm::FAffine34::TransformDirection(const FAffine34& p_transform, const FVec3& p_direction)
+{
+    const FVec4* rows = p_transform.m_rows;
+
+    return FVec3(
+        rows[0].x * p_direction.x + rows[0].y * p_direction.y + rows[0].z * p_direction.z,
+        rows[1].x * p_direction.x + rows[1].y * p_direction.y + rows[1].z * p_direction.z,
+        rows[2].x * p_direction.x + rows[2].y * p_direction.y + rows[2].z * p_direction.z);
+}
+
+void lm::FAffine34::MultiplyBatch(std::span<const FAffine34> p_left, std::span<const FAffine34> p_right, std::span<FAffine34> p_result)
+{
+    if (p_left.size() != p_right.size() || p_left.size() != p_result.size())
+    {
+        throw std::logic_error("FAffine34::MultiplyBatch: spans must have the same size");
+    }
+
+    simd::Kernels().affine34MultiplyBatch(p_left.data(), p_right.data(), p_result.data(), p_result.size());
+}
+
+void lm::FAffine34::InverseBatch(std::span<const FAffine34> p_transforms, std::span<FAffine34> p_result)
+{
+    if (p_transforms.size() != p_result.size())
+    {
+        throw std::logic_error("FAffine34::InverseBatch: spans must have the same size");
+    }
+
+    simd::Kernels().affine34InverseBatch(p_transforms.data(), p_result.data(), p_result.size());
+}
+
+void lm::FAffine34::TransformPoints(const FAffine34& p_transform, std::span<const FVec3> p_points, std::span<FVec3> p_result)
+{
+    if (p_points.size() != p_result.size())
+    {
+        throw std::logic_error("FAffine34::TransformPoints: spans must have the same size");
+    }
+
+    simd::Kernels().affine34TransformPoints(p_transform, p_points.data(), p_result.data(), p_result.size());
+}
+
+void lm::FAffine34::TransformDirections(const FAffine34& p_transform, std::span<const FVec3> p_directions, std::span<FVec3> p_result)
+{
+    if (p_directions.size() != p_result.size())
+    {
+        throw std::logic_error("FAffine34::TransformDirections: spans must have the same size");
+    }
+
+    simd::Kernels().affine34TransformDirections(p_transform, p_directions.data(), p_result.data(), p_result.size());
+}
+
+std::ostream& lm::operator<<(std::ostream& p_stream, const FAffine34& p_transform)
+{
+    p_stream << p_transform.m_rows[0].x << " " << p_transform.m_rows[0].y << " " << p_transform.m_rows[0].z << " " << p_transform.m_rows[0].w << std::endl;
+    p_stream << p_transform.m_rows[1].x << " " << p_transform.m_rows[1].y << " " << p_transform.m_rows[1].z << " " << p_transform.m_rows[1].w << std::endl;
+    p_stream << p_transform.m_rows[2].x << " " << p_transform.m_rows[2].y << " " << p_transform.m_rows[2].z << " " << p_transform.m_rows[2].w << std::endl;
+    return p_stream;
+}
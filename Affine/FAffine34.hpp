@@ -0,0 +1,199 @@
+#pragma once
+
+#include <iostream>
+#include <span>
+
+#include "../Vec3/FVec3.hpp"
+#include "../Vec4/FVec4.hpp"
+
+namespace lm
+{
+    struct FMat3;
+    struct FMat4;
+    struct FVec3Stream;
+    struct FSkinInfluences;
+    struct FWorkerPool;
+
+    /**
+     * @brief An affine transform stored as the 3 top rows of a 4x4 matrix, the (0, 0, 0, 1) row is implied
+     * @details Row i holds row i of the linear part in x, y, z and component i of the translation in w,
+     * so a point p is transformed to (Dot(row0, (p, 1)), Dot(row1, (p, 1)), Dot(row2, (p, 1))).
+     * The products follow FMat4: a * b applies b first, then a.
+     * @note 12 floats instead of the 16 of FMat4, arrays of FAffine34 are contiguous
+    */
+    struct FAffine34
+    {
+        FVec4 m_rows[3];
+
+        /**
+         * @brief Creates the identity transform
+        */
+        constexpr FAffine34();
+
+        /**
+         * @brief Creates a transform from its 3 rows
+         * @param p_row0 Linear row 0 in x, y, z and the x translation in w
+         * @param p_row1 Linear row 1 in x, y, z and the y translation in w
+         * @param p_row2 Linear row 2 in x, y, z and the z translation in w
+        */
+        constexpr FAffine34(const FVec4& p_row0, const FVec4& p_row1, const FVec4& p_row2);
+
+        /**
+         * @brief Creates a transform from a linear part and a translation
+         * @param p_linear The rotation and scale, in the FMat3 layout (FMat3 rows are the FMat4 rows)
+         * @param p_translation The translation, applied after p_linear
+        */
+        FAffine34(const FMat3& p_linear, const FVec3& p_translation);
+
+        /**
+         * @brief Creates a transform from the affine part of a matrix
+         * @param p_matrix The matrix, its projective column (the w of each FMat4 row) is ignored
+        */
+        explicit FAffine34(const FMat4& p_matrix);
+
+        constexpr FAffine34(const FAffine34& p_toCopy) = default;
+        constexpr FAffine34& operator=(const FAffine34& p_other) = default;
+
+        FAffine34 operator*(const FAffine34& p_other) const;
+        FAffine34& operator*=(const FAffine34& p_other);
+        FVec3 operator*(const FVec3& p_point) const;
+        bool operator==(const FAffine34& p_other) const;
+        bool operator!=(const FAffine34& p_other) const;
+
+        /**
+         * @brief Returns the 4x4 matrix of the transform
+        */
+        FMat4 ToMat4() const;
+
+        /**
+         * @brief Returns the linear part, in the FMat3 layout
+        */
+        FMat3 GetLinear() const;
+
+        /**
+         * @brief Returns the translation
+        */
+        constexpr FVec3 GetTranslation() const;
+
+        /**
+         * @brief Returns the 12 floats of the transform, row after row, without copying them
+        */
+        float* Data() { return &m_rows[0].x; }
+        const float* Data() const { return &m_rows[0].x; }
+
+        std::span<float, 12> AsSpan() { return std::span<float, 12>(Data(), 12); }
+        std::span<const float, 12> AsSpan() const { return std::span<const float, 12>(Data(), 12); }
+
+        /**
+         * @brief Returns the identity transform
+        */
+        static constexpr FAffine34 Identity();
+
+        /**
+         * @brief Composes two transforms with 36 multiplies
+         * @param p_left The transform applied last
+         * @param p_right The transform applied first
+        */
+        static FAffine34 Multiply(const FAffine34& p_left, const FAffine34& p_right);
+
+        /**
+         * @brief Inverts a transform: a 3x3 inverse of the linear part and one translation
+         * @param p_transform The transform, its linear part must be invertible
+        */
+        static FAffine34 Inverse(const FAffine34& p_transform);
+
+        /**
+         * @brief Transforms a point, the translation is applied
+        */
+        static FVec3 TransformPoint(const FAffine34& p_transform, const FVec3& p_point);
+
+        /**
+         * @brief Transforms a direction, the translation is ignored
+        */
+        static FVec3 TransformDirection(const FAffine34& p_transform, const FVec3& p_direction);
+
+        /**
+         * @brief Composes pairs of transforms
+         * @param p_left The transforms applied last
+         * @param p_right The transforms applied first
+         * @param p_result Receives p_left[i] * p_right[i]
+         * @note The three spans must have the same size
+         * @note p_result may be one of the inputs but must not overlap them partially
+        */
+        static void MultiplyBatch(std::span<const FAffine34> p_left, std::span<const FAffine34> p_right, std::span<FAffine34> p_result);
+
+        /**
+         * @brief Inverts an array of transforms
+         * @param p_transforms The transforms
+         * @param p_result Receives the inverses, must have the size of p_transforms
+         * @note p_result may be p_transforms but must not overlap it partially
+        */
+        static void InverseBatch(std::span<const FAffine34> p_transforms, std::span<FAffine34> p_result);
+
+        /**
+         * @brief Transforms an array of points
+         * @param p_transform The transform
+         * @param p_points The points
+         * @param p_result Receives the transformed points, must have the size of p_points
+         * @note p_result may be p_points
+        */
+        static void TransformPoints(const FAffine34& p_transform, std::span<const FVec3> p_points, std::span<FVec3> p_result);
+
+        /**
+         * @brief Transforms an array of directions, the translation is ignored
+         * @param p_transform The transform
+         * @param p_directions The directions
+         * @param p_result Receives the transformed directions, must have the size of p_directions
+         * @note p_result may be p_directions
+        */
+        static void TransformDirections(const FAffine34& p_transform, std::span<const FVec3> p_directions, std::span<FVec3> p_result);
+
+        /**
+         * @brief Linear blend skinning of a mesh: each vertex blends the palette matrices of its influences by
+         * weight, then its position and normal are transformed by the blend in one pass
+         * @param p_palette The bone transforms
+         * @param p_influences The bones and weights of each vertex, every bone index below p_palette.size()
+         * @param p_positions The bind pose positions, same size as p_influences
+         * @param p_normals The bind pose normals, same size as p_influences
+         * @param p_resultPositions Receives the skinned positions, resized and allowed to be p_positions
+         * @param p_resultNormals Receives the skinned normals renormalized, resized and allowed to be p_normals
+         * @note The normals go through the blended linear part, exact for rotations and uniform scales.
+         * Vertices without weight keep their position and normal
+        */
+        static void Skin(std::span<const FAffine34> p_palette, const FSkinInfluences& p_influences, const FVec3Stream& p_positions, const FVec3Stream& p_normals,
+            FVec3Stream& p_resultPositions, FVec3Stream& p_resultNormals);
+
+        /**
+         * @brief Same as Skin, the vertices are split in chunks of 1024 run on the threads of p_pool
+        */
+        static void Skin(std::span<const FAffine34> p_palette, const FSkinInfluences& p_influences, const FVec3Stream& p_positions, const FVec3Stream& p_normals,
+            FVec3Stream& p_resultPositions, FVec3Stream& p_resultNormals, FWorkerPool& p_pool);
+    };
+
+    std::ostream& operator<<(std::ostream& p_stream, const FAffine34& p_transform);
+
+    static_assert(sizeof(FAffine34) == 12 * sizeof(float), "FAffine34 must be 12 contiguous floats");
+}
+
+namespace lm
+{
+    constexpr FAffine34::FAffine34() :
+        m_rows{ FVec4(1.0f, 0.0f, 0.0f, 0.0f), FVec4(0.0f, 1.0f, 0.0f, 0.0f), FVec4(0.0f, 0.0f, 1.0f, 0.0f) }
+    {
+    }
+
+    constexpr FAffine34::FAffine34(const FVec4& p_row0, const FVec4& p_row1, const FVec4& p_row2) :
+        m_rows{ p_row0, p_row1, p_row2 }
+    {
+    }
+
+    constexpr FVec3 FAffine34::GetTranslation() const
+    {
+        return FVec3(m_rows[0].w, m_rows[1].w, m_rows[2].w);
+    }
+
+    constexpr FAffine34 FAffine34::Identity()
+    {
+        return FAffine34();
+    }
+}
@@ -0,0 +1,120 @@
+/**
+ * Cost of the calls into the vector functions.
+ *
+ * Built twice by Bench/CMakeLists.txt: libmaths_bench_inline with the inline
+ * headers (LIBMATHS_INLINE=1, no library needed) and libmaths_bench_outline
+ * with the same functions compiled in their own translation units
+ * (LIBMATHS_INLINE=0). Comparing both outputs gives the call overhead.
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../Vec3/FVec3.hpp"
+#include "../Vec4/FVec4.hpp"
+
+using namespace lm;
+
+static constexpr size_t s_count = 4096;
+static constexpr int s_repeats = 200;
+static constexpr int s_runs = 5;
+
+/**
+ * Return the best time per element of p_function over s_runs runs, in nanoseconds
+ * @param p_function Called once per run, processes s_count elements s_repeats times
+*/
+template<typename Function>
+static double Measure(Function p_function)
+{
+    double best = 1e30;
+
+    for (int run = 0; run < s_runs; run++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        for (int repeat = 0; repeat < s_repeats; repeat++)
+            p_function();
+
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count() / (double(s_count) * s_repeats));
+    }
+
+    return best;
+}
+
+static void Report(const char* p_name, double p_nanoseconds)
+{
+    std::printf("%-28s %8.3f ns/op\n", p_name, p_nanoseconds);
+}
+
+int main()
+{
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    std::vector<FVec3> a3(s_count), b3(s_count), out3(s_count);
+    std::vector<FVec4> a4(s_count), b4(s_count), out4(s_count);
+    std::vector<float> outScalar(s_count);
+
+    for (size_t i = 0; i < s_count; i++)
+    {
+        a3[i] = FVec3(distribution(random), distribution(random), distribution(random));
+        b3[i] = FVec3(distribution(random), distribution(random), distribution(random));
+        a4[i] = FVec4(distribution(random), distribution(random), distribution(random), distribution(random));
+        b4[i] = FVec4(distribution(random), distribution(random), distribution(random), distribution(random));
+    }
+
+    std::printf("LibMaths %s vector functions\n", LIBMATHS_INLINE ? "inline" : "out-of-line");
+
+    Report("FVec3 a + b * s", Measure([&]
+    {
+        for (size_t i = 0; i < s_count; i++)
+            out3[i] = a3[i] + b3[i] * 0.5f;
+    }));
+
+    Report("FVec3::Dot", Measure([&]
+    {
+        for (size_t i = 0; i < s_count; i++)
+            outScalar[i] = FVec3::Dot(a3[i], b3[i]);
+    }));
+
+    Report("FVec3::Cross", Measure([&]
+    {
+        for (size_t i = 0; i < s_count; i++)
+            out3[i] = FVec3::Cross(a3[i], b3[i]);
+    }));
+
+    Report("FVec3::Normalize", Measure([&]
+    {
+        for (size_t i = 0; i < s_count; i++)
+            out3[i] = FVec3::Normalize(a3[i]);
+    }));
+
+    Report("FVec3::Lerp", Measure([&]
+    {
+        for (size_t i = 0; i < s_count; i++)
+            out3[i] = FVec3::Lerp(a3[i], b3[i], 0.25f);
+    }));
+
+    Report("FVec4 a + b * s", Measure([&]
+    {
+        for (size_t i = 0; i < s_count; i++)
+            out4[i] = a4[i] + b4[i] * 0.5f;
+    }));
+
+    Report("FVec4::Dot", Measure([&]
+    {
+        for (size_t i = 0; i < s_count; i++)
+            outScalar[i] = FVec4::Dot(a4[i], b4[i]);
+    }));
+
+    // Keep the results alive
+    float sink = 0.0f;
+    for (size_t i = 0; i < s_count; i++)
+        sink += out3[i].x + out4[i].y + outScalar[i];
+
+    std::printf("(checksum %g)\n", sink);
+    return 0;
+}
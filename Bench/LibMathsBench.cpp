@@ -0,0 +1,891 @@
+/**
+ * Microbenchmarks of the hot public functions.
+ *
+ * Every function is measured two ways, both reported in nanoseconds per operation:
+ * - throughput: s_count independent operations back to back, the CPU overlaps them
+ * - latency: each operation takes the result of the previous one as input, so they
+ *   run one after the other. The result is fed back by adding its first component,
+ *   multiplied by a zero the compiler cannot see, to every component of the next
+ *   input; the cost of that feedback alone is measured first and subtracted.
+ * For the batch functions throughput is one call over s_count elements and latency
+ * one call over s_smallBatch elements, both per element, the second one shows the
+ * fixed cost of a call.
+ *
+ * The inputs come from a fixed seed so runs are comparable across commits:
+ *   libmaths_bench [--json <file|->] [--filter <text>] [--seed <n>] [--level <name>]
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#include "../Vec2/FVec2.hpp"
+#include "../Vec2/FVec2Stream.hpp"
+#include "../Vec3/FVec3.hpp"
+#include "../Vec3/FVec3Stream.hpp"
+#include "../Vec4/FVec4.hpp"
+#include "../Vec4/FVec4Stream.hpp"
+#include "../Quaternion/FQuat.hpp"
+#include "../Quaternion/FQuatStream.hpp"
+#include "../Quaternion/FQuatCodec.hpp"
+#include "../Quaternion/FDualQuat.hpp"
+#include "../Skinning/FSkinInfluences.hpp"
+#include "../Mat3/FMat3.hpp"
+#include "../Mat4/FMat4.hpp"
+#include "../Mat4/FTaggedMat4.hpp"
+#include "../Mat4/FMatrixStack.hpp"
+#include "../Affine/FAffine34.hpp"
+#include "../Transform/FTransform.hpp"
+#include "../Hierarchy/FTransformHierarchy.hpp"
+#include "../Threading/FWorkerPool.hpp"
+#include "../SIMD/Dispatch.hpp"
+
+using namespace lm;
+
+static constexpr size_t s_count = 4096;
+static constexpr size_t s_smallBatch = 16;
+static constexpr int s_runs = 5;
+static constexpr double s_runNanoseconds = 4e6;
+
+static volatile float s_zero = 0.0f;
+static volatile float s_sink = 0.0f;
+
+// The table goes to stderr when the JSON goes to stdout
+static std::FILE* s_table = stdout;
+
+/**
+ * Make the compiler assume p_pointer is read and written, so stores to it are kept
+*/
+static void Escape(const void* p_pointer)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    static const void* volatile escaped;
+    escaped = p_pointer;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "g"(p_pointer) : "memory");
+#endif
+}
+
+/************************************\
+*                                    *
+*             Feedback               *
+*                                    *
+\************************************/
+
+static float& First(float& p_value) { return p_value; }
+static float& First(FVec2& p_value) { return p_value.x; }
+static float& First(FVec3& p_value) { return p_value.x; }
+static float& First(FVec4& p_value) { return p_value.x; }
+static float& First(FQuat& p_value) { return p_value.x; }
+static float& First(FDualQuat& p_value) { return p_value.m_real.x; }
+static float& First(FMat3& p_value) { return p_value.m_matrix[0].x; }
+static float& First(FMat4& p_value) { return p_value.m_matrix[0].x; }
+static float& First(FAffine34& p_value) { return p_value.m_rows[0].x; }
+static float& First(FTaggedMat4& p_value) { return p_value.m_matrix.m_matrix[0].x; }
+
+// The parts are behind setters, read only
+static float First(FTransform& p_value) { return p_value.GetPosition().x; }
+
+/**
+ * Return p_value with p_offset added to every component, so every output depends on it
+*/
+static FVec2 Offset(const FVec2& p_value, float p_offset) { return p_value + FVec2(p_offset); }
+static FVec3 Offset(const FVec3& p_value, float p_offset) { return p_value + FVec3(p_offset); }
+static FVec4 Offset(const FVec4& p_value, float p_offset) { return p_value + FVec4(p_offset); }
+static FQuat Offset(const FQuat& p_value, float p_offset) { return p_value + FQuat(p_offset, p_offset, p_offset, p_offset); }
+
+static FDualQuat Offset(const FDualQuat& p_value, float p_offset)
+{
+    return FDualQuat(Offset(p_value.m_real, p_offset), Offset(p_value.m_dual, p_offset));
+}
+
+static FMat3 Offset(const FMat3& p_value, float p_offset)
+{
+    const FVec3 offset(p_offset);
+    return FMat3(p_value[0] + offset, p_value[1] + offset, p_value[2] + offset);
+}
+
+static FMat4 Offset(const FMat4& p_value, float p_offset)
+{
+    const FVec4 offset(p_offset);
+    return FMat4(p_value[0] + offset, p_value[1] + offset, p_value[2] + offset, p_value[3] + offset);
+}
+
+// The offset is always 0, the flags stay true
+static FTaggedMat4 Offset(const FTaggedMat4& p_value, float p_offset)
+{
+    return FTaggedMat4(Offset(p_value.m_matrix, p_offset), p_value.m_flags);
+}
+
+static FAffine34 Offset(const FAffine34& p_value, float p_offset)
+{
+    const FVec4 offset(p_offset);
+    return FAffine34(p_value.m_rows[0] + offset, p_value.m_rows[1] + offset, p_value.m_rows[2] + offset);
+}
+
+static FTransform Offset(const FTransform& p_value, float p_offset)
+{
+    return FTransform(Offset(p_value.GetPosition(), p_offset), Offset(p_value.GetRotation(), p_offset), Offset(p_value.GetScale(), p_offset));
+}
+
+/**
+ * Input of the throughput loops, passes the value through
+*/
+struct NoFeedback
+{
+    template<typename T>
+    const T& operator()(const T& p_value) const { return p_value; }
+};
+
+/**
+ * Input of the latency loops, makes the value depend on the previous result
+*/
+struct Feedback
+{
+    float m_value;
+
+    template<typename T>
+    T operator()(const T& p_value) const { return Offset(p_value, m_value); }
+};
+
+/************************************\
+*                                    *
+*             Measures               *
+*                                    *
+\************************************/
+
+struct FResult
+{
+    std::string name;
+    double throughput;
+    double latency;
+    size_t batchSize;
+};
+
+/**
+ * Return the best time of p_function over s_runs runs, in nanoseconds per call
+ * @param p_function Called repeatedly, the number of calls per run is calibrated to last about s_runNanoseconds
+*/
+template<typename Function>
+static double BestTime(Function p_function)
+{
+    using Clock = std::chrono::steady_clock;
+
+    size_t repeats = 1;
+
+    for (;;)
+    {
+        const auto start = Clock::now();
+
+        for (size_t repeat = 0; repeat < repeats; repeat++)
+            p_function();
+
+        const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+        if (elapsed >= s_runNanoseconds / 4.0 || repeats >= (size_t(1) << 24))
+        {
+            repeats = std::max<size_t>(1, size_t(double(repeats) * s_runNanoseconds / std::max(elapsed, 1.0)));
+            break;
+        }
+
+        repeats *= 2;
+    }
+
+    double best = 1e300;
+
+    for (int run = 0; run < s_runs; run++)
+    {
+        const auto start = Clock::now();
+
+        for (size_t repeat = 0; repeat < repeats; repeat++)
+            p_function();
+
+        const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        best = std::min(best, elapsed / double(repeats));
+    }
+
+    return best;
+}
+
+/**
+ * Return the time per operation of a chain of s_count dependent calls of p_operation
+*/
+template<typename Operation>
+static double ChainTime(Operation p_operation)
+{
+    float carry = 0.0f;
+
+    const double time = BestTime([&]
+    {
+        const float zero = s_zero;
+
+        for (size_t i = 0; i < s_count; i++)
+        {
+            auto result = p_operation(i, Feedback{ carry * zero });
+            carry = First(result);
+        }
+    });
+
+    s_sink = carry;
+    return time / double(s_count);
+}
+
+class FBenchmark
+{
+public:
+    FBenchmark(std::string p_filter) : m_filter(std::move(p_filter))
+    {
+        // Cost of the feedback alone, removed from every latency
+        std::vector<FVec3> values(s_count);
+        m_feedbackLatency = ChainTime([&](size_t p_index, auto p_feedback)
+        {
+            return p_feedback(values[p_index]);
+        });
+    }
+
+    /**
+     * Measure a function of one element
+     * @param p_name The name in the report
+     * @param p_operation Called as p_operation(index, feedback), returns the result for element index
+     * and passes one of its inputs through feedback
+    */
+    template<typename Operation>
+    void Scalar(const char* p_name, Operation p_operation)
+    {
+        if (!Selected(p_name))
+            return;
+
+        using Result = std::remove_cv_t<decltype(p_operation(size_t(0), NoFeedback{}))>;
+        std::vector<Result> results(s_count);
+
+        const double throughput = BestTime([&]
+        {
+            for (size_t i = 0; i < s_count; i++)
+                results[i] = p_operation(i, NoFeedback{});
+
+            Escape(results.data());
+        }) / double(s_count);
+
+        s_sink = First(results[s_count / 2]);
+
+        const double latency = std::max(0.0, ChainTime(p_operation) - m_feedbackLatency);
+        Add({ p_name, throughput, latency, 0 });
+    }
+
+    /**
+     * Measure a batch function
+     * @param p_name The name in the report
+     * @param p_operation Called as p_operation(count), processes the first count elements
+    */
+    template<typename Operation>
+    void Batch(const char* p_name, Operation p_operation)
+    {
+        if (!Selected(p_name))
+            return;
+
+        const double throughput = BestTime([&] { p_operation(s_count); }) / double(s_count);
+        const double latency = BestTime([&] { p_operation(s_smallBatch); }) / double(s_smallBatch);
+        Add({ p_name, throughput, latency, s_smallBatch });
+    }
+
+    const std::vector<FResult>& Results() const { return m_results; }
+
+private:
+    bool Selected(const char* p_name) const
+    {
+        return m_filter.empty() || std::strstr(p_name, m_filter.c_str()) != nullptr;
+    }
+
+    void Add(FResult p_result)
+    {
+        std::fprintf(s_table, "%-44s %10.3f %10.3f\n", p_result.name.c_str(), p_result.throughput, p_result.latency);
+        std::fflush(s_table);
+        m_results.push_back(std::move(p_result));
+    }
+
+    std::string m_filter;
+    double m_feedbackLatency = 0.0;
+    std::vector<FResult> m_results;
+};
+
+/************************************\
+*                                    *
+*               Inputs               *
+*                                    *
+\************************************/
+
+struct FInputs
+{
+    std::vector<float> scalars;
+    std::vector<FVec2> a2, b2;
+    std::vector<FVec3> a3, b3;
+    std::vector<FVec4> a4, b4;
+    std::vector<FQuat> qa, qb;
+    std::vector<FDualQuat> dqa, dqb;
+    std::vector<FMat3> ma3, mb3, rotations3;
+    std::vector<FMat4> ma4, mb4, rigid4;
+    std::vector<FAffine34> aa, ab;
+    std::vector<FTaggedMat4> taggedAffine, taggedRigid, taggedTranslation;
+    std::vector<FTransform> ta, tb;
+
+    explicit FInputs(unsigned p_seed)
+    {
+        std::mt19937 random(p_seed);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+        std::uniform_real_distribution<float> alpha(0.0f, 1.0f);
+
+        const auto vec3 = [&] { return FVec3(unit(random), unit(random), unit(random)); };
+        const auto quat = [&] { return FQuat::Normalize(FQuat(unit(random), unit(random), unit(random), unit(random))); };
+
+        const auto transform = [&]
+        {
+            return FMat4::Transform(vec3() * 10.0f, quat(), FVec3(scale(random), scale(random), scale(random)));
+        };
+
+        for (size_t i = 0; i < s_count; i++)
+        {
+            scalars.push_back(alpha(random));
+            a2.emplace_back(unit(random), unit(random));
+            b2.emplace_back(unit(random), unit(random));
+            a3.push_back(vec3());
+            b3.push_back(vec3());
+            a4.emplace_back(unit(random), unit(random), unit(random), unit(random));
+            b4.emplace_back(unit(random), unit(random), unit(random), unit(random));
+            qa.push_back(quat());
+            qb.push_back(quat());
+            dqa.push_back(FDualQuat(quat(), vec3() * 10.0f));
+            dqb.push_back(FDualQuat(quat(), vec3() * 10.0f));
+            ma4.push_back(transform());
+            mb4.push_back(transform());
+            ma3.push_back(FMat3(ma4.back()));
+            rigid4.push_back(FMat4::Transform(vec3() * 10.0f, quat(), FVec3(1.0f)));
+            rotations3.push_back(FMat3(rigid4.back()));
+            aa.push_back(FAffine34(ma4.back()));
+            ab.push_back(FAffine34(mb4.back()));
+            taggedAffine.push_back(FTaggedMat4(ma4.back(), EMatrixFlags::Affine));
+            taggedRigid.push_back(FTaggedMat4(rigid4.back(), EMatrixFlags::Affine | EMatrixFlags::Rigid));
+            taggedTranslation.push_back(FTaggedMat4::Translation(vec3() * 10.0f));
+            mb3.push_back(FMat3(mb4.back()));
+            ta.push_back(FTransform(vec3() * 10.0f, quat(), FVec3(scale(random), scale(random), scale(random))));
+            tb.push_back(FTransform(vec3() * 10.0f, quat(), FVec3(scale(random))));
+        }
+    }
+};
+
+/************************************\
+*                                    *
+*               Cases                *
+*                                    *
+\************************************/
+
+static void RunVectors(FBenchmark& p_bench, const FInputs& p_in)
+{
+    p_bench.Scalar("FVec2 a + b * s", [&](size_t i, auto f) { return f(p_in.a2[i]) + p_in.b2[i] * 0.5f; });
+    p_bench.Scalar("FVec2::Dot", [&](size_t i, auto f) { return FVec2::Dot(f(p_in.a2[i]), p_in.b2[i]); });
+    p_bench.Scalar("FVec2::Normalize", [&](size_t i, auto f) { return FVec2::Normalize(f(p_in.a2[i])); });
+
+    p_bench.Scalar("FVec3 a + b * s", [&](size_t i, auto f) { return f(p_in.a3[i]) + p_in.b3[i] * 0.5f; });
+    p_bench.Scalar("FVec3::Dot", [&](size_t i, auto f) { return FVec3::Dot(f(p_in.a3[i]), p_in.b3[i]); });
+    p_bench.Scalar("FVec3::Cross", [&](size_t i, auto f) { return FVec3::Cross(f(p_in.a3[i]), p_in.b3[i]); });
+    p_bench.Scalar("FVec3::Length", [&](size_t i, auto f) { return FVec3::Length(f(p_in.a3[i])); });
+    p_bench.Scalar("FVec3::Normalize", [&](size_t i, auto f) { return FVec3::Normalize(f(p_in.a3[i])); });
+    p_bench.Scalar("FVec3::Lerp", [&](size_t i, auto f) { return FVec3::Lerp(f(p_in.a3[i]), p_in.b3[i], p_in.scalars[i]); });
+
+    p_bench.Scalar("FVec4 a + b * s", [&](size_t i, auto f) { return f(p_in.a4[i]) + p_in.b4[i] * 0.5f; });
+    p_bench.Scalar("FVec4::Dot", [&](size_t i, auto f) { return FVec4::Dot(f(p_in.a4[i]), p_in.b4[i]); });
+    p_bench.Scalar("FVec4::Normalize", [&](size_t i, auto f) { return FVec4::Normalize(f(p_in.a4[i])); });
+}
+
+static void RunMatrices(FBenchmark& p_bench, const FInputs& p_in)
+{
+    p_bench.Scalar("FMat3 * FMat3", [&](size_t i, auto f) { return f(p_in.ma3[i]) * p_in.mb3[i]; });
+    p_bench.Scalar("FMat3::Inverse", [&](size_t i, auto f) { return FMat3::Inverse(f(p_in.ma3[i])); });
+    p_bench.Scalar("FMat3::Transpose", [&](size_t i, auto f) { return FMat3::Transpose(f(p_in.ma3[i])); });
+
+    p_bench.Scalar("FMat4 * FMat4", [&](size_t i, auto f) { return f(p_in.ma4[i]) * p_in.mb4[i]; });
+    p_bench.Scalar("FMat4 * FVec3", [&](size_t i, auto f) { return p_in.ma4[i] * f(p_in.a3[i]); });
+    p_bench.Scalar("FMat4 * FVec4", [&](size_t i, auto f) { return p_in.ma4[i] * f(p_in.a4[i]); });
+    p_bench.Scalar("FMat4::Inverse", [&](size_t i, auto f) { return FMat4::Inverse(f(p_in.ma4[i])); });
+    p_bench.Scalar("FMat4::Classify", [&](size_t i, auto f) { return float(FMat4::Classify(f(p_in.ma4[i]))); });
+    p_bench.Scalar("FMat4::InverseFast (affine)", [&](size_t i, auto f) { return FMat4::InverseFast(f(p_in.ma4[i])); });
+    p_bench.Scalar("FMat4::InverseFast (rigid)", [&](size_t i, auto f) { return FMat4::InverseFast(f(p_in.rigid4[i])); });
+    p_bench.Scalar("FMat4::InverseAffine", [&](size_t i, auto f) { return FMat4::InverseAffine(f(p_in.ma4[i])); });
+    p_bench.Scalar("FMat4::InverseRigid", [&](size_t i, auto f) { return FMat4::InverseRigid(f(p_in.rigid4[i])); });
+    p_bench.Scalar("FMat4::Transpose", [&](size_t i, auto f) { return FMat4::Transpose(f(p_in.ma4[i])); });
+
+    p_bench.Scalar("FMat4::Decompose", [&](size_t i, auto f)
+    {
+        FVec3 position, rotation, scale;
+        FMat4::Decompose(f(p_in.ma4[i]), position, rotation, scale);
+        return position + rotation + scale;
+    });
+
+    p_bench.Scalar("FMat4::Transform (euler)", [&](size_t i, auto f)
+    {
+        return FMat4::Transform(f(p_in.a3[i]), p_in.b3[i], FVec3(p_in.scalars[i] + 0.5f));
+    });
+
+    p_bench.Scalar("FMat4::Transform (quaternion)", [&](size_t i, auto f)
+    {
+        return FMat4::Transform(f(p_in.a3[i]), p_in.qa[i], FVec3(p_in.scalars[i] + 0.5f));
+    });
+
+    p_bench.Scalar("FTaggedMat4 * FTaggedMat4 (affine)", [&](size_t i, auto f) { return f(p_in.taggedAffine[i]) * p_in.taggedRigid[i]; });
+    p_bench.Scalar("FTaggedMat4 * FTaggedMat4 (translation)", [&](size_t i, auto f) { return f(p_in.taggedTranslation[i]) * p_in.taggedAffine[i]; });
+    p_bench.Scalar("FTaggedMat4::Inverse (rigid)", [&](size_t i, auto f) { return FTaggedMat4::Inverse(f(p_in.taggedRigid[i])); });
+    p_bench.Scalar("FTaggedMat4::Inverse (translation)", [&](size_t i, auto f) { return FTaggedMat4::Inverse(f(p_in.taggedTranslation[i])); });
+
+    p_bench.Scalar("FAffine34 * FAffine34", [&](size_t i, auto f) { return f(p_in.aa[i]) * p_in.ab[i]; });
+    p_bench.Scalar("FAffine34 * FVec3", [&](size_t i, auto f) { return p_in.aa[i] * f(p_in.a3[i]); });
+    p_bench.Scalar("FAffine34::Inverse", [&](size_t i, auto f) { return FAffine34::Inverse(f(p_in.aa[i])); });
+
+    p_bench.Scalar("FTransform * FTransform", [&](size_t i, auto f) { return f(p_in.ta[i]) * p_in.tb[i]; });
+    p_bench.Scalar("FTransform * FVec3", [&](size_t i, auto f) { return p_in.ta[i] * f(p_in.a3[i]); });
+    p_bench.Scalar("FTransform::Inverse", [&](size_t i, auto f) { return FTransform::Inverse(f(p_in.tb[i])); });
+    p_bench.Scalar("FTransform::GetMatrix (cached)", [&](size_t i, auto) { return p_in.ta[i].GetMatrix(); });
+    p_bench.Scalar("FTransform::GetInverseMatrix (cached)", [&](size_t i, auto) { return p_in.ta[i].GetInverseMatrix(); });
+
+    p_bench.Scalar("FTransform::GetMatrix (after a change)", [&](size_t i, auto f)
+    {
+        FTransform transform = p_in.ta[i];
+        transform.SetPosition(f(p_in.a3[i]));
+        return transform.GetMatrix();
+    });
+
+    p_bench.Scalar("FTransform::GetInverseMatrix (after a change)", [&](size_t i, auto f)
+    {
+        FTransform transform = p_in.ta[i];
+        transform.SetPosition(f(p_in.a3[i]));
+        return transform.GetInverseMatrix();
+    });
+}
+
+static void RunQuaternions(FBenchmark& p_bench, const FInputs& p_in)
+{
+    p_bench.Scalar("FQuat * FQuat", [&](size_t i, auto f) { return f(p_in.qa[i]) * p_in.qb[i]; });
+    p_bench.Scalar("FQuat * FVec3", [&](size_t i, auto f) { return p_in.qa[i] * f(p_in.a3[i]); });
+    p_bench.Scalar("FQuat::Normalize", [&](size_t i, auto f) { return FQuat::Normalize(f(p_in.qa[i])); });
+    p_bench.Scalar("FQuat::NLerp", [&](size_t i, auto f) { return FQuat::NLerp(f(p_in.qa[i]), p_in.qb[i], p_in.scalars[i]); });
+    p_bench.Scalar("FQuat::SLerp", [&](size_t i, auto f) { return FQuat::SLerp(f(p_in.qa[i]), p_in.qb[i], p_in.scalars[i]); });
+    p_bench.Scalar("FQuat::SLerpFast", [&](size_t i, auto f) { return FQuat::SLerpFast(f(p_in.qa[i]), p_in.qb[i], p_in.scalars[i]); });
+    p_bench.Scalar("FQuat::ToRotateMat3", [&](size_t i, auto f) { return FQuat::ToRotateMat3(f(p_in.qa[i])); });
+    p_bench.Scalar("FQuat::FromMatrix3", [&](size_t i, auto f) { return FQuat::FromMatrix3(f(p_in.rotations3[i])); });
+    p_bench.Scalar("FQuatCodec::Encode32 and Decode32", [&](size_t i, auto f) { return FQuatCodec::Decode32(FQuatCodec::Encode32(f(p_in.qa[i]))); });
+    p_bench.Scalar("FQuatCodec::Encode48 and Decode48", [&](size_t i, auto f) { return FQuatCodec::Decode48(FQuatCodec::Encode48(f(p_in.qa[i]))); });
+
+    p_bench.Scalar("FDualQuat::Multiply", [&](size_t i, auto f) { return FDualQuat::Multiply(f(p_in.dqa[i]), p_in.dqb[i]); });
+    p_bench.Scalar("FDualQuat::Normalize", [&](size_t i, auto f) { return FDualQuat::Normalize(f(p_in.dqa[i])); });
+    p_bench.Scalar("FDualQuat::TransformPoint", [&](size_t i, auto f) { return FDualQuat::TransformPoint(p_in.dqa[i], f(p_in.a3[i])); });
+}
+
+/**
+ * The same values in a stream of s_count elements and one of s_smallBatch elements
+*/
+template<typename Stream>
+struct FStreams
+{
+    Stream large;
+    Stream small;
+
+    template<typename T>
+    explicit FStreams(const std::vector<T>& p_values) : large(std::span(p_values)), small(std::span(p_values).first(s_smallBatch))
+    {
+    }
+};
+
+static void RunBatches(FBenchmark& p_bench, const FInputs& p_in)
+{
+    std::vector<FMat4> matrices(s_count);
+    std::vector<FVec3> vectors3(s_count);
+    std::vector<FVec4> vectors4(s_count);
+    std::vector<float> scalars(s_count);
+    const FMat4& matrix = p_in.ma4[0];
+
+    p_bench.Batch("FMat4::MultiplyBatch", [&](size_t n)
+    {
+        FMat4::MultiplyBatch(std::span(p_in.ma4).first(n), std::span(p_in.mb4).first(n), std::span(matrices).first(n));
+    });
+
+    p_bench.Batch("FMat4::InverseBatch", [&](size_t n)
+    {
+        FMat4::InverseBatch(std::span(p_in.ma4).first(n), std::span(matrices).first(n));
+    });
+
+    p_bench.Batch("FMat4::TransformPoints", [&](size_t n)
+    {
+        FMat4::TransformPoints(matrix, std::span(p_in.a3).first(n), std::span(vectors3).first(n));
+    });
+
+    p_bench.Batch("FMat4::TransformDirections", [&](size_t n)
+    {
+        FMat4::TransformDirections(matrix, std::span(p_in.a3).first(n), std::span(vectors3).first(n));
+    });
+
+    p_bench.Batch("FMat4::TransformPointsProjective (FVec3)", [&](size_t n)
+    {
+        FMat4::TransformPointsProjective(matrix, std::span(p_in.a3).first(n), std::span(vectors4).first(n));
+    });
+
+    p_bench.Batch("FMat4::TransformPointsProjective (FVec4)", [&](size_t n)
+    {
+        FMat4::TransformPointsProjective(matrix, std::span(p_in.a4).first(n), std::span(vectors4).first(n));
+    });
+
+    // In place, the vectors keep turning
+    p_bench.Batch("FQuat::RotateVectors", [&](size_t n)
+    {
+        FQuat::RotateVectors(p_in.qa[0], std::span(vectors3).first(n));
+    });
+
+    p_bench.Batch("FQuat::RotateVectors (a rotation per vector)", [&](size_t n)
+    {
+        FQuat::RotateVectors(std::span(p_in.qa).first(n), std::span(vectors3).first(n));
+    });
+
+    std::vector<uint32_t> codes32(s_count);
+    std::vector<FPackedQuat48> codes48(s_count);
+    std::vector<FQuat> rotations(s_count);
+
+    p_bench.Batch("FQuatCodec::Encode32", [&](size_t n) { FQuatCodec::Encode32(std::span(p_in.qa).first(n), std::span(codes32).first(n)); });
+    p_bench.Batch("FQuatCodec::Decode32", [&](size_t n) { FQuatCodec::Decode32(std::span(codes32).first(n), std::span(rotations).first(n)); });
+    p_bench.Batch("FQuatCodec::Encode48", [&](size_t n) { FQuatCodec::Encode48(std::span(p_in.qa).first(n), std::span(codes48).first(n)); });
+    p_bench.Batch("FQuatCodec::Decode48", [&](size_t n) { FQuatCodec::Decode48(std::span(codes48).first(n), std::span(rotations).first(n)); });
+
+    std::vector<FMat3> matrices3(s_count);
+    std::vector<FAffine34> rotationTransforms(s_count);
+
+    p_bench.Batch("FQuat::ToRotateMat3 (batch)", [&](size_t n) { FQuat::ToRotateMat3(std::span(p_in.qa).first(n), std::span(matrices3).first(n)); });
+    p_bench.Batch("FQuat::ToAffine", [&](size_t n) { FQuat::ToAffine(std::span(p_in.qa).first(n), std::span(rotationTransforms).first(n)); });
+    p_bench.Batch("FQuat::ToMat4", [&](size_t n) { FQuat::ToMat4(std::span(p_in.qa).first(n), std::span(matrices).first(n)); });
+    p_bench.Batch("FQuat::FromMatrix3 (batch)", [&](size_t n) { FQuat::FromMatrix3(std::span(p_in.rotations3).first(n), std::span(rotations).first(n)); });
+
+    std::vector<FAffine34> transforms(s_count);
+    const FAffine34& transform = p_in.aa[0];
+
+    p_bench.Batch("FAffine34::MultiplyBatch", [&](size_t n)
+    {
+        FAffine34::MultiplyBatch(std::span(p_in.aa).first(n), std::span(p_in.ab).first(n), std::span(transforms).first(n));
+    });
+
+    p_bench.Batch("FAffine34::InverseBatch", [&](size_t n)
+    {
+        FAffine34::InverseBatch(std::span(p_in.aa).first(n), std::span(transforms).first(n));
+    });
+
+    p_bench.Batch("FAffine34::TransformPoints", [&](size_t n)
+    {
+        FAffine34::TransformPoints(transform, std::span(p_in.a3).first(n), std::span(vectors3).first(n));
+    });
+
+    p_bench.Batch("FAffine34::TransformDirections", [&](size_t n)
+    {
+        FAffine34::TransformDirections(transform, std::span(p_in.a3).first(n), std::span(vectors3).first(n));
+    });
+
+    std::vector<float> packed(s_count * 16);
+
+    p_bench.Batch("FMat4::PackMatrices (native)", [&](size_t n)
+    {
+        FMat4::PackMatrices(std::span(p_in.ma4).first(n), packed.data());
+    });
+
+    p_bench.Batch("FMat4::PackMatrices (transposed)", [&](size_t n)
+    {
+        FMat4::PackMatrices(std::span(p_in.ma4).first(n), packed.data(), EMatrixLayout::Transposed);
+    });
+
+    const auto pick = [](auto& p_streams, size_t n) -> auto& { return n == s_count ? p_streams.large : p_streams.small; };
+
+    FStreams<FVec2Stream> a2(p_in.a2), b2(p_in.b2), r2(p_in.a2);
+    FStreams<FVec3Stream> a3(p_in.a3), b3(p_in.b3), r3(p_in.a3);
+    FStreams<FVec4Stream> a4(p_in.a4), b4(p_in.b4), r4(p_in.a4);
+    FStreams<FQuatStream> qa(p_in.qa), qb(p_in.qb), rq(p_in.qa);
+
+    p_bench.Batch("FMat4::TransformBatch", [&](size_t n)
+    {
+        FMat4::TransformBatch(pick(a3, n), pick(qa, n), pick(b3, n), std::span(matrices).first(n));
+    });
+
+    // Trees of 4 children per node, marking the root dirty recomposes every node
+    FTransformHierarchy hierarchies[2];
+    const size_t hierarchySizes[2] = { s_count, s_smallBatch };
+
+    for (size_t h = 0; h < 2; h++)
+    {
+        hierarchies[h].Reserve(hierarchySizes[h]);
+
+        for (size_t i = 0; i < hierarchySizes[h]; i++)
+        {
+            hierarchies[h].Add(i == 0 ? FTransformHierarchy::NoParent : (i - 1) / 4, p_in.a3[i], p_in.qa[i], FVec3(1.0f) + p_in.b3[i] * 0.1f);
+        }
+    }
+
+    p_bench.Batch("FTransformHierarchy::Update", [&](size_t n)
+    {
+        FTransformHierarchy& hierarchy = hierarchies[n == s_count ? 0 : 1];
+        hierarchy.SetLocalPosition(0, hierarchy.GetLocalPosition(0));
+        hierarchy.Update();
+    });
+
+    FWorkerPool pool;
+
+    p_bench.Batch("FTransformHierarchy::Update (worker pool)", [&](size_t n)
+    {
+        FTransformHierarchy& hierarchy = hierarchies[n == s_count ? 0 : 1];
+        hierarchy.SetLocalPosition(0, hierarchy.GetLocalPosition(0));
+        hierarchy.Update(pool);
+    });
+
+    // A walk of 8 levels deep branches: push, place, read the model and normal matrices, back to the root every 8 levels
+    std::vector<FMat4> vectorStack;
+
+    p_bench.Batch("std::vector<FMat4> as a matrix stack", [&](size_t n)
+    {
+        vectorStack.assign(1, FMat4(1.0f));
+
+        for (size_t i = 0; i < n; i++)
+        {
+            if (i % 8 == 0)
+                vectorStack.resize(1);
+
+            vectorStack.push_back(vectorStack.back());
+            vectorStack.back() = FMat4::Translate(vectorStack.back(), p_in.a3[i]);
+            vectorStack.back() = FMat4::Rotate(vectorStack.back(), p_in.scalars[i] * 360.0f, p_in.b3[i]);
+            vectorStack.back() = vectorStack.back() * FMat4::Scale(FMat4(1.0f), FVec3(p_in.scalars[i] + 0.5f));
+
+            const FMat3 normal = FMat3::Transpose(FMat3::Inverse(FMat3(vectorStack.back())));
+            Escape(&vectorStack.back());
+            Escape(&normal);
+        }
+    });
+
+    FMatrixStack matrixStack(16);
+
+    p_bench.Batch("FMatrixStack", [&](size_t n)
+    {
+        matrixStack.Clear();
+
+        for (size_t i = 0; i < n; i++)
+        {
+            if (i % 8 == 0)
+                matrixStack.Clear();
+
+            matrixStack.Push();
+            matrixStack.Translate(p_in.a3[i]);
+            matrixStack.Rotate(p_in.scalars[i] * 360.0f, p_in.b3[i]);
+            matrixStack.Scale(FVec3(p_in.scalars[i] + 0.5f));
+
+            Escape(&matrixStack.GetTop());
+            Escape(&matrixStack.GetNormalMatrix());
+        }
+    });
+
+    // 4 influences per vertex over 64 bones
+    constexpr uint32_t boneCount = 64;
+    const auto influences = [&](size_t p_size)
+    {
+        FSkinInfluences result(p_size);
+
+        for (size_t i = 0; i < p_size; i++)
+        {
+            const uint32_t bones[] = { uint32_t(i % boneCount), uint32_t((i * 7 + 1) % boneCount), uint32_t((i * 13 + 2) % boneCount), uint32_t((i * 29 + 3) % boneCount) };
+            const float weights[] = { 0.4f, 0.3f, 0.2f * p_in.scalars[i], 0.1f };
+            result.Set(i, bones, weights);
+        }
+
+        return result;
+    };
+
+    const FSkinInfluences skinLarge = influences(s_count);
+    const FSkinInfluences skinSmall = influences(s_smallBatch);
+    const std::span<const FDualQuat> dualQuatBones = std::span(p_in.dqa).first(boneCount);
+
+    p_bench.Batch("FDualQuat::Skin", [&](size_t n)
+    {
+        FDualQuat::Skin(dualQuatBones, n == s_count ? skinLarge : skinSmall, pick(a3, n), pick(r3, n));
+    });
+
+    FStreams<FVec3Stream> skinnedNormals(p_in.b3);
+
+    p_bench.Batch("FMat4::Skin (positions and normals)", [&](size_t n)
+    {
+        FMat4::Skin(std::span(p_in.ma4).first(boneCount), n == s_count ? skinLarge : skinSmall, pick(a3, n), pick(b3, n), pick(r3, n), pick(skinnedNormals, n));
+    });
+
+    p_bench.Batch("FAffine34::Skin (positions and normals)", [&](size_t n)
+    {
+        FAffine34::Skin(std::span(p_in.aa).first(boneCount), n == s_count ? skinLarge : skinSmall, pick(a3, n), pick(b3, n), pick(r3, n), pick(skinnedNormals, n));
+    });
+
+    p_bench.Batch("FVec2Stream::Add", [&](size_t n) { FVec2Stream::Add(pick(a2, n), pick(b2, n), pick(r2, n)); });
+    p_bench.Batch("FVec2Stream::Normalize", [&](size_t n) { FVec2Stream::Normalize(pick(a2, n), pick(r2, n)); });
+
+    p_bench.Batch("FVec3Stream::Load", [&](size_t n) { pick(r3, n).Load(std::span(p_in.a3).first(n)); });
+    p_bench.Batch("FVec3Stream::Store", [&](size_t n) { pick(a3, n).Store(std::span(vectors3).first(n)); });
+    p_bench.Batch("FVec3Stream::Add", [&](size_t n) { FVec3Stream::Add(pick(a3, n), pick(b3, n), pick(r3, n)); });
+    p_bench.Batch("FVec3Stream::Dot", [&](size_t n) { FVec3Stream::Dot(pick(a3, n), pick(b3, n), std::span(scalars).first(n)); });
+    p_bench.Batch("FVec3Stream::Cross", [&](size_t n) { FVec3Stream::Cross(pick(a3, n), pick(b3, n), pick(r3, n)); });
+    p_bench.Batch("FVec3Stream::Length", [&](size_t n) { FVec3Stream::Length(pick(a3, n), std::span(scalars).first(n)); });
+    p_bench.Batch("FVec3Stream::Normalize", [&](size_t n) { FVec3Stream::Normalize(pick(a3, n), pick(r3, n)); });
+    p_bench.Batch("FVec3Stream::Lerp", [&](size_t n) { FVec3Stream::Lerp(pick(a3, n), pick(b3, n), 0.25f, pick(r3, n)); });
+
+    p_bench.Batch("FVec4Stream::Add", [&](size_t n) { FVec4Stream::Add(pick(a4, n), pick(b4, n), pick(r4, n)); });
+    p_bench.Batch("FVec4Stream::Dot", [&](size_t n) { FVec4Stream::Dot(pick(a4, n), pick(b4, n), std::span(scalars).first(n)); });
+    p_bench.Batch("FVec4Stream::Normalize", [&](size_t n) { FVec4Stream::Normalize(pick(a4, n), pick(r4, n)); });
+
+    p_bench.Batch("FQuatStream::Normalize", [&](size_t n) { FQuatStream::Normalize(pick(qa, n), pick(rq, n)); });
+    p_bench.Batch("FQuatStream::Lerp", [&](size_t n) { FQuatStream::Lerp(pick(qa, n), pick(qb, n), 0.25f, pick(rq, n)); });
+    p_bench.Batch("FQuatStream::NLerp", [&](size_t n) { FQuatStream::NLerp(pick(qa, n), pick(qb, n), 0.25f, pick(rq, n)); });
+    p_bench.Batch("FQuatStream::SLerp", [&](size_t n) { FQuatStream::SLerp(pick(qa, n), pick(qb, n), 0.25f, pick(rq, n)); });
+    p_bench.Batch("FQuatStream::SLerp (an alpha per element)", [&](size_t n)
+    {
+        FQuatStream::SLerp(pick(qa, n), pick(qb, n), std::span<const float>(p_in.scalars).first(n), pick(rq, n));
+    });
+    p_bench.Batch("FQuatStream::SLerpFast", [&](size_t n) { FQuatStream::SLerpFast(pick(qa, n), pick(qb, n), 0.25f, pick(rq, n)); });
+
+    Escape(matrices.data());
+    Escape(vectors3.data());
+    Escape(vectors4.data());
+    Escape(scalars.data());
+    Escape(packed.data());
+    Escape(codes32.data());
+    Escape(codes48.data());
+    Escape(rotations.data());
+    Escape(matrices3.data());
+    Escape(rotationTransforms.data());
+}
+
+/************************************\
+*                                    *
+*               Report               *
+*                                    *
+\************************************/
+
+static void WriteJSON(std::FILE* p_file, const std::vector<FResult>& p_results, unsigned p_seed)
+{
+#ifdef NDEBUG
+    constexpr bool optimized = true;
+#else
+    constexpr bool optimized = false;
+#endif
+
+    std::fprintf(p_file, "{\n");
+    std::fprintf(p_file, "  \"library\": \"LibMaths\",\n");
+    std::fprintf(p_file, "  \"simd\": \"%s\",\n", ToString(GetSIMDLevel()));
+    std::fprintf(p_file, "  \"inline\": %s,\n", LIBMATHS_INLINE ? "true" : "false");
+    std::fprintf(p_file, "  \"optimized\": %s,\n", optimized ? "true" : "false");
+    std::fprintf(p_file, "  \"seed\": %u,\n", p_seed);
+    std::fprintf(p_file, "  \"count\": %zu,\n", s_count);
+    std::fprintf(p_file, "  \"unit\": \"ns/op\",\n");
+    std::fprintf(p_file, "  \"results\": [\n");
+
+    for (size_t i = 0; i < p_results.size(); i++)
+    {
+        const FResult& result = p_results[i];
+        std::fprintf(p_file, "    { \"name\": \"%s\", \"throughput\": %.4f, \"latency\": %.4f", result.name.c_str(), result.throughput, result.latency);
+
+        if (result.batchSize != 0)
+            std::fprintf(p_file, ", \"latency_batch\": %zu", result.batchSize);
+
+        std::fprintf(p_file, " }%s\n", i + 1 < p_results.size() ? "," : "");
+    }
+
+    std::fprintf(p_file, "  ]\n}\n");
+}
+
+static int Usage(const char* p_program)
+{
+    std::fprintf(stderr, "usage: %s [--json <file|->] [--filter <text>] [--seed <n>] [--level <Scalar|SSE2|SSE4.2|AVX2|AVX-512>]\n", p_program);
+    return 1;
+}
+
+int main(int p_argc, char** p_argv)
+{
+    const char* json = nullptr;
+    std::string filter;
+    unsigned seed = 42;
+
+    for (int i = 1; i < p_argc; i++)
+    {
+        const std::string argument = p_argv[i];
+
+        if (i + 1 >= p_argc)
+            return Usage(p_argv[0]);
+
+        if (argument == "--json")
+            json = p_argv[++i];
+        else if (argument == "--filter")
+            filter = p_argv[++i];
+        else if (argument == "--seed")
+            seed = unsigned(std::strtoul(p_argv[++i], nullptr, 10));
+        else if (argument == "--level")
+        {
+            const std::string name = p_argv[++i];
+            bool found = false;
+
+            for (ESIMDLevel level : { ESIMDLevel::Scalar, ESIMDLevel::SSE2, ESIMDLevel::SSE42, ESIMDLevel::AVX2, ESIMDLevel::AVX512 })
+            {
+                if (name == ToString(level))
+                {
+                    if (!SetSIMDLevel(level))
+                    {
+                        std::fprintf(stderr, "SIMD level %s is not available\n", name.c_str());
+                        return 1;
+                    }
+
+                    found = true;
+                }
+            }
+
+            if (!found)
+                return Usage(p_argv[0]);
+        }
+        else
+            return Usage(p_argv[0]);
+    }
+
+    if (json != nullptr && std::strcmp(json, "-") == 0)
+        s_table = stderr;
+
+    std::fprintf(s_table, "LibMaths benchmarks, SIMD %s, %s functions, seed %u\n", ToString(GetSIMDLevel()), LIBMATHS_INLINE ? "inline" : "out-of-line", seed);
+    std::fprintf(s_table, "%-44s %10s %10s\n", "ns/op", "throughput", "latency");
+
+    const FInputs inputs(seed);
+    FBenchmark bench(filter);
+
+    RunVectors(bench, inputs);
+    RunMatrices(bench, inputs);
+    RunQuaternions(bench, inputs);
+    RunBatches(bench, inputs);
+
+    if (json != nullptr)
+    {
+        std::FILE* file = std::strcmp(json, "-") == 0 ? stdout : std::fopen(json, "w");
+
+        if (file == nullptr)
+        {
+            std::fprintf(stderr, "Cannot write %s\n", json);
+            return 1;
+        }
+
+        WriteJSON(file, bench.Results(), seed);
+
+        if (file != stdout)
+            std::fclose(file);
+    }
+
+    return 0;
+}
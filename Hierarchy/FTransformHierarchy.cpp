@@ -0,0 +1,286 @@
+#include "FTransformHierarchy.hpp"
+#include "../SIMD/Mat4Kernels.h"
+#include "../Threading/FWorkerPool.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+using namespace lm;
+
+void lm::FTransformHierarchy::Reserve(size_t p_capacity)
+{
+    m_parents.reserve(p_capacity);
+    m_positions.reserve(p_capacity);
+    m_rotations.reserve(p_capacity);
+    m_scales.reserve(p_capacity);
+    m_worlds.reserve(p_capacity);
+    m_inverseWorlds.reserve(p_capacity);
+    m_dirty.reserve(p_capacity);
+    m_depths.reserve(p_capacity);
+}
+
+void lm::FTransformHierarchy::Clear()
+{
+    m_parents.clear();
+    m_positions.clear();
+    m_rotations.clear();
+    m_scales.clear();
+    m_worlds.clear();
+    m_inverseWorlds.clear();
+    m_dirty.clear();
+    m_depths.clear();
+    m_firstDirty = NoParent;
+    m_levelsValid = false;
+}
+
+size_t lm::FTransformHierarchy::Add(size_t p_parent, const FVec3& p_position, const FQuat& p_rotation, const FVec3& p_scale)
+{
+    if (p_parent != NoParent && p_parent >= m_parents.size())
+    {
+        throw std::out_of_range("FTransformHierarchy::Add: the parent must be added before its children");
+    }
+
+    const size_t node = m_parents.size();
+
+    m_parents.push_back(p_parent);
+    m_positions.push_back(p_position);
+    m_rotations.push_back(p_rotation);
+    m_scales.push_back(p_scale);
+    m_worlds.emplace_back(1.0f);
+    m_inverseWorlds.emplace_back(1.0f);
+    m_dirty.push_back(0);
+    m_depths.push_back(p_parent == NoParent ? 0 : m_depths[p_parent] + 1);
+    m_levelsValid = false;
+
+    MarkDirty(node);
+    return node;
+}
+
+size_t lm::FTransformHierarchy::Size() const
+{
+    return m_parents.size();
+}
+
+size_t lm::FTransformHierarchy::GetParent(size_t p_node) const
+{
+    CheckNode(p_node, "FTransformHierarchy::GetParent");
+    return m_parents[p_node];
+}
+
+const FVec3& lm::FTransformHierarchy::GetLocalPosition(size_t p_node) const
+{
+    CheckNode(p_node, "FTransformHierarchy::GetLocalPosition");
+    return m_positions[p_node];
+}
+
+const FQuat& lm::FTransformHierarchy::GetLocalRotation(size_t p_node) const
+{
+    CheckNode(p_node, "FTransformHierarchy::GetLocalRotation");
+    return m_rotations[p_node];
+}
+
+const FVec3& lm::FTransformHierarchy::GetLocalScale(size_t p_node) const
+{
+    CheckNode(p_node, "FTransformHierarchy::GetLocalScale");
+    return m_scales[p_node];
+}
+
+void lm::FTransformHierarchy::SetLocalPosition(size_t p_node, const FVec3& p_position)
+{
+    CheckNode(p_node, "FTransformHierarchy::SetLocalPosition");
+    m_positions[p_node] = p_position;
+    MarkDirty(p_node);
+}
+
+void lm::FTransformHierarchy::SetLocalRotation(size_t p_node, const FQuat& p_rotation)
+{
+    CheckNode(p_node, "FTransformHierarchy::SetLocalRotation");
+    m_rotations[p_node] = p_rotation;
+    MarkDirty(p_node);
+}
+
+void lm::FTransformHierarchy::SetLocalScale(size_t p_node, const FVec3& p_scale)
+{
+    CheckNode(p_node, "FTransformHierarchy::SetLocalScale");
+    m_scales[p_node] = p_scale;
+    MarkDirty(p_node);
+}
+
+void lm::FTransformHierarchy::SetLocal(size_t p_node, const FVec3& p_position, const FQuat& p_rotation, const FVec3& p_scale)
+{
+    CheckNode(p_node, "FTransformHierarchy::SetLocal");
+    m_positions[p_node] = p_position;
+    m_rotations[p_node] = p_rotation;
+    m_scales[p_node] = p_scale;
+    MarkDirty(p_node);
+}
+
+bool lm::FTransformHierarchy::IsDirty(size_t p_node) const
+{
+    CheckNode(p_node, "FTransformHierarchy::IsDirty");
+    return m_dirty[p_node] != 0;
+}
+
+size_t lm::FTransformHierarchy::GetDepth(size_t p_node) const
+{
+    CheckNode(p_node, "FTransformHierarchy::GetDepth");
+    return m_depths[p_node];
+}
+
+void lm::FTransformHierarchy::Update()
+{
+    if (m_firstDirty == NoParent)
+    {
+        return;
+    }
+
+    // Parents come first, so a node sees the final flag of its parent and the flags carry down the subtrees
+    for (size_t node = m_firstDirty; node < m_parents.size(); node++)
+    {
+        UpdateNode(node);
+    }
+
+    EndUpdate();
+}
+
+void lm::FTransformHierarchy::Update(FWorkerPool& p_pool)
+{
+    if (m_firstDirty == NoParent)
+    {
+        return;
+    }
+
+    if (!m_levelsValid)
+    {
+        BuildLevels();
+    }
+
+    // 64 nodes are a cache line of dirty flags and 64 matrices of a cache line each, so chunks
+    // next to each other rarely share a line and a chunk hides the cost of taking it
+    constexpr size_t chunkSize = 64;
+
+    // The parents of a level are all in the previous one, done before the next ParallelFor starts
+    for (size_t level = 0; level + 1 < m_levelStarts.size(); level++)
+    {
+        const size_t* nodes = m_levelOrder.data() + m_levelStarts[level];
+
+        p_pool.ParallelFor(m_levelStarts[level + 1] - m_levelStarts[level], chunkSize, [&](size_t p_begin, size_t p_end)
+        {
+            for (size_t i = p_begin; i < p_end; i++)
+            {
+                if (nodes[i] >= m_firstDirty)
+                {
+                    UpdateNode(nodes[i]);
+                }
+            }
+        });
+    }
+
+    EndUpdate();
+}
+
+const FMat4& lm::FTransformHierarchy::GetWorld(size_t p_node) const
+{
+    CheckNode(p_node, "FTransformHierarchy::GetWorld");
+    return m_worlds[p_node];
+}
+
+const FMat4& lm::FTransformHierarchy::GetInverseWorld(size_t p_node) const
+{
+    CheckNode(p_node, "FTransformHierarchy::GetInverseWorld");
+    return m_inverseWorlds[p_node];
+}
+
+std::span<const FMat4> lm::FTransformHierarchy::GetWorlds() const
+{
+    return m_worlds;
+}
+
+std::span<const FMat4> lm::FTransformHierarchy::GetInverseWorlds() const
+{
+    return m_inverseWorlds;
+}
+
+void lm::FTransformHierarchy::CheckNode(size_t p_node, const char* p_function) const
+{
+    if (p_node >= m_parents.size())
+    {
+        throw std::out_of_range(std::string(p_function) + ": node index out of range");
+    }
+}
+
+void lm::FTransformHierarchy::MarkDirty(size_t p_node)
+{
+    m_dirty[p_node] = 1;
+    m_firstDirty = std::min(m_firstDirty, p_node);
+}
+
+void lm::FTransformHierarchy::BuildLevels()
+{
+    // Counting sort on the depths, stable so each level keeps the order of the arrays
+    m_levelStarts.assign(1, 0);
+
+    for (size_t depth : m_depths)
+    {
+        if (depth + 2 > m_levelStarts.size())
+        {
+            m_levelStarts.resize(depth + 2, 0);
+        }
+
+        m_levelStarts[depth + 1]++;
+    }
+
+    for (size_t level = 1; level < m_levelStarts.size(); level++)
+    {
+        m_levelStarts[level] += m_levelStarts[level - 1];
+    }
+
+    std::vector<size_t> next(m_levelStarts.begin(), m_levelStarts.end() - 1);
+    m_levelOrder.resize(m_depths.size());
+
+    for (size_t node = 0; node < m_depths.size(); node++)
+    {
+        m_levelOrder[next[m_depths[node]]++] = node;
+    }
+
+    m_levelsValid = true;
+}
+
+void lm::FTransformHierarchy::UpdateNode(size_t p_node)
+{
+    const size_t parent = m_parents[p_node];
+
+    if (parent != NoParent && parent >= m_firstDirty)
+    {
+        m_dirty[p_node] |= m_dirty[parent];
+    }
+
+    if (!m_dirty[p_node])
+    {
+        return;
+    }
+
+    const FVec3& position = m_positions[p_node];
+    const FQuat& rotation = m_rotations[p_node];
+    const FVec3& scale = m_scales[p_node];
+
+    if (parent == NoParent)
+    {
+        simd::Mat4TRS(position.x, position.y, position.z, rotation.x, rotation.y, rotation.z, rotation.w,
+            scale.x, scale.y, scale.z, m_worlds[p_node]);
+    }
+    else
+    {
+        simd::Mat4MultiplyTRS(m_worlds[parent], position.x, position.y, position.z, rotation.x, rotation.y, rotation.z, rotation.w,
+            scale.x, scale.y, scale.z, m_worlds[p_node]);
+    }
+
+    simd::Mat4InverseAffine(m_worlds[p_node], m_inverseWorlds[p_node]);
+}
+
+void lm::FTransformHierarchy::EndUpdate()
+{
+    std::fill(m_dirty.begin() + m_firstDirty, m_dirty.end(), static_cast<uint8_t>(0));
+    m_firstDirty = NoParent;
+}
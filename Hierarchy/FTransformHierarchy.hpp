@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "../Vec3/FVec3.hpp"
+#include "../Quaternion/FQuat.hpp"
+#include "../Mat4/FMat4.hpp"
+
+namespace lm
+{
+    struct FWorkerPool;
+
+    /**
+     * @brief A tree of transforms stored in flat arrays, parents before their children
+     * @details Each node has a local translation, rotation and scale. Update recomposes the world
+     * matrix (parent world * local) and its inverse only for the nodes whose local transform
+     * changed and for their descendants, in a single pass over the arrays, or level by level on a
+     * FWorkerPool: the nodes of a depth only read the worlds of the previous depth.
+     * @note Nodes are only appended, a parent is always added before its children
+    */
+    struct FTransformHierarchy
+    {
+        static constexpr size_t NoParent = std::numeric_limits<size_t>::max();
+
+        FTransformHierarchy() = default;
+
+        /**
+         * @brief Reserves the memory of p_capacity nodes
+        */
+        void Reserve(size_t p_capacity);
+
+        /**
+         * @brief Removes every node
+        */
+        void Clear();
+
+        /**
+         * @brief Appends a node, dirty until the next Update
+         * @param p_parent Index of the parent, or NoParent for a root
+         * @param p_position The local translation
+         * @param p_rotation The local rotation
+         * @param p_scale The local scale
+         * @return The index of the node
+        */
+        size_t Add(size_t p_parent, const FVec3& p_position = FVec3::Zero, const FQuat& p_rotation = FQuat::identity, const FVec3& p_scale = FVec3::One);
+
+        size_t Size() const;
+        size_t GetParent(size_t p_node) const;
+
+        const FVec3& GetLocalPosition(size_t p_node) const;
+        const FQuat& GetLocalRotation(size_t p_node) const;
+        const FVec3& GetLocalScale(size_t p_node) const;
+
+        /**
+         * @brief Setters of the local transform, the node and its descendants are recomposed by the next Update
+        */
+        void SetLocalPosition(size_t p_node, const FVec3& p_position);
+        void SetLocalRotation(size_t p_node, const FQuat& p_rotation);
+        void SetLocalScale(size_t p_node, const FVec3& p_scale);
+        void SetLocal(size_t p_node, const FVec3& p_position, const FQuat& p_rotation, const FVec3& p_scale);
+
+        /**
+         * @brief Returns true if the node changed since the last Update
+        */
+        bool IsDirty(size_t p_node) const;
+
+        /**
+         * @brief Recomposes the world and inverse world matrices of the dirty nodes and their descendants
+         * @note Starts at the first dirty node and returns at once when nothing changed
+        */
+        void Update();
+
+        /**
+         * @brief Same as Update, each depth is split in chunks run on the threads of p_pool
+         * @note The nodes are grouped by depth on the first call after an Add, worth it from tens of thousands of dirty nodes
+        */
+        void Update(FWorkerPool& p_pool);
+
+        /**
+         * @brief Returns the depth of a node, 0 for a root
+        */
+        size_t GetDepth(size_t p_node) const;
+
+        /**
+         * @brief Returns the world matrix of a node as of the last Update
+        */
+        const FMat4& GetWorld(size_t p_node) const;
+
+        /**
+         * @brief Returns the inverse of the world matrix of a node as of the last Update
+        */
+        const FMat4& GetInverseWorld(size_t p_node) const;
+
+        /**
+         * @brief Returns every world matrix, in node order, for FMat4::PackMatrices or the batch functions
+        */
+        std::span<const FMat4> GetWorlds() const;
+        std::span<const FMat4> GetInverseWorlds() const;
+
+    private:
+        void CheckNode(size_t p_node, const char* p_function) const;
+        void MarkDirty(size_t p_node);
+        void BuildLevels();
+        void UpdateNode(size_t p_node);
+        void EndUpdate();
+
+        std::vector<size_t> m_parents;
+        std::vector<FVec3> m_positions;
+        std::vector<FQuat> m_rotations;
+        std::vector<FVec3> m_scales;
+        std::vector<FMat4> m_worlds;
+        std::vector<FMat4> m_inverseWorlds;
+        std::vector<uint8_t> m_dirty;
+        std::vector<size_t> m_depths;
+        size_t m_firstDirty = NoParent;
+
+        // Nodes sorted by depth, level d is [m_levelStarts[d], m_levelStarts[d + 1]) of m_levelOrder
+        std::vector<size_t> m_levelOrder;
+        std::vector<size_t> m_levelStarts;
+        bool m_levelsValid = false;
+    };
+}
@@ -5,5 +5,12 @@
 #include "Utilities.h"
 #include "Quaternion/Quaternion.h"
 #include "Quaternion/FQuat.hpp"
+#include "Quaternion/FQuatStream.hpp"
+#include "Quaternion/FDualQuat.hpp"
+#include "Quaternion/FQuatCodec.hpp"
+#include "Skinning/FSkinInfluences.hpp"
+#include "Transform/FTransform.hpp"
+#include "Hierarchy/FTransformHierarchy.hpp"
+#include "Threading/FWorkerPool.hpp"
 
 // ...
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+/**
+ * Build options shared by the headers and the library, CMake defines them on
+ * the library target and its users.
+ *
+ * LIBMATHS_INLINE: when set (the default) the FVec2, FVec3, FVec4 and FQuat
+ * functions are defined inline in their headers through their .inl file, so
+ * the compiler can inline them without LTO and code using only these types
+ * does not need the library. When 0 they are compiled once into the library.
+*/
+
+#ifndef LIBMATHS_INLINE
+#define LIBMATHS_INLINE 1
+#endif
+
+#if LIBMATHS_INLINE
+#define LIBMATHS_INLINE_API inline
+#else
+#define LIBMATHS_INLINE_API
+#endif
@@ -3,39 +3,6 @@
 #include "../Mat4/FMat4.hpp"
 using namespace lm;
 
-const FMat3 FMat3::identity = FMat3(1.0f);
-
-FMat3::FMat3(const float p_init)
-{
-	m_matrix[0][0] = p_init;
-	m_matrix[1][1] = p_init;
-	m_matrix[2][2] = p_init;
-}
-
-FMat3::FMat3(float p_00, float p_01, float p_02,
-	float p_10, float p_11, float p_12,
-	float p_20, float p_21, float p_22)
-{
-	m_matrix[0][0] = p_00;
-	m_matrix[0][1] = p_01;
-	m_matrix[0][2] = p_02;
-
-	m_matrix[1][0] = p_10;
-	m_matrix[1][1] = p_11;
-	m_matrix[1][2] = p_12;
-
-	m_matrix[2][0] = p_20;
-	m_matrix[2][1] = p_21;
-	m_matrix[2][2] = p_22;
-}
-
-FMat3::FMat3(const FVec3& p_vec1, const FVec3& p_vec2, const FVec3& p_vec3)
-{
-	m_matrix[0] = p_vec1;
-	m_matrix[1] = p_vec2;
-	m_matrix[2] = p_vec3;
-}
-
 FMat3::FMat3(const FMat4& p_mat4)
 {
 	m_matrix[0] = p_mat4[0];
@@ -52,33 +19,6 @@ FMat3::FMat3(FMat4&& mat4) noexcept
 }
 
 
-FMat3::FMat3(const FMat3& p_mat3)
-{
-	m_matrix[0] = p_mat3.m_matrix[0];
-	m_matrix[1] = p_mat3.m_matrix[1];
-	m_matrix[2] = p_mat3.m_matrix[2];
-}
-
-FMat3& FMat3::operator=(const FMat3& p_mat3)
-{
-	m_matrix[0] = p_mat3.m_matrix[0];
-	m_matrix[1] = p_mat3.m_matrix[1];
-	m_matrix[2] = p_mat3.m_matrix[2];
-
-	return *this;
-}
-
-FVec3& FMat3::operator[](const unsigned int p_index)
-{
-	return m_matrix[p_index];
-}
-
-const FVec3& FMat3::operator[](const unsigned int p_index) const
-{
-	return m_matrix[p_index];
-}
-
-
 FMat3 FMat3::operator+(const FMat3& p_mat3) const
 {
 	return FMat3::Add(*this, p_mat3);
@@ -169,11 +109,6 @@ bool FMat3::operator!=(const FMat3& p_mat3) const
 	return !(*this == p_mat3);
 }
 
-FMat3 FMat3::Identity()
-{
-	return FMat3(FVec3(1.0f, 0.0f, 0.0f), FVec3(0.0f, 1.0f, 0.0f), FVec3(0.0f, 0.0f, 1.0f));
-}
-
 FMat3 FMat3::Transpose(const FMat3& mat3)
 {
 	return FMat3(FVec3(mat3[0][0], mat3[1][0], mat3[2][0]), FVec3(mat3[0][1], mat3[1][1], mat3[2][1]), FVec3(mat3[0][2], mat3[1][2], mat3[2][2]));
@@ -221,8 +156,8 @@ FMat3 FMat3::Rotation(float p_angle, const FVec3& p_axis)
 	const float Rx2 = Rx * Rx;
 	const float Ry2 = Ry * Ry;
 	const float Rz2 = Rz * Rz;
-	const float cosTheta = std::cosf(RadAngle);
-	const float sinTheta = std::sinf(RadAngle);
+	const float cosTheta = std::cos(RadAngle);
+	const float sinTheta = std::sin(RadAngle);
 
 	result[0] = FVec3(cosTheta + Rx2 * (1 - cosTheta), Rx * Ry * (1 - cosTheta) - Rz * sinTheta, Rx * Rz * (1 - cosTheta) + Ry * sinTheta);
 	result[1] = FVec3(Ry * Rx * (1 - cosTheta) + Rz * sinTheta, cosTheta + Ry2 * (1 - cosTheta), Ry * Rz * (1 - cosTheta) - Rx * sinTheta);
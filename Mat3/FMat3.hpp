@@ -1,6 +1,7 @@
 #pragma once
 
 #include <iostream>
+#include <span>
 
 #include "../Utilities.h"
 #include "../Vec3/FVec3.hpp"
@@ -16,22 +17,34 @@ namespace lm
 		static const FMat3 identity;
 
 		FMat3() = default;
-		FMat3(const float init);
-		FMat3(float p_00, float p_01, float p_02, float p_10, float p_11,
+		constexpr FMat3(const float init);
+		constexpr FMat3(float p_00, float p_01, float p_02, float p_10, float p_11,
 			float p_12, float p_20, float p_21, float p_22);
-		FMat3(const FVec3& v1, const FVec3& v2, const FVec3& v3);
+		constexpr FMat3(const FVec3& v1, const FVec3& v2, const FVec3& v3);
 
-		FMat3(const FMat3& mat3);
+		constexpr FMat3(const FMat3& mat3) = default;
 		FMat3(FMat3&& mat3) noexcept = default;
 		FMat3(const FMat4& mat4);
 		FMat3(FMat4&& mat4) noexcept;
 
 		~FMat3() = default;
 
-		FMat3& operator=(const FMat3& mat3);
+		constexpr FMat3& operator=(const FMat3& mat3) = default;
 		FMat3& operator=(FMat3&& mat3) noexcept = default;
-		FVec3& operator[](const unsigned int index);
-		const FVec3& operator[](const unsigned int index) const;
+		constexpr FVec3& operator[](const unsigned int index);
+		constexpr const FVec3& operator[](const unsigned int index) const;
+
+		/**
+		 * @brief Returns the 9 floats of the matrix, row after row, without copying them
+		*/
+		float* Data() { return &m_matrix[0].x; }
+		const float* Data() const { return &m_matrix[0].x; }
+
+		/**
+		 * @brief Returns a view of the 9 floats of the matrix, in the order of Data()
+		*/
+		std::span<float, 9> AsSpan() { return std::span<float, 9>(Data(), 9); }
+		std::span<const float, 9> AsSpan() const { return std::span<const float, 9>(Data(), 9); }
 
 
 		FMat3 operator+(const FMat3& mat3) const;
@@ -53,7 +66,7 @@ namespace lm
 		 * @return FMat3
 		 * @note The identity matrix is a square matrix with ones on the main diagonal and zeros elsewhere.
 		*/
-		static FMat3 Identity();
+		static constexpr FMat3 Identity();
 
 		/**
 		 * @brief Returns the transpose of the given matrix
@@ -183,8 +196,9 @@ namespace lm
 /**
 		 * @brief Returns the array of the given matrix
 		 * @param mat3 Matrix to convert to array
-		 * @return float* Array of the given matrix
+		 * @return float* Array of the given matrix, allocated with new[] and owned by the caller
 		*/
+		[[deprecated("allocates on every call, use Data() or AsSpan()")]]
 		static float* ToArray(const FMat3& mat3);
 
 	};
@@ -197,4 +211,43 @@ namespace lm
 
 	FMat3 operator*(const FMat3& p_mat, const FVec3& p_vec);
 	FMat3 operator*(const FVec3& vec3, const FMat3& mat3);
-}
\ No newline at end of file
+
+	static_assert(sizeof(FMat3) == 9 * sizeof(float), "FMat3 must be 9 contiguous floats");
+}
+
+namespace lm
+{
+	constexpr FMat3::FMat3(const float p_init) :
+		m_matrix{ FVec3(p_init, 0.0f, 0.0f), FVec3(0.0f, p_init, 0.0f), FVec3(0.0f, 0.0f, p_init) }
+	{
+	}
+
+	constexpr FMat3::FMat3(float p_00, float p_01, float p_02,
+		float p_10, float p_11, float p_12,
+		float p_20, float p_21, float p_22) :
+		m_matrix{ FVec3(p_00, p_01, p_02), FVec3(p_10, p_11, p_12), FVec3(p_20, p_21, p_22) }
+	{
+	}
+
+	constexpr FMat3::FMat3(const FVec3& p_vec1, const FVec3& p_vec2, const FVec3& p_vec3) :
+		m_matrix{ p_vec1, p_vec2, p_vec3 }
+	{
+	}
+
+	inline constexpr FMat3 FMat3::identity = FMat3(1.0f);
+
+	constexpr FVec3& FMat3::operator[](const unsigned int p_index)
+	{
+		return m_matrix[p_index];
+	}
+
+	constexpr const FVec3& FMat3::operator[](const unsigned int p_index) const
+	{
+		return m_matrix[p_index];
+	}
+
+	constexpr FMat3 FMat3::Identity()
+	{
+		return FMat3(FVec3(1.0f, 0.0f, 0.0f), FVec3(0.0f, 1.0f, 0.0f), FVec3(0.0f, 0.0f, 1.0f));
+	}
+}
@@ -2,51 +2,16 @@
 #include "../Vec3/FVec3.hpp"
 #include "../Quaternion/FQuat.hpp"
 #include "../Mat3/FMat3.hpp"
-using namespace lm;
-
-const FMat4 FMat4::IdentityMatrix(1.0f);
-
-FMat4::FMat4(float p_init)
-{
-    m_matrix[0] = FVec4(p_init, 0, 0, 0);
-    m_matrix[1] = FVec4(0, p_init, 0, 0);
-    m_matrix[2] = FVec4(0, 0, p_init, 0);
-    m_matrix[3] = FVec4(0, 0, 0, p_init);
-}
-
-FMat4::FMat4(float p_00, float p_01, float p_02, float p_03,
-    float p_10, float p_11, float p_12, float p_13,
-    float p_20, float p_21, float p_22, float p_23,
-    float p_30, float p_31, float p_32, float p_33)
-{
-    m_matrix[0][0] = p_00;
-    m_matrix[0][1] = p_01;
-    m_matrix[0][2] = p_02;
-    m_matrix[0][3] = p_03;
+#include "../Vec3/FVec3Stream.hpp"
+#include "../Quaternion/FQuatStream.hpp"
+#include "../SIMD/Mat4Kernels.h"
+#include "../SIMD/Dispatch.hpp"
 
-    m_matrix[1][0] = p_10;
-    m_matrix[1][1] = p_11;
-    m_matrix[1][2] = p_12;
-    m_matrix[1][3] = p_13;
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
 
-    m_matrix[2][0] = p_20;
-    m_matrix[2][1] = p_21;
-    m_matrix[2][2] = p_22;
-    m_matrix[2][3] = p_23;
-
-    m_matrix[3][0] = p_30;
-    m_matrix[3][1] = p_31;
-    m_matrix[3][2] = p_32;
-    m_matrix[3][3] = p_33;
-}
-
-FMat4::FMat4(FVec4 p_row1, FVec4 p_row2, FVec4 p_row3, FVec4 p_row4)
-{
-    m_matrix[0] = p_row1;
-    m_matrix[1] = p_row2;
-    m_matrix[2] = p_row3;
-    m_matrix[3] = p_row4;
-}
+using namespace lm;
 
 FMat4::FMat4(const FVec3& p_position, const FQuat& p_rotation)
 {
@@ -55,17 +20,6 @@ FMat4::FMat4(const FVec3& p_position, const FQuat& p_rotation)
     *this = result;
 }
 
-FMat4::FMat4(const FMat4& p_toCopy)
-{
-    for (int i = 0; i < 4; i++)
-    {
-        for (int j = 0; j < 4; j++)
-        {
-            m_matrix[i][j] = p_toCopy.m_matrix[i][j];
-        }
-    }
-}
-
 lm::FMat4::FMat4(const FMat3& p_toCopy)
 {
     m_matrix[0] = FVec4(p_toCopy.m_matrix[0], 0);
@@ -83,131 +37,30 @@ FMat4& lm::FMat4::operator=(const FMat3& p_other)
     return *this;
 }
 
-FMat4& FMat4::operator=(const FMat4& p_other)
-{
-    for (int i = 0; i < 4; i++)
-    {
-        for (int j = 0; j < 4; j++)
-        {
-            m_matrix[i][j] = p_other.m_matrix[i][j];
-        }
-    }
-    return *this;
-}
-
 FMat4 FMat4::operator*(const FMat4& p_other) const
 {
-    const FVec4 SrcA00 = m_matrix[0];
-    const FVec4 SrcA10 = m_matrix[1];
-    const FVec4 SrcA20 = m_matrix[2];
-    const FVec4 SrcA30 = m_matrix[3];
-
-    const FVec4 SrcB00 = p_other.m_matrix[0];
-    const FVec4 SrcB10 = p_other.m_matrix[1];
-    const FVec4 SrcB20 = p_other.m_matrix[2];
-    const FVec4 SrcB30 = p_other.m_matrix[3];
-
     FMat4 result;
-    result.m_matrix[0] = SrcA00 * SrcB00[0] + SrcA10 * SrcB00[1] + SrcA20 * SrcB00[2] + SrcA30 * SrcB00[3];
-    result.m_matrix[1] = SrcA00 * SrcB10[0] + SrcA10 * SrcB10[1] + SrcA20 * SrcB10[2] + SrcA30 * SrcB10[3];
-    result.m_matrix[2] = SrcA00 * SrcB20[0] + SrcA10 * SrcB20[1] + SrcA20 * SrcB20[2] + SrcA30 * SrcB20[3];
-    result.m_matrix[3] = SrcA00 * SrcB30[0] + SrcA10 * SrcB30[1] + SrcA20 * SrcB30[2] + SrcA30 * SrcB30[3];
+    simd::Mat4Multiply(*this, p_other, result);
     return result;
 }
 
 FMat4& FMat4::operator*=(const FMat4& p_other)
 {
-    *this = *this * p_other;
+    simd::Mat4Multiply(*this, p_other, *this);
     return *this;
 }
 
 FVec4 FMat4::operator*(const FVec4& p_other) const
 {
-    FVec4 result = {
-        m_matrix[0].x * p_other.x + m_matrix[1].x * p_other.y + m_matrix[2].x * p_other.z + m_matrix[3].x,
-        m_matrix[0].y * p_other.x + m_matrix[1].y * p_other.y + m_matrix[2].y * p_other.z + m_matrix[3].y,
-        m_matrix[0].z * p_other.x + m_matrix[1].z * p_other.y + m_matrix[2].z * p_other.z + m_matrix[3].z,
-        m_matrix[0].w * p_other.x + m_matrix[1].w * p_other.y + m_matrix[2].w * p_other.z + m_matrix[3].w
-    };
-    return result;
+    return m_matrix[0] * p_other.x + m_matrix[1] * p_other.y + m_matrix[2] * p_other.z + m_matrix[3];
 }
 
 FVec3 FMat4::operator*(const FVec3& p_other) const
 {
-    FVec4 v = { p_other.x, p_other.y, p_other.z, 1.0f };
-    FVec4 result = {
-        m_matrix[0].x * v.x + m_matrix[1].x * v.y + m_matrix[2].x * v.z + m_matrix[3].x,
-        m_matrix[0].y * v.x + m_matrix[1].y * v.y + m_matrix[2].y * v.z + m_matrix[3].y,
-        m_matrix[0].z * v.x + m_matrix[1].z * v.y + m_matrix[2].z * v.z + m_matrix[3].z,
-        m_matrix[0].w * v.x + m_matrix[1].w * v.y + m_matrix[2].w * v.z + m_matrix[3].w
-    };
+    FVec4 result = m_matrix[0] * p_other.x + m_matrix[1] * p_other.y + m_matrix[2] * p_other.z + m_matrix[3];
     return FVec3{ result.x / result.w, result.y / result.w, result.z / result.w };
 }
 
-FMat4 FMat4::operator*(float p_scalar) const
-{
-    FMat4 result;
-    for (int i = 0; i < 4; i++)
-    {
-        for (int j = 0; j < 4; j++)
-        {
-            result.m_matrix[i][j] = m_matrix[i][j] * p_scalar;
-        }
-    }
-    return result;
-}
-
-FMat4 FMat4::operator+(const FMat4& p_other) const
-{
-    FMat4 result;
-    for (int i = 0; i < 4; i++)
-    {
-        for (int j = 0; j < 4; j++)
-        {
-            result.m_matrix[i][j] = m_matrix[i][j] + p_other.m_matrix[i][j];
-        }
-    }
-    return result;
-}
-
-FMat4& FMat4::operator+=(const FMat4& p_other)
-{
-    *this = *this + p_other;
-    return *this;
-}
-
-FMat4 FMat4::operator-(const FMat4& p_other) const
-{
-    FMat4 result;
-    for (int i = 0; i < 4; i++)
-    {
-        for (int j = 0; j < 4; j++)
-        {
-            result.m_matrix[i][j] = m_matrix[i][j] - p_other.m_matrix[i][j];
-        }
-    }
-    return result;
-}
-
-FMat4& FMat4::operator-=(const FMat4& p_other)
-{
-    *this = *this - p_other;
-    return *this;
-}
-
-FMat4 FMat4::operator-() const
-{
-    FMat4 result;
-    for (int i = 0; i < 4; i++)
-    {
-        for (int j = 0; j < 4; j++)
-        {
-            result.m_matrix[i][j] = -m_matrix[i][j];
-        }
-    }
-    return result;
-}
-
 bool lm::FMat4::IsOrthogonal() const
 {
     FMat4 transpose{ 0 };
@@ -245,6 +98,11 @@ bool lm::FMat4::IsOrthogonal() const
     return true;
 }
 
+bool lm::FMat4::IsAffine() const
+{
+    return m_matrix[0].w == 0.0f && m_matrix[1].w == 0.0f && m_matrix[2].w == 0.0f && m_matrix[3].w == 1.0f;
+}
+
 FMat4 lm::FMat4::InverseOrtho(const FMat4& p_matrix)
 {
     if (!p_matrix.IsOrthogonal())
@@ -257,12 +115,10 @@ FMat4 lm::FMat4::InverseOrtho(const FMat4& p_matrix)
 FMat4 FMat4::operator/(float p_scalar) const
 {
     FMat4 result;
+    const FVec4 divisor(p_scalar);
     for (int i = 0; i < 4; i++)
     {
-        for (int j = 0; j < 4; j++)
-        {
-            result.m_matrix[i][j] = m_matrix[i][j] / p_scalar;
-        }
+        result.m_matrix[i] = m_matrix[i] / divisor;
     }
     return result;
 }
@@ -277,12 +133,9 @@ bool FMat4::operator==(const FMat4& p_other) const
 {
     for (int i = 0; i < 4; i++)
     {
-        for (int j = 0; j < 4; j++)
+        if (m_matrix[i] != p_other.m_matrix[i])
         {
-            if (m_matrix[i][j] != p_other.m_matrix[i][j])
-            {
-                return false;
-            }
+            return false;
         }
     }
     return true;
@@ -293,47 +146,18 @@ bool FMat4::operator!=(const FMat4& p_other) const
     return !(*this == p_other);
 }
 
-FVec4& FMat4::operator[](int p_index)
-{
-    return m_matrix[p_index];
-}
-
-const FVec4& FMat4::operator[](int p_index) const
-{
-    return m_matrix[p_index];
-}
-
-FMat4 FMat4::Identity()
-{
-    FMat4 result;
-    for (int i = 0; i < 4; i++)
-    {
-        result.m_matrix[i][i] = 1.0f;
-    }
-    return result;
-}
-
-FMat4 FMat4::Translation(const FVec3& p_translation)
-{
-    FMat4 result = FMat4::Identity();
-    result[3][0] = p_translation.x;
-    result[3][1] = p_translation.y;
-    result[3][2] = p_translation.z;
-    return result;
-}
-
 FMat4 FMat4::RotationEuler(const FVec3& p_rotation)
 {
     const float yaw = p_rotation.x;
     const float pitch = p_rotation.y;
     const float roll = p_rotation.z;
 
-    const float cosYaw = std::cosf(-yaw);
-    const float sinYaw = std::sinf(-yaw);
-    const float cosPitch = std::cosf(-pitch);
-    const float sinPitch = std::sinf(-pitch);
-    const float cosRoll = std::cosf(-roll);
-    const float sinRoll = std::sinf(-roll);
+    const float cosYaw = std::cos(-yaw);
+    const float sinYaw = std::sin(-yaw);
+    const float cosPitch = std::cos(-pitch);
+    const float sinPitch = std::sin(-pitch);
+    const float cosRoll = std::cos(-roll);
+    const float sinRoll = std::sin(-roll);
 
     FMat4 Result = FMat4::Identity();
     Result[0][0] = cosPitch * cosRoll;
@@ -351,15 +175,6 @@ FMat4 FMat4::RotationEuler(const FVec3& p_rotation)
     return Result;
 }
 
-FMat4 FMat4::Scale(const FVec3& p_scale)
-{
-    FMat4 result = FMat4::Identity();
-    result[0][0] = p_scale.x;
-    result[1][1] = p_scale.y;
-    result[2][2] = p_scale.z;
-    return result;
-}
-
 FMat4 FMat4::LookAt(const FVec3& p_eye, const FVec3& p_target, const FVec3& p_up)
 {
     FVec3 const f(FVec3::Normalize(p_target - p_eye));
@@ -430,14 +245,8 @@ FMat4 FMat4::Orthographic(float p_left, float p_right, float p_bottom, float p_t
 
 FMat4 FMat4::Transpose(const FMat4& p_matrix)
 {
-    FMat4 result = FMat4::Identity();
-    for (int i = 0; i < 4; i++)
-    {
-        for (int j = 0; j < 4; j++)
-        {
-            result.m_matrix[i][j] = p_matrix.m_matrix[j][i];
-        }
-    }
+    FMat4 result;
+    simd::Mat4Transpose(p_matrix, result.Data());
     return result;
 }
 
@@ -497,36 +306,74 @@ FMat4 FMat4::Scale(const FMat4& p_matrix, const FVec3& p_scale)
 
 FMat4 FMat4::Multiply(const FMat4& p_matrix1, const FMat4& p_matrix2)
 {
-    FMat4 result = FMat4::Identity();
-    for (int i = 0; i < 4; i++)
+    // Row by row product, which is the row combination of p_matrix2 weighted by p_matrix1
+    FMat4 result;
+    simd::Mat4Multiply(p_matrix2, p_matrix1, result);
+    return result;
+}
+
+void FMat4::MultiplyBatch(std::span<const FMat4> p_left, std::span<const FMat4> p_right, std::span<FMat4> p_result)
+{
+    if (p_left.size() != p_right.size() || p_left.size() != p_result.size())
     {
-        for (int j = 0; j < 4; j++)
-        {
-            result.m_matrix[i][j] = p_matrix1.m_matrix[i][0] * p_matrix2.m_matrix[0][j] +
-                p_matrix1.m_matrix[i][1] * p_matrix2.m_matrix[1][j] +
-                p_matrix1.m_matrix[i][2] * p_matrix2.m_matrix[2][j] +
-                p_matrix1.m_matrix[i][3] * p_matrix2.m_matrix[3][j];
-        }
+        throw std::logic_error("FMat4::MultiplyBatch: spans must have the same size");
     }
-    return result;
+
+    simd::Kernels().mat4MultiplyBatch(p_left.data(), p_right.data(), p_result.data(), p_result.size());
+}
+
+void FMat4::PackMatrices(std::span<const FMat4> p_matrices, float* p_destination, EMatrixLayout p_layout)
+{
+    if (p_layout == EMatrixLayout::Native)
+    {
+        if (!p_matrices.empty())
+            std::memcpy(p_destination, p_matrices.data(), p_matrices.size_bytes());
+
+        return;
+    }
+
+    for (size_t i = 0; i < p_matrices.size(); i++)
+        simd::Mat4Transpose(p_matrices[i], p_destination + i * 16);
 }
 
 FMat4 FMat4::Transform(const FVec3& p_translation, const FVec3& p_rotation, const FVec3& p_scale)
 {
-    FMat4 result = FMat4::Identity();
+    const float cosX = cosf(TO_RADIANS(p_rotation.x));
+    const float sinX = sinf(TO_RADIANS(p_rotation.x));
+    const float cosY = cosf(TO_RADIANS(p_rotation.y));
+    const float sinY = sinf(TO_RADIANS(p_rotation.y));
+    const float cosZ = cosf(TO_RADIANS(p_rotation.z));
+    const float sinZ = sinf(TO_RADIANS(p_rotation.z));
 
-    result = FMat4::Translation(p_translation) * ZRotation(p_rotation.z) * XRotation(p_rotation.x) * YRotation(p_rotation.y) * FMat4::Scale(result, p_scale);
-    return result;
+    // Rows of ZRotation * XRotation * YRotation, each scaled by its component of p_scale
+    return FMat4(
+        FVec4((cosZ * cosY - sinZ * sinX * sinY) * p_scale.x, (sinZ * cosY + cosZ * sinX * sinY) * p_scale.x, -cosX * sinY * p_scale.x, 0.0f),
+        FVec4(-sinZ * cosX * p_scale.y, cosZ * cosX * p_scale.y, sinX * p_scale.y, 0.0f),
+        FVec4((cosZ * sinY + sinZ * sinX * cosY) * p_scale.z, (sinZ * sinY - cosZ * sinX * cosY) * p_scale.z, cosX * cosY * p_scale.z, 0.0f),
+        FVec4(p_translation, 1.0f));
 }
 
 FMat4 FMat4::Transform(const FVec3& p_translation, const FQuat& p_rotation, const FVec3& p_scale)
 {
-    FMat4 result = FMat4::Identity();
-
-    result = FMat4::Translation(p_translation) * FQuat::ToRotateMat3(p_rotation) * FMat4::Scale(result, p_scale);
+    FMat4 result;
+    simd::Mat4TRS(p_translation.x, p_translation.y, p_translation.z, p_rotation.x, p_rotation.y, p_rotation.z, p_rotation.w,
+        p_scale.x, p_scale.y, p_scale.z, result);
     return result;
 }
 
+void lm::FMat4::TransformBatch(const FVec3Stream& p_translations, const FQuatStream& p_rotations, const FVec3Stream& p_scales, std::span<FMat4> p_result)
+{
+    if (p_translations.Size() != p_result.size() || p_rotations.Size() != p_result.size() || p_scales.Size() != p_result.size())
+    {
+        throw std::logic_error("FMat4::TransformBatch: streams and result must have the same size");
+    }
+
+    const float* const translations[] = { p_translations.X(), p_translations.Y(), p_translations.Z() };
+    const float* const rotations[] = { p_rotations.X(), p_rotations.Y(), p_rotations.Z(), p_rotations.W() };
+    const float* const scales[] = { p_scales.X(), p_scales.Y(), p_scales.Z() };
+    simd::Kernels().mat4TRSBatch(translations, rotations, scales, p_result.data(), p_result.size());
+}
+
 FMat4 FMat4::XRotation(float p_angle)
 {
     float radAngle = TO_RADIANS(p_angle);
@@ -693,60 +540,129 @@ void lm::FMat4::Decompose(const FMat4 &p_mat,  FVec3 &p_position,  FVec3 &p_rota
 
 FMat4 lm::FMat4::Inverse(const FMat4& p_matrix)
 {
-    float Coef00 = p_matrix[2][2] * p_matrix[3][3] - p_matrix[3][2] * p_matrix[2][3];
-    float Coef02 = p_matrix[1][2] * p_matrix[3][3] - p_matrix[3][2] * p_matrix[1][3];
-    float Coef03 = p_matrix[1][2] * p_matrix[2][3] - p_matrix[2][2] * p_matrix[1][3];
+    FMat4 result;
+    simd::Mat4Inverse(p_matrix, result);
+    return result;
+}
+
+EMatrixKind lm::FMat4::Classify(const FMat4& p_matrix, float p_epsilon)
+{
+    if (!p_matrix.IsAffine())
+    {
+        return EMatrixKind::General;
+    }
 
-    float Coef04 = p_matrix[2][1] * p_matrix[3][3] - p_matrix[3][1] * p_matrix[2][3];
-    float Coef06 = p_matrix[1][1] * p_matrix[3][3] - p_matrix[3][1] * p_matrix[1][3];
-    float Coef07 = p_matrix[1][1] * p_matrix[2][3] - p_matrix[2][1] * p_matrix[1][3];
+    const FVec3 column0(p_matrix[0].x, p_matrix[0].y, p_matrix[0].z);
+    const FVec3 column1(p_matrix[1].x, p_matrix[1].y, p_matrix[1].z);
+    const FVec3 column2(p_matrix[2].x, p_matrix[2].y, p_matrix[2].z);
 
-    float Coef08 = p_matrix[2][1] * p_matrix[3][2] - p_matrix[3][1] * p_matrix[2][2];
-    float Coef10 = p_matrix[1][1] * p_matrix[3][2] - p_matrix[3][1] * p_matrix[1][2];
-    float Coef11 = p_matrix[1][1] * p_matrix[2][2] - p_matrix[2][1] * p_matrix[1][2];
+    const bool orthonormal =
+        std::abs(FVec3::Dot(column0, column0) - 1.0f) <= p_epsilon &&
+        std::abs(FVec3::Dot(column1, column1) - 1.0f) <= p_epsilon &&
+        std::abs(FVec3::Dot(column2, column2) - 1.0f) <= p_epsilon &&
+        std::abs(FVec3::Dot(column0, column1)) <= p_epsilon &&
+        std::abs(FVec3::Dot(column0, column2)) <= p_epsilon &&
+        std::abs(FVec3::Dot(column1, column2)) <= p_epsilon;
 
-    float Coef12 = p_matrix[2][0] * p_matrix[3][3] - p_matrix[3][0] * p_matrix[2][3];
-    float Coef14 = p_matrix[1][0] * p_matrix[3][3] - p_matrix[3][0] * p_matrix[1][3];
-    float Coef15 = p_matrix[1][0] * p_matrix[2][3] - p_matrix[2][0] * p_matrix[1][3];
+    return orthonormal ? EMatrixKind::Rigid : EMatrixKind::Affine;
+}
 
-    float Coef16 = p_matrix[2][0] * p_matrix[3][2] - p_matrix[3][0] * p_matrix[2][2];
-    float Coef18 = p_matrix[1][0] * p_matrix[3][2] - p_matrix[3][0] * p_matrix[1][2];
-    float Coef19 = p_matrix[1][0] * p_matrix[2][2] - p_matrix[2][0] * p_matrix[1][2];
+FMat4 lm::FMat4::InverseFast(const FMat4& p_matrix)
+{
+    return InverseFast(p_matrix, Classify(p_matrix));
+}
 
-    float Coef20 = p_matrix[2][0] * p_matrix[3][1] - p_matrix[3][0] * p_matrix[2][1];
-    float Coef22 = p_matrix[1][0] * p_matrix[3][1] - p_matrix[3][0] * p_matrix[1][1];
-    float Coef23 = p_matrix[1][0] * p_matrix[2][1] - p_matrix[2][0] * p_matrix[1][1];
+FMat4 lm::FMat4::InverseFast(const FMat4& p_matrix, EMatrixKind p_kind)
+{
+    assert(Classify(p_matrix, 1e-3f) >= p_kind && "FMat4::InverseFast: p_matrix is less specific than p_kind");
 
-    FVec4 Fac0(Coef00, Coef00, Coef02, Coef03);
-    FVec4 Fac1(Coef04, Coef04, Coef06, Coef07);
-    FVec4 FacosPitch(Coef08, Coef08, Coef10, Coef11);
-    FVec4 Fac3(Coef12, Coef12, Coef14, Coef15);
-    FVec4 Fac4(Coef16, Coef16, Coef18, Coef19);
-    FVec4 Fac5(Coef20, Coef20, Coef22, Coef23);
+    FMat4 result;
 
-    FVec4 Vec0(p_matrix[1][0], p_matrix[0][0], p_matrix[0][0], p_matrix[0][0]);
-    FVec4 Vec1(p_matrix[1][1], p_matrix[0][1], p_matrix[0][1], p_matrix[0][1]);
-    FVec4 VecosPitch(p_matrix[1][2], p_matrix[0][2], p_matrix[0][2], p_matrix[0][2]);
-    FVec4 Vec3(p_matrix[1][3], p_matrix[0][3], p_matrix[0][3], p_matrix[0][3]);
+    switch (p_kind)
+    {
+    case EMatrixKind::Rigid:
+        simd::Mat4InverseRigid(p_matrix, result);
+        break;
+    case EMatrixKind::Affine:
+        simd::Mat4InverseAffine(p_matrix, result);
+        break;
+    default:
+        simd::Mat4Inverse(p_matrix, result);
+        break;
+    }
 
-    FVec4 Inv0(Vec1 * Fac0 - VecosPitch * Fac1 + Vec3 * FacosPitch);
-    FVec4 Inv1(Vec0 * Fac0 - VecosPitch * Fac3 + Vec3 * Fac4);
-    FVec4 Inv2(Vec0 * Fac1 - Vec1 * Fac3 + Vec3 * Fac5);
-    FVec4 Inv3(Vec0 * FacosPitch - Vec1 * Fac4 + VecosPitch * Fac5);
+    return result;
+}
 
-    FVec4 SignA(+1, -1, +1, -1);
-    FVec4 SignB(-1, +1, -1, +1);
+FMat4 lm::FMat4::InverseAffine(const FMat4& p_matrix)
+{
+    assert(p_matrix.IsAffine() && "FMat4::InverseAffine: p_matrix is not affine");
 
-    FMat4 Inverse(Inv0 * SignA, Inv1 * SignB, Inv2 * SignA, Inv3 * SignB);
+    FMat4 result;
+    simd::Mat4InverseAffine(p_matrix, result);
+    return result;
+}
 
-    FVec4 Row0(Inverse[0][0], Inverse[1][0], Inverse[2][0], Inverse[3][0]);
+FMat4 lm::FMat4::InverseRigid(const FMat4& p_matrix)
+{
+    assert(Classify(p_matrix, 1e-3f) == EMatrixKind::Rigid && "FMat4::InverseRigid: p_matrix is not rigid");
 
-    FVec4 Dot0(p_matrix[0] * Row0);
-    float Dot1 = (Dot0.x + Dot0.y) + (Dot0.z + Dot0.w);
+    FMat4 result;
+    simd::Mat4InverseRigid(p_matrix, result);
+    return result;
+}
 
-    float OneOverDeterminant = 1.0f / Dot1;
+void lm::FMat4::InverseBatch(std::span<const FMat4> p_matrices, std::span<FMat4> p_result)
+{
+    if (p_matrices.size() != p_result.size())
+    {
+        throw std::logic_error("FMat4::InverseBatch: spans must have the same size");
+    }
 
-    return Inverse * OneOverDeterminant;
+    simd::Kernels().mat4InverseBatch(p_matrices.data(), p_result.data(), p_result.size());
+}
+
+void lm::FMat4::TransformPoints(const FMat4& p_matrix, std::span<const FVec3> p_points, std::span<FVec3> p_result)
+{
+    if (p_points.size() != p_result.size())
+    {
+        throw std::logic_error("FMat4::TransformPoints: spans must have the same size");
+    }
+
+    if (p_matrix.IsAffine())
+        simd::Kernels().mat4TransformPoints(p_matrix, p_points.data(), p_result.data(), p_result.size());
+    else
+        simd::Kernels().mat4TransformPointsDivide(p_matrix, p_points.data(), p_result.data(), p_result.size());
+}
+
+void lm::FMat4::TransformDirections(const FMat4& p_matrix, std::span<const FVec3> p_directions, std::span<FVec3> p_result)
+{
+    if (p_directions.size() != p_result.size())
+    {
+        throw std::logic_error("FMat4::TransformDirections: spans must have the same size");
+    }
+
+    simd::Kernels().mat4TransformDirections(p_matrix, p_directions.data(), p_result.data(), p_result.size());
+}
+
+void lm::FMat4::TransformPointsProjective(const FMat4& p_matrix, std::span<const FVec3> p_points, std::span<FVec4> p_result)
+{
+    if (p_points.size() != p_result.size())
+    {
+        throw std::logic_error("FMat4::TransformPointsProjective: spans must have the same size");
+    }
+
+    simd::Kernels().mat4TransformPointsHomogeneous(p_matrix, p_points.data(), p_result.data(), p_result.size());
+}
+
+void lm::FMat4::TransformPointsProjective(const FMat4& p_matrix, std::span<const FVec4> p_vectors, std::span<FVec4> p_result)
+{
+    if (p_vectors.size() != p_result.size())
+    {
+        throw std::logic_error("FMat4::TransformPointsProjective: spans must have the same size");
+    }
+
+    simd::Kernels().mat4TransformVectors(p_matrix, p_vectors.data(), p_result.data(), p_result.size());
 }
 
 std::ostream& lm::operator<<(std::ostream& p_stream, const FMat4& p_matrix)
@@ -779,28 +695,6 @@ std::istream& lm::operator>>(std::istream& p_stream, FMat4& p_matrix)
     return p_stream;
 }
 
-FMat4 lm::operator*(float p_scalar, const FMat4& p_matrix)
-{
-    FMat4 result = p_matrix;
-    result[0][0] *= p_scalar;
-    result[0][1] *= p_scalar;
-    result[0][2] *= p_scalar;
-    result[0][3] *= p_scalar;
-    result[1][0] *= p_scalar;
-    result[1][1] *= p_scalar;
-    result[1][2] *= p_scalar;
-    result[1][3] *= p_scalar;
-    result[2][0] *= p_scalar;
-    result[2][1] *= p_scalar;
-    result[2][2] *= p_scalar;
-    result[2][3] *= p_scalar;
-    result[3][0] *= p_scalar;
-    result[3][1] *= p_scalar;
-    result[3][2] *= p_scalar;
-    result[3][3] *= p_scalar;
-    return result;
-}
-
 FMat4 lm::operator/(float p_scalar, const FMat4& p_matrix)
 {
     FMat4 result = p_matrix;
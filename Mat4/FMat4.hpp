@@ -1,17 +1,43 @@
 #pragma once
 
 #include <iostream>
+#include <span>
 
 #include "../Utilities.h"
+#include "../Vec3/FVec3.hpp"
 #include "../Vec4/FVec4.hpp"
 
 namespace lm
 {
-    struct FVec3;
     struct FQuat;
     struct FMat3;
+    struct FVec3Stream;
+    struct FQuatStream;
+    struct FSkinInfluences;
+    struct FWorkerPool;
+
+    /**
+     * @brief Order of the floats written by FMat4::PackMatrices
+    */
+    enum class EMatrixLayout
+    {
+        Native,     // The order of FMat4::Data(): row after row, each row a FVec4 (what GLM and OpenGL expect)
+        Transposed  // Each matrix transposed, element [i][j] of the matrix is written at j * 4 + i
+    };
+
+    /**
+     * @brief Structure of a matrix, from the least to the most specific, see FMat4::Classify
+    */
+    enum class EMatrixKind
+    {
+        General,    // Any invertible matrix
+        Affine,     // Last column (0, 0, 0, 1): a linear part and a translation
+        Rigid       // Affine with an orthonormal linear part: a rotation, possibly mirrored, and a translation
+    };
+
     /**
      * @brief A 4x4 matrix made of 4 FVec4 rows
+     * @note The 16 floats are contiguous and FMat4 arrays have no padding, see Data()
     */
     struct FMat4
     {
@@ -24,7 +50,7 @@ namespace lm
         */
         FMat4() = default;
 
-        FMat4(float p_00, float p_01, float p_02, float p_03,
+        constexpr FMat4(float p_00, float p_01, float p_02, float p_03,
             float p_10, float p_11, float p_12, float p_13,
             float p_20, float p_21, float p_22, float p_23,
             float p_30, float p_31, float p_32, float p_33);
@@ -34,7 +60,7 @@ namespace lm
          * @param p_init The value to set the diagonal to
          * @note The other values are set to 0
         */
-        FMat4(float p_init);
+        constexpr FMat4(float p_init);
 
         /**
          * @brief Creates a new matrix with the given values
@@ -43,7 +69,7 @@ namespace lm
          * @param p_row3 The third row
          * @param p_row4 The fourth row
         */
-        FMat4(FVec4 p_row1, FVec4 p_row2, FVec4 p_row3, FVec4 p_row4);
+        constexpr FMat4(FVec4 p_row1, FVec4 p_row2, FVec4 p_row3, FVec4 p_row4);
 
         FMat4(const FVec3& p_position, const FQuat& p_rotation);
 
@@ -51,46 +77,64 @@ namespace lm
          * @brief Creates a new matrix by copying the values from another matrix
          * @param p_toCopy The matrix to copy the values from
         */
-        FMat4(const FMat4& p_toCopy);
+        constexpr FMat4(const FMat4& p_toCopy) = default;
         FMat4(FMat4&& p_toMove) noexcept = default;
         FMat4(const FMat3& p_toCopy);
 
         FMat4& operator=(const FMat3& p_other);
-        FMat4& operator=(const FMat4& p_other);
+        constexpr FMat4& operator=(const FMat4& p_other) = default;
         FMat4& operator=(FMat4&& p_other) noexcept = default;
         ~FMat4() = default;
 
         FMat4 operator*(const FMat4& p_other) const;
         FMat4& operator*=(const FMat4& p_other);
         FVec4 operator*(const FVec4& p_other) const;
-        FMat4 operator*(float p_scalar) const;
+        constexpr FMat4 operator*(float p_scalar) const;
         FVec3 operator*(const FVec3& p_other) const;
         FMat4 operator/(float p_scalar) const;
         FMat4& operator/=(float p_scalar);
-        FMat4 operator+(const FMat4& p_other) const;
-        FMat4& operator+=(const FMat4& p_other);
-        FMat4 operator-(const FMat4& p_other) const;
-        FMat4& operator-=(const FMat4& p_other);
+        constexpr FMat4 operator+(const FMat4& p_other) const;
+        constexpr FMat4& operator+=(const FMat4& p_other);
+        constexpr FMat4 operator-(const FMat4& p_other) const;
+        constexpr FMat4& operator-=(const FMat4& p_other);
         bool operator==(const FMat4& p_other) const;
         bool operator!=(const FMat4& p_other) const;
-        FVec4& operator[](int p_index);
-        const FVec4& operator[](int p_index) const;
-        FMat4 operator-() const;
+        constexpr FVec4& operator[](int p_index);
+        constexpr const FVec4& operator[](int p_index) const;
+        constexpr FMat4 operator-() const;
 
         bool IsOrthogonal() const;
 
+        /**
+         * @brief Returns true if the last column is (0, 0, 0, 1), points then keep w = 1 and need no divide
+        */
+        bool IsAffine() const;
+
+        /**
+         * @brief Returns the 16 floats of the matrix, row after row, without copying them
+        */
+        float* Data() { return &m_matrix[0].x; }
+        const float* Data() const { return &m_matrix[0].x; }
+
+        /**
+         * @brief Returns a view of the 16 floats of the matrix, in the order of Data()
+        */
+        std::span<float, 16> AsSpan() { return std::span<float, 16>(Data(), 16); }
+        std::span<const float, 16> AsSpan() const { return std::span<const float, 16>(Data(), 16); }
+
+        [[deprecated("IsOrthogonal costs more than an inverse, use InverseFast or InverseRigid")]]
         static FMat4 InverseOrtho(const FMat4& p_matrix);
 
         /**
          * @brief Creates a new identity matrix
         */
-        static FMat4 Identity();
+        static constexpr FMat4 Identity();
 
         /**
          * @brief Creates a new translation matrix
          * @param p_translation The translation vector
         */
-        static FMat4 Translation(const FVec3& p_translation);
+        static constexpr FMat4 Translation(const FVec3& p_translation);
 
         /**
          * @brief Creates a new rotation matrix
@@ -103,7 +147,7 @@ namespace lm
          * @brief Creates a new scale matrix
          * @param p_scale The scale vector
         */
-        static FMat4 Scale(const FVec3& p_scale);
+        static constexpr FMat4 Scale(const FVec3& p_scale);
 
         /**
          * @brief Create a new look at matrix
@@ -192,18 +236,46 @@ namespace lm
         */
         static FMat4 Multiply(const FMat4& p_matrix1, const FMat4& p_matrix2);
 
+        /**
+         * @brief Multiplies pairs of matrices
+         * @param p_left The left matrices
+         * @param p_right The right matrices
+         * @param p_result Receives p_left[i] * p_right[i]
+         * @note The three spans must have the same size
+         * @note p_result may be one of the inputs but must not overlap them partially
+        */
+        static void MultiplyBatch(std::span<const FMat4> p_left, std::span<const FMat4> p_right, std::span<FMat4> p_result);
+
         /**
          * @brief Creates a new transformation matrix
          * @param p_translation The translation vector
          * @param p_rotation The rotation vector
          * @param p_scale The scale vector
-         * @return The transformation matrix
+         * @return The transformation matrix, Translation * ZRotation * XRotation * YRotation * Scale
          * @note The rotation vector is in degrees
+         * @note The matrix is written directly from the sines and cosines, without intermediate products
         */
         static FMat4 Transform(const FVec3& p_translation, const FVec3& p_rotation, const FVec3& p_scale);
 
+        /**
+         * @brief Creates a new transformation matrix
+         * @param p_translation The translation vector
+         * @param p_rotation The rotation, normalized by the function
+         * @param p_scale The scale vector
+         * @return The transformation matrix, Translation * rotation * Scale
+        */
         static FMat4 Transform(const FVec3& p_translation, const FQuat& p_rotation, const FVec3& p_scale);
 
+        /**
+         * @brief Creates an array of transformation matrices, same as Transform(p_translations[i], p_rotations[i], p_scales[i])
+         * @param p_translations The translations
+         * @param p_rotations The rotations, normalized by the function
+         * @param p_scales The scales
+         * @param p_result Receives the matrices
+         * @note The streams and p_result must have the same size
+        */
+        static void TransformBatch(const FVec3Stream& p_translations, const FQuatStream& p_rotations, const FVec3Stream& p_scales, std::span<FMat4> p_result);
+
         /**
          * @brief Creates a new Rotation matrix around the X axis
          * @param p_angle The angle of rotation
@@ -269,10 +341,41 @@ namespace lm
 
         /**
          * @brief Converts the matrix to an array
-         * @return The array
+         * @return The array, allocated with new[] and owned by the caller
         */
+        [[deprecated("allocates on every call, use Data(), AsSpan() or PackMatrices")]]
         static float* ToArray(const FMat4& p_matrix);
 
+        /**
+         * @brief Writes matrices one after the other into a buffer, e.g. a mapped GPU buffer
+         * @param p_matrices The matrices
+         * @param p_destination Receives 16 floats per matrix, needs no alignment
+         * @param p_layout Order of the floats of each matrix
+         * @note The Native layout is a single copy, the Transposed one transposes 4 floats at a time
+        */
+        static void PackMatrices(std::span<const FMat4> p_matrices, float* p_destination, EMatrixLayout p_layout = EMatrixLayout::Native);
+
+        /**
+         * @brief Linear blend skinning of a mesh: each vertex blends the palette matrices of its influences by
+         * weight, then its position and normal are transformed by the blend in one pass
+         * @param p_palette The bone matrices, affine
+         * @param p_influences The bones and weights of each vertex, every bone index below p_palette.size()
+         * @param p_positions The bind pose positions, same size as p_influences
+         * @param p_normals The bind pose normals, same size as p_influences
+         * @param p_resultPositions Receives the skinned positions, resized and allowed to be p_positions
+         * @param p_resultNormals Receives the skinned normals renormalized, resized and allowed to be p_normals
+         * @note The normals go through the blended linear part, exact for rotations and uniform scales.
+         * Vertices without weight keep their position and normal
+        */
+        static void Skin(std::span<const FMat4> p_palette, const FSkinInfluences& p_influences, const FVec3Stream& p_positions, const FVec3Stream& p_normals,
+            FVec3Stream& p_resultPositions, FVec3Stream& p_resultNormals);
+
+        /**
+         * @brief Same as Skin, the vertices are split in chunks of 1024 run on the threads of p_pool
+        */
+        static void Skin(std::span<const FMat4> p_palette, const FSkinInfluences& p_influences, const FVec3Stream& p_positions, const FVec3Stream& p_normals,
+            FVec3Stream& p_resultPositions, FVec3Stream& p_resultNormals, FWorkerPool& p_pool);
+
         /*
         * @brief Converts a 3x3 matrix to a 4x4 matrix
         * @param p_matrix The 3x3 matrix
@@ -293,13 +396,182 @@ namespace lm
          * @return The inverted matrix
         */
         static FMat4 Inverse(const FMat4& p_matrix);
+
+        /**
+         * @brief Returns the most specific kind of a matrix, to pick its inverse
+         * @param p_matrix The matrix
+         * @param p_epsilon Tolerance on the dot products of the linear columns for Rigid
+         * @note The affine test is exact, so matrices built by the library (Transform, Translation, LookAt...) qualify
+        */
+        static EMatrixKind Classify(const FMat4& p_matrix, float p_epsilon = 1e-4f);
+
+        /**
+         * @brief Inverts a matrix with the cheapest routine its kind allows
+         * @param p_matrix The matrix to invert
+         * @note Classifies p_matrix first, pass the kind when it is known to skip the test
+        */
+        static FMat4 InverseFast(const FMat4& p_matrix);
+
+        /**
+         * @brief Inverts a matrix of a known kind
+         * @param p_matrix The matrix to invert
+         * @param p_kind The kind of p_matrix, a less specific kind is always valid
+         * @note p_kind is checked with an assert in debug builds only, a wrong kind gives a wrong inverse
+        */
+        static FMat4 InverseFast(const FMat4& p_matrix, EMatrixKind p_kind);
+
+        /**
+         * @brief Inverts an affine matrix: a 3x3 inverse and one translation
+         * @param p_matrix The matrix to invert, its last column must be (0, 0, 0, 1)
+        */
+        static FMat4 InverseAffine(const FMat4& p_matrix);
+
+        /**
+         * @brief Inverts a rigid matrix: the rotation is transposed and the translation rotated back and negated
+         * @param p_matrix The matrix to invert, affine with orthonormal linear columns
+        */
+        static FMat4 InverseRigid(const FMat4& p_matrix);
+
+        /**
+         * @brief inverts an array of matrices
+         * @param p_matrices The matrices to invert
+         * @param p_result Receives the inverse of each matrix
+         * @note The matrices are transposed to structure of arrays and inverted 8 at a time with AVX2 (16 with AVX-512, 4 with SSE)
+         * @note p_result may be p_matrices but must not overlap it partially
+        */
+        static void InverseBatch(std::span<const FMat4> p_matrices, std::span<FMat4> p_result);
+
+        /**
+         * @brief transforms an array of points, same as p_matrix * p_points[i] for each point
+         * @param p_matrix The transform
+         * @param p_points The points, w is taken as 1
+         * @param p_result Receives the transformed points
+         * @note The points are divided by the resulting w unless p_matrix is affine, which is checked once per call
+         * @note The points are processed 8 at a time with AVX2 (16 with AVX-512, 4 with SSE), p_result may be p_points
+        */
+        static void TransformPoints(const FMat4& p_matrix, std::span<const FVec3> p_points, std::span<FVec3> p_result);
+
+        /**
+         * @brief transforms an array of directions, the translation is ignored
+         * @param p_matrix The transform
+         * @param p_directions The directions, w is taken as 0
+         * @param p_result Receives the transformed directions
+         * @note p_result may be p_directions
+        */
+        static void TransformDirections(const FMat4& p_matrix, std::span<const FVec3> p_directions, std::span<FVec3> p_result);
+
+        /**
+         * @brief transforms an array of points into homogeneous coordinates
+         * @param p_matrix The transform, usually a view projection
+         * @param p_points The points, w is taken as 1
+         * @param p_result Receives the transformed points with their w, not divided so they can be clipped first
+        */
+        static void TransformPointsProjective(const FMat4& p_matrix, std::span<const FVec3> p_points, std::span<FVec4> p_result);
+
+        /**
+         * @brief transforms an array of homogeneous vectors
+         * @param p_matrix The transform
+         * @param p_vectors The vectors, their w takes part in the product
+         * @param p_result Receives the transformed vectors, not divided
+         * @note p_result may be p_vectors
+        */
+        static void TransformPointsProjective(const FMat4& p_matrix, std::span<const FVec4> p_vectors, std::span<FVec4> p_result);
     };
 
     std::ostream& operator<<(std::ostream& p_stream, const FMat4& p_matrix);
 
     std::istream& operator>>(std::istream& p_stream, FMat4& p_matrix);
 
-    FMat4 operator*(float p_scalar, const FMat4& p_matrix);
+    constexpr FMat4 operator*(float p_scalar, const FMat4& p_matrix);
+
+    static_assert(sizeof(FMat4) == 16 * sizeof(float), "FMat4 must be 16 contiguous floats");
 
     FMat4 operator/(float p_scalar, const FMat4& p_matrix);
-}
\ No newline at end of file
+}
+
+namespace lm
+{
+    constexpr FMat4::FMat4(float p_init) :
+        m_matrix{ FVec4(p_init, 0, 0, 0), FVec4(0, p_init, 0, 0), FVec4(0, 0, p_init, 0), FVec4(0, 0, 0, p_init) }
+    {
+    }
+
+    constexpr FMat4::FMat4(float p_00, float p_01, float p_02, float p_03,
+        float p_10, float p_11, float p_12, float p_13,
+        float p_20, float p_21, float p_22, float p_23,
+        float p_30, float p_31, float p_32, float p_33) :
+        m_matrix{ FVec4(p_00, p_01, p_02, p_03), FVec4(p_10, p_11, p_12, p_13), FVec4(p_20, p_21, p_22, p_23), FVec4(p_30, p_31, p_32, p_33) }
+    {
+    }
+
+    constexpr FMat4::FMat4(FVec4 p_row1, FVec4 p_row2, FVec4 p_row3, FVec4 p_row4) :
+        m_matrix{ p_row1, p_row2, p_row3, p_row4 }
+    {
+    }
+
+    inline constexpr FMat4 FMat4::IdentityMatrix(1.0f);
+
+    constexpr FMat4 FMat4::operator*(float p_scalar) const
+    {
+        return FMat4(m_matrix[0] * p_scalar, m_matrix[1] * p_scalar, m_matrix[2] * p_scalar, m_matrix[3] * p_scalar);
+    }
+
+    constexpr FMat4 FMat4::operator+(const FMat4& p_other) const
+    {
+        return FMat4(m_matrix[0] + p_other.m_matrix[0], m_matrix[1] + p_other.m_matrix[1],
+            m_matrix[2] + p_other.m_matrix[2], m_matrix[3] + p_other.m_matrix[3]);
+    }
+
+    constexpr FMat4& FMat4::operator+=(const FMat4& p_other)
+    {
+        *this = *this + p_other;
+        return *this;
+    }
+
+    constexpr FMat4 FMat4::operator-(const FMat4& p_other) const
+    {
+        return FMat4(m_matrix[0] - p_other.m_matrix[0], m_matrix[1] - p_other.m_matrix[1],
+            m_matrix[2] - p_other.m_matrix[2], m_matrix[3] - p_other.m_matrix[3]);
+    }
+
+    constexpr FMat4& FMat4::operator-=(const FMat4& p_other)
+    {
+        *this = *this - p_other;
+        return *this;
+    }
+
+    constexpr FMat4 FMat4::operator-() const
+    {
+        return FMat4(-m_matrix[0], -m_matrix[1], -m_matrix[2], -m_matrix[3]);
+    }
+
+    constexpr FVec4& FMat4::operator[](int p_index)
+    {
+        return m_matrix[p_index];
+    }
+
+    constexpr const FVec4& FMat4::operator[](int p_index) const
+    {
+        return m_matrix[p_index];
+    }
+
+    constexpr FMat4 FMat4::Identity()
+    {
+        return FMat4(1.0f);
+    }
+
+    constexpr FMat4 FMat4::Translation(const FVec3& p_translation)
+    {
+        return FMat4(FVec4(1, 0, 0, 0), FVec4(0, 1, 0, 0), FVec4(0, 0, 1, 0), FVec4(p_translation.x, p_translation.y, p_translation.z, 1));
+    }
+
+    constexpr FMat4 FMat4::Scale(const FVec3& p_scale)
+    {
+        return FMat4(FVec4(p_scale.x, 0, 0, 0), FVec4(0, p_scale.y, 0, 0), FVec4(0, 0, p_scale.z, 0), FVec4(0, 0, 0, 1));
+    }
+
+    constexpr FMat4 operator*(float p_scalar, const FMat4& p_matrix)
+    {
+        return p_matrix * p_scalar;
+    }
+}
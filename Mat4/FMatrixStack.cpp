@@ -0,0 +1,171 @@
+#include "FMatrixStack.hpp"
+#include "../Quaternion/FQuat.hpp"
+#include "../SIMD/Mat4Kernels.h"
+
+#include <cmath>
+#include <stdexcept>
+
+using namespace lm;
+
+lm::FMatrixStack::FMatrixStack(size_t p_capacity)
+{
+    if (p_capacity == 0)
+    {
+        throw std::logic_error("FMatrixStack: the capacity must be at least 1");
+    }
+
+    m_levels.resize(p_capacity, FLevel{ FMat4(1.0f), FMat3(1.0f), true });
+}
+
+void lm::FMatrixStack::Push()
+{
+    if (m_size == m_levels.size())
+    {
+        throw std::out_of_range("FMatrixStack::Push: the stack is full");
+    }
+
+    m_levels[m_size] = m_levels[m_size - 1];
+    m_size++;
+}
+
+void lm::FMatrixStack::Push(const FMat4& p_local)
+{
+    if (m_size == m_levels.size())
+    {
+        throw std::out_of_range("FMatrixStack::Push: the stack is full");
+    }
+
+    // Multiplied straight into the new level, the parent is not copied first
+    FLevel& level = m_levels[m_size];
+    simd::Mat4Multiply(m_levels[m_size - 1].matrix, p_local, level.matrix);
+    level.normalValid = false;
+    m_size++;
+}
+
+void lm::FMatrixStack::Pop()
+{
+    if (m_size == 1)
+    {
+        throw std::logic_error("FMatrixStack::Pop: the first level can not be popped");
+    }
+
+    m_size--;
+}
+
+void lm::FMatrixStack::Load(const FMat4& p_matrix)
+{
+    Top().matrix = p_matrix;
+    Changed();
+}
+
+void lm::FMatrixStack::LoadIdentity()
+{
+    FLevel& top = Top();
+    top.matrix = FMat4(1.0f);
+    top.normal = FMat3(1.0f);
+    top.normalValid = true;
+}
+
+void lm::FMatrixStack::Clear()
+{
+    m_size = 1;
+    LoadIdentity();
+}
+
+void lm::FMatrixStack::MultiplyLocal(const FMat4& p_local)
+{
+    FMat4& top = Top().matrix;
+    simd::Mat4Multiply(top, p_local, top);
+    Changed();
+}
+
+void lm::FMatrixStack::Translate(const FVec3& p_translation)
+{
+    FVec4* columns = Top().matrix.m_matrix;
+    columns[3] = columns[0] * p_translation.x + columns[1] * p_translation.y + columns[2] * p_translation.z + columns[3];
+    Changed();
+}
+
+void lm::FMatrixStack::Rotate(float p_angle, const FVec3& p_axis)
+{
+    // The quaternion of the rotation, its length is irrelevant to RotationScale
+    const float halfAngle = TO_RADIANS(p_angle) * 0.5f;
+    const FVec3 axis = FVec3::Normalize(p_axis) * std::sin(halfAngle);
+
+    Rotate(FQuat(axis.x, axis.y, axis.z, std::cos(halfAngle)));
+}
+
+void lm::FMatrixStack::Rotate(const FQuat& p_rotation)
+{
+    float rotation[3][3];
+    simd::RotationScale(p_rotation.x, p_rotation.y, p_rotation.z, p_rotation.w, 1.0f, 1.0f, 1.0f, rotation);
+
+    FVec4* columns = Top().matrix.m_matrix;
+    const FVec4 column0 = columns[0];
+    const FVec4 column1 = columns[1];
+    const FVec4 column2 = columns[2];
+
+    for (int i = 0; i < 3; i++)
+    {
+        columns[i] = column0 * rotation[i][0] + column1 * rotation[i][1] + column2 * rotation[i][2];
+    }
+
+    Changed();
+}
+
+void lm::FMatrixStack::Scale(const FVec3& p_scale)
+{
+    FVec4* columns = Top().matrix.m_matrix;
+    columns[0] *= p_scale.x;
+    columns[1] *= p_scale.y;
+    columns[2] *= p_scale.z;
+    Changed();
+}
+
+const FMat4& lm::FMatrixStack::GetTop() const
+{
+    return m_levels[m_size - 1].matrix;
+}
+
+const FMat3& lm::FMatrixStack::GetNormalMatrix() const
+{
+    const FLevel& top = m_levels[m_size - 1];
+
+    if (!top.normalValid)
+    {
+        // The columns of the inverse transpose are the cross products of the other two columns over the determinant
+        const FVec4* columns = top.matrix.m_matrix;
+        const FVec3 column0(columns[0].x, columns[0].y, columns[0].z);
+        const FVec3 column1(columns[1].x, columns[1].y, columns[1].z);
+        const FVec3 column2(columns[2].x, columns[2].y, columns[2].z);
+
+        const FVec3 cross12 = FVec3::Cross(column1, column2);
+        const float inverseDeterminant = 1.0f / FVec3::Dot(column0, cross12);
+
+        top.normal = FMat3(cross12 * inverseDeterminant, FVec3::Cross(column2, column0) * inverseDeterminant,
+            FVec3::Cross(column0, column1) * inverseDeterminant);
+        top.normalValid = true;
+    }
+
+    return top.normal;
+}
+
+size_t lm::FMatrixStack::Size() const
+{
+    return m_size;
+}
+
+size_t lm::FMatrixStack::GetCapacity() const
+{
+    return m_levels.size();
+}
+
+FMatrixStack::FLevel& lm::FMatrixStack::Top()
+{
+    return m_levels[m_size - 1];
+}
+
+void lm::FMatrixStack::Changed()
+{
+    Top().normalValid = false;
+}
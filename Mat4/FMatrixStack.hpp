@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "FMat4.hpp"
+#include "../Mat3/FMat3.hpp"
+
+namespace lm
+{
+    struct FQuat;
+
+    /**
+     * @brief A stack of model matrices of fixed capacity, for immediate style composition
+     * @details Every level sits on its own cache lines next to its normal matrix, allocated once by
+     * the constructor. Push copies the top once, the other operations update it in place: Translate
+     * only rewrites the translation column and Rotate and Scale only the linear part. The normal
+     * matrix is recomputed on request after a change of the top, and popping gives back the one of
+     * the parent if it was computed.
+    */
+    struct FMatrixStack
+    {
+        /**
+         * @brief Creates a stack holding an identity matrix
+         * @param p_capacity The maximum number of levels, the identity included
+        */
+        explicit FMatrixStack(size_t p_capacity = 32);
+
+        /**
+         * @brief Duplicates the top matrix
+        */
+        void Push();
+
+        /**
+         * @brief Pushes top * p_local, p_local is applied first
+        */
+        void Push(const FMat4& p_local);
+
+        /**
+         * @brief Removes the top matrix, the first level can not be popped
+        */
+        void Pop();
+
+        /**
+         * @brief Replaces the top matrix
+        */
+        void Load(const FMat4& p_matrix);
+        void LoadIdentity();
+
+        /**
+         * @brief Returns to a single identity level
+        */
+        void Clear();
+
+        /**
+         * @brief Sets the top to top * p_local, p_local is applied first
+        */
+        void MultiplyLocal(const FMat4& p_local);
+
+        /**
+         * @brief Sets the top to top * Translation(p_translation)
+        */
+        void Translate(const FVec3& p_translation);
+
+        /**
+         * @brief Sets the top to top * Rotation(p_angle, p_axis)
+         * @param p_angle The angle in degrees
+         * @param p_axis The axis, normalized by the function
+        */
+        void Rotate(float p_angle, const FVec3& p_axis);
+
+        /**
+         * @brief Sets the top to top * Rotation(p_rotation), the rotation being of any non zero length
+        */
+        void Rotate(const FQuat& p_rotation);
+
+        /**
+         * @brief Sets the top to top * Scale(p_scale)
+        */
+        void Scale(const FVec3& p_scale);
+
+        const FMat4& GetTop() const;
+
+        /**
+         * @brief Returns the inverse transpose of the linear part of the top, for normals
+         * @note Computed from cross products of the columns on the first call after a change
+        */
+        const FMat3& GetNormalMatrix() const;
+
+        /**
+         * @brief Returns the number of levels, 1 for a stack without push
+        */
+        size_t Size() const;
+        size_t GetCapacity() const;
+
+    private:
+        struct alignas(64) FLevel
+        {
+            FMat4 matrix;
+            mutable FMat3 normal;
+            mutable bool normalValid;
+        };
+
+        FLevel& Top();
+        void Changed();
+
+        // Sized once, never reallocated
+        std::vector<FLevel> m_levels;
+        size_t m_size = 1;
+    };
+}
@@ -0,0 +1,185 @@
+#include "FTaggedMat4.hpp"
+#include "../Quaternion/FQuat.hpp"
+#include "../SIMD/Mat4Kernels.h"
+
+using namespace lm;
+
+lm::FTaggedMat4::FTaggedMat4(const FMat4& p_matrix) : m_matrix(p_matrix), m_flags(EMatrixFlags::None)
+{
+    const EMatrixKind kind = FMat4::Classify(p_matrix);
+
+    if (kind == EMatrixKind::General)
+    {
+        return;
+    }
+
+    m_flags = EMatrixFlags::Affine;
+
+    if (kind == EMatrixKind::Rigid)
+    {
+        m_flags = m_flags | EMatrixFlags::Rigid;
+
+        if (p_matrix[0] == FVec4(1, 0, 0, 0) && p_matrix[1] == FVec4(0, 1, 0, 0) && p_matrix[2] == FVec4(0, 0, 1, 0))
+        {
+            m_flags = m_flags | EMatrixFlags::LinearIdentity;
+        }
+    }
+
+    if (p_matrix[3] == FVec4(0, 0, 0, 1))
+    {
+        m_flags = m_flags | EMatrixFlags::NoTranslation;
+    }
+}
+
+FTaggedMat4 lm::FTaggedMat4::operator*(const FTaggedMat4& p_other) const
+{
+    return Multiply(*this, p_other);
+}
+
+FTaggedMat4& lm::FTaggedMat4::operator*=(const FTaggedMat4& p_other)
+{
+    *this = Multiply(*this, p_other);
+    return *this;
+}
+
+FVec3 lm::FTaggedMat4::operator*(const FVec3& p_point) const
+{
+    return TransformPoint(*this, p_point);
+}
+
+FTaggedMat4 lm::FTaggedMat4::Rotation(float p_angle, const FVec3& p_axis)
+{
+    return FTaggedMat4(FMat4::Rotate(FMat4::Identity(), p_angle, p_axis), EMatrixFlags::Affine | EMatrixFlags::Rigid | EMatrixFlags::NoTranslation);
+}
+
+FTaggedMat4 lm::FTaggedMat4::Rotation(const FQuat& p_rotation)
+{
+    return FTaggedMat4(FMat4::Transform(FVec3(0.0f), p_rotation, FVec3(1.0f)), EMatrixFlags::Affine | EMatrixFlags::Rigid | EMatrixFlags::NoTranslation);
+}
+
+FTaggedMat4 lm::FTaggedMat4::Transform(const FVec3& p_translation, const FQuat& p_rotation, const FVec3& p_scale)
+{
+    const EMatrixFlags flags = p_scale == FVec3(1.0f) ? EMatrixFlags::Affine | EMatrixFlags::Rigid : EMatrixFlags::Affine;
+    return FTaggedMat4(FMat4::Transform(p_translation, p_rotation, p_scale), flags);
+}
+
+FTaggedMat4 lm::FTaggedMat4::LookAt(const FVec3& p_eye, const FVec3& p_target, const FVec3& p_up)
+{
+    return FTaggedMat4(FMat4::LookAt(p_eye, p_target, p_up), EMatrixFlags::Affine | EMatrixFlags::Rigid);
+}
+
+FTaggedMat4 lm::FTaggedMat4::Perspective(float p_fov, float p_aspectRatio, float p_near, float p_far)
+{
+    return FTaggedMat4(FMat4::Perspective(p_fov, p_aspectRatio, p_near, p_far), EMatrixFlags::None);
+}
+
+FTaggedMat4 lm::FTaggedMat4::Orthographic(float p_left, float p_right, float p_bottom, float p_top, float p_near, float p_far)
+{
+    return FTaggedMat4(FMat4::Orthographic(p_left, p_right, p_bottom, p_top, p_near, p_far), EMatrixFlags::Affine);
+}
+
+FTaggedMat4 lm::FTaggedMat4::Translate(const FTaggedMat4& p_matrix, const FVec3& p_translation)
+{
+    return Multiply(p_matrix, Translation(p_translation));
+}
+
+FTaggedMat4 lm::FTaggedMat4::Rotate(const FTaggedMat4& p_matrix, float p_angle, const FVec3& p_axis)
+{
+    return Multiply(p_matrix, Rotation(p_angle, p_axis));
+}
+
+FTaggedMat4 lm::FTaggedMat4::Scale(const FTaggedMat4& p_matrix, const FVec3& p_scale)
+{
+    return Multiply(p_matrix, Scale(p_scale));
+}
+
+FTaggedMat4 lm::FTaggedMat4::Multiply(const FTaggedMat4& p_left, const FTaggedMat4& p_right)
+{
+    if (p_left.Has(EMatrixFlags::Identity))
+    {
+        return p_right;
+    }
+
+    if (p_right.Has(EMatrixFlags::Identity))
+    {
+        return p_left;
+    }
+
+    FTaggedMat4 result(p_right.m_matrix, p_left.m_flags & p_right.m_flags);
+
+    if (!result.Has(EMatrixFlags::Affine))
+    {
+        result.m_flags = EMatrixFlags::None;
+        simd::Mat4Multiply(p_left.m_matrix, p_right.m_matrix, result.m_matrix);
+    }
+    else if (p_left.Has(EMatrixFlags::LinearIdentity))
+    {
+        // Translating after p_right only moves its translation, both w are 1
+        result.m_matrix[3] = p_right.m_matrix[3] + p_left.m_matrix[3] - FVec4(0.0f, 0.0f, 0.0f, 1.0f);
+    }
+    else if (p_right.Has(EMatrixFlags::LinearIdentity))
+    {
+        // Translating before p_left: its translation goes through p_left
+        result.m_matrix = p_left.m_matrix;
+        result.m_matrix[3] = p_left.m_matrix * p_right.m_matrix[3];
+    }
+    else
+    {
+        simd::Mat4Multiply(p_left.m_matrix, p_right.m_matrix, result.m_matrix);
+    }
+
+    return result;
+}
+
+FTaggedMat4 lm::FTaggedMat4::Inverse(const FTaggedMat4& p_matrix)
+{
+    if (p_matrix.Has(EMatrixFlags::Identity))
+    {
+        return p_matrix;
+    }
+
+    FTaggedMat4 result(p_matrix.m_matrix, p_matrix.m_flags);
+
+    if (p_matrix.Has(EMatrixFlags::LinearIdentity))
+    {
+        // Negate the translation and keep w = 2 - 1 = 1, whole register operations
+        result.m_matrix[3] = FVec4(0.0f, 0.0f, 0.0f, 2.0f) - p_matrix.m_matrix[3];
+    }
+    else if (p_matrix.Has(EMatrixFlags::Rigid))
+    {
+        simd::Mat4InverseRigid(p_matrix.m_matrix, result.m_matrix);
+    }
+    else if (p_matrix.Has(EMatrixFlags::Affine))
+    {
+        simd::Mat4InverseAffine(p_matrix.m_matrix, result.m_matrix);
+    }
+    else
+    {
+        simd::Mat4Inverse(p_matrix.m_matrix, result.m_matrix);
+    }
+
+    return result;
+}
+
+FVec3 lm::FTaggedMat4::TransformPoint(const FTaggedMat4& p_matrix, const FVec3& p_point)
+{
+    const FVec4* rows = p_matrix.m_matrix.m_matrix;
+
+    if (p_matrix.Has(EMatrixFlags::LinearIdentity))
+    {
+        return FVec3(p_point.x + rows[3].x, p_point.y + rows[3].y, p_point.z + rows[3].z);
+    }
+
+    if (p_matrix.Has(EMatrixFlags::Affine))
+    {
+        const FVec4 result = rows[0] * p_point.x + rows[1] * p_point.y + rows[2] * p_point.z + rows[3];
+        return FVec3(result.x, result.y, result.z);
+    }
+
+    return p_matrix.m_matrix * p_point;
+}
+
+std::ostream& lm::operator<<(std::ostream& p_stream, const FTaggedMat4& p_matrix)
+{
+    return p_stream << p_matrix.m_matrix;
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+
+#include "FMat4.hpp"
+
+namespace lm
+{
+    struct FQuat;
+
+    /**
+     * @brief Properties known about a FMat4, each flag allows a cheaper product, inverse or transform
+    */
+    enum class EMatrixFlags : uint8_t
+    {
+        None = 0,                   // Nothing known, the matrix may be projective
+        Affine = 1 << 0,            // Last column (0, 0, 0, 1)
+        Rigid = 1 << 1,             // Orthonormal linear part, only set with Affine
+        LinearIdentity = 1 << 2,    // Identity linear part, only set with Affine and Rigid
+        NoTranslation = 1 << 3,     // Zero translation, only set with Affine
+
+        Translation = Affine | Rigid | LinearIdentity,
+        Identity = Translation | NoTranslation
+    };
+
+    constexpr EMatrixFlags operator|(EMatrixFlags p_left, EMatrixFlags p_right)
+    {
+        return static_cast<EMatrixFlags>(static_cast<uint8_t>(p_left) | static_cast<uint8_t>(p_right));
+    }
+
+    constexpr EMatrixFlags operator&(EMatrixFlags p_left, EMatrixFlags p_right)
+    {
+        return static_cast<EMatrixFlags>(static_cast<uint8_t>(p_left) & static_cast<uint8_t>(p_right));
+    }
+
+    /**
+     * @brief A FMat4 with the properties it is known to have
+     * @details The builders set the flags of what they create and the products and inverses derive
+     * them from their operands, so products with an identity are skipped, translations are added
+     * and rigid or affine matrices use the cheaper inverses of FMat4::InverseFast.
+     * @note The flags are trusted: editing m_matrix directly must keep them true, or reset them to None
+    */
+    struct FTaggedMat4
+    {
+        FMat4 m_matrix;
+        EMatrixFlags m_flags;
+
+        /**
+         * @brief Creates an identity matrix
+        */
+        constexpr FTaggedMat4();
+
+        /**
+         * @brief Creates a tagged matrix from a matrix and the properties it is known to have
+         * @param p_matrix The matrix
+         * @param p_flags Properties of p_matrix, fewer flags are always valid
+        */
+        constexpr FTaggedMat4(const FMat4& p_matrix, EMatrixFlags p_flags);
+
+        /**
+         * @brief Creates a tagged matrix from a matrix of unknown properties, found with FMat4::Classify
+         * @param p_matrix The matrix
+        */
+        explicit FTaggedMat4(const FMat4& p_matrix);
+
+        constexpr FTaggedMat4(const FTaggedMat4& p_toCopy) = default;
+        constexpr FTaggedMat4& operator=(const FTaggedMat4& p_other) = default;
+
+        FTaggedMat4 operator*(const FTaggedMat4& p_other) const;
+        FTaggedMat4& operator*=(const FTaggedMat4& p_other);
+        FVec3 operator*(const FVec3& p_point) const;
+
+        constexpr operator const FMat4&() const { return m_matrix; }
+
+        /**
+         * @brief Returns true if every flag of p_flags is known to hold
+        */
+        constexpr bool Has(EMatrixFlags p_flags) const;
+
+        static constexpr FTaggedMat4 Identity();
+        static constexpr FTaggedMat4 Translation(const FVec3& p_translation);
+        static constexpr FTaggedMat4 Scale(const FVec3& p_scale);
+
+        /**
+         * @brief Creates a rotation around an axis
+         * @param p_angle The angle in degrees
+         * @param p_axis The axis, normalized by the function
+        */
+        static FTaggedMat4 Rotation(float p_angle, const FVec3& p_axis);
+
+        static FTaggedMat4 Rotation(const FQuat& p_rotation);
+
+        /**
+         * @brief Creates Translation * rotation * Scale, rigid when the scale is 1
+        */
+        static FTaggedMat4 Transform(const FVec3& p_translation, const FQuat& p_rotation, const FVec3& p_scale);
+
+        static FTaggedMat4 LookAt(const FVec3& p_eye, const FVec3& p_target, const FVec3& p_up);
+        static FTaggedMat4 Perspective(float p_fov, float p_aspectRatio, float p_near, float p_far);
+        static FTaggedMat4 Orthographic(float p_left, float p_right, float p_bottom, float p_top, float p_near, float p_far);
+
+        /**
+         * @brief Returns p_matrix * Translation(p_translation), the translation is applied first
+        */
+        static FTaggedMat4 Translate(const FTaggedMat4& p_matrix, const FVec3& p_translation);
+
+        /**
+         * @brief Returns p_matrix * Rotation(p_angle, p_axis), the rotation is applied first
+        */
+        static FTaggedMat4 Rotate(const FTaggedMat4& p_matrix, float p_angle, const FVec3& p_axis);
+
+        /**
+         * @brief Returns p_matrix * Scale(p_scale), the scale is applied first
+         * @note Unlike FMat4::Scale(const FMat4&, const FVec3&), which only multiplies the diagonal of
+         * the matrix, this scales its first three columns, so a rotated matrix gives a different result
+        */
+        static FTaggedMat4 Scale(const FTaggedMat4& p_matrix, const FVec3& p_scale);
+
+        /**
+         * @brief Multiplies two matrices, identities are skipped and translations composed with additions
+         * @note The flags of the result are the flags both operands have
+        */
+        static FTaggedMat4 Multiply(const FTaggedMat4& p_left, const FTaggedMat4& p_right);
+
+        /**
+         * @brief Inverts a matrix with the cheapest routine its flags allow, the flags are kept
+        */
+        static FTaggedMat4 Inverse(const FTaggedMat4& p_matrix);
+
+        /**
+         * @brief Transforms a point, without the divide by w when the matrix is affine
+        */
+        static FVec3 TransformPoint(const FTaggedMat4& p_matrix, const FVec3& p_point);
+    };
+
+    std::ostream& operator<<(std::ostream& p_stream, const FTaggedMat4& p_matrix);
+}
+
+namespace lm
+{
+    constexpr FTaggedMat4::FTaggedMat4() : m_matrix(1.0f), m_flags(EMatrixFlags::Identity)
+    {
+    }
+
+    constexpr FTaggedMat4::FTaggedMat4(const FMat4& p_matrix, EMatrixFlags p_flags) : m_matrix(p_matrix), m_flags(p_flags)
+    {
+    }
+
+    constexpr bool FTaggedMat4::Has(EMatrixFlags p_flags) const
+    {
+        return (m_flags & p_flags) == p_flags;
+    }
+
+    constexpr FTaggedMat4 FTaggedMat4::Identity()
+    {
+        return FTaggedMat4();
+    }
+
+    constexpr FTaggedMat4 FTaggedMat4::Translation(const FVec3& p_translation)
+    {
+        return FTaggedMat4(FMat4::Translation(p_translation), EMatrixFlags::Translation);
+    }
+
+    constexpr FTaggedMat4 FTaggedMat4::Scale(const FVec3& p_scale)
+    {
+        return FTaggedMat4(FMat4::Scale(p_scale), EMatrixFlags::Affine | EMatrixFlags::NoTranslation);
+    }
+}
@@ -4,4 +4,7 @@
 #include "Mat3/Mat3.h"
 #include "Mat3/FMat3.hpp"
 #include "Mat4/Mat4.h"
-#include "Mat4/FMat4.hpp"
\ No newline at end of file
+#include "Mat4/FMat4.hpp"
+#include "Mat4/FTaggedMat4.hpp"
+#include "Mat4/FMatrixStack.hpp"
+#include "Affine/FAffine34.hpp"
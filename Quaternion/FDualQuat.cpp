@@ -0,0 +1,131 @@
+#include "FDualQuat.hpp"
+#include "../Mat3/FMat3.hpp"
+#include "../Mat4/FMat4.hpp"
+#include "../Vec3/FVec3Stream.hpp"
+#include "../Skinning/FSkinInfluences.hpp"
+#include "../SIMD/Dispatch.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+using namespace lm;
+
+lm::FDualQuat::FDualQuat(const FQuat& p_rotation, const FVec3& p_translation) :
+    m_real(p_rotation), m_dual(FQuat(p_translation.x, p_translation.y, p_translation.z, 0.0f) * p_rotation * 0.5f)
+{
+}
+
+lm::FDualQuat::FDualQuat(const FMat4& p_matrix) :
+    FDualQuat(FQuat::Normalize(FQuat::FromMatrix3(FMat3(p_matrix))), FVec3(p_matrix[3].x, p_matrix[3].y, p_matrix[3].z))
+{
+}
+
+FDualQuat lm::FDualQuat::operator*(const FDualQuat& p_other) const
+{
+    return Multiply(*this, p_other);
+}
+
+FDualQuat& lm::FDualQuat::operator*=(const FDualQuat& p_other)
+{
+    *this = Multiply(*this, p_other);
+    return *this;
+}
+
+FVec3 lm::FDualQuat::operator*(const FVec3& p_point) const
+{
+    return TransformPoint(*this, p_point);
+}
+
+bool lm::FDualQuat::operator==(const FDualQuat& p_other) const
+{
+    return m_real == p_other.m_real && m_dual == p_other.m_dual;
+}
+
+bool lm::FDualQuat::operator!=(const FDualQuat& p_other) const
+{
+    return !(*this == p_other);
+}
+
+FQuat lm::FDualQuat::GetRotation() const
+{
+    return m_real;
+}
+
+FVec3 lm::FDualQuat::GetTranslation() const
+{
+    const FQuat translation = m_dual * FQuat::Conjugate(m_real) * 2.0f;
+    return FVec3(translation.x, translation.y, translation.z);
+}
+
+FMat4 lm::FDualQuat::ToMat4() const
+{
+    return FMat4::Transform(GetTranslation(), m_real, FVec3(1.0f));
+}
+
+FDualQuat lm::FDualQuat::Multiply(const FDualQuat& p_left, const FDualQuat& p_right)
+{
+    return FDualQuat(p_left.m_real * p_right.m_real, p_left.m_real * p_right.m_dual + p_left.m_dual * p_right.m_real);
+}
+
+FDualQuat lm::FDualQuat::Normalize(const FDualQuat& p_value)
+{
+    const float squaredLength = FQuat::Length2(p_value.m_real);
+
+    if (squaredLength == 0.0f)
+    {
+        return FDualQuat();
+    }
+
+    const float inverseLength = 1.0f / std::sqrt(squaredLength);
+    const FQuat real = p_value.m_real * inverseLength;
+    const FQuat dual = p_value.m_dual * inverseLength;
+
+    return FDualQuat(real, dual - real * FQuat::Dot(real, dual));
+}
+
+FDualQuat lm::FDualQuat::Inverse(const FDualQuat& p_value)
+{
+    return FDualQuat(FQuat::Conjugate(p_value.m_real), FQuat::Conjugate(p_value.m_dual));
+}
+
+FVec3 lm::FDualQuat::TransformPoint(const FDualQuat& p_transform, const FVec3& p_point)
+{
+    return p_transform.m_real * p_point + p_transform.GetTranslation();
+}
+
+FVec3 lm::FDualQuat::TransformDirection(const FDualQuat& p_transform, const FVec3& p_direction)
+{
+    return p_transform.m_real * p_direction;
+}
+
+void lm::FDualQuat::Skin(std::span<const FDualQuat> p_bones, const FSkinInfluences& p_influences, const FVec3Stream& p_positions, FVec3Stream& p_result)
+{
+    if (p_influences.Size() != p_positions.Size())
+    {
+        throw std::logic_error("FDualQuat::Skin: influences and positions must have the same size");
+    }
+
+    if (p_positions.Size() > 0 && p_influences.GetMaxBone() >= p_bones.size())
+    {
+        throw std::out_of_range("FDualQuat::Skin: bone index out of range");
+    }
+
+    p_result.Resize(p_positions.Size());
+
+    if (p_positions.Size() == 0)
+    {
+        return;
+    }
+
+    const uint32_t* const indices[] = { p_influences.Bones(0), p_influences.Bones(1), p_influences.Bones(2), p_influences.Bones(3) };
+    const float* const weights[] = { p_influences.Weights(0), p_influences.Weights(1), p_influences.Weights(2), p_influences.Weights(3) };
+    const float* const positions[] = { p_positions.X(), p_positions.Y(), p_positions.Z() };
+    float* const result[] = { p_result.X(), p_result.Y(), p_result.Z() };
+
+    simd::Kernels().dualQuatSkin(&p_bones.data()->m_real.x, indices, weights, positions, result, p_positions.Size());
+}
+
+std::ostream& lm::operator<<(std::ostream& p_stream, const FDualQuat& p_value)
+{
+    return p_stream << p_value.m_real << " + e" << p_value.m_dual;
+}
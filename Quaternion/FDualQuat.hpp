@@ -0,0 +1,120 @@
+#pragma once
+
+#include <iostream>
+#include <span>
+
+#include "FQuat.hpp"
+#include "../Vec3/FVec3.hpp"
+
+namespace lm
+{
+    struct FMat4;
+    struct FVec3Stream;
+    struct FSkinInfluences;
+
+    /**
+     * @brief A rigid transform stored as a dual quaternion: real part the rotation, dual part half the translation times the rotation
+     * @details 8 floats per transform instead of 12 or 16, and blending several of them keeps the
+     * volume of skinned meshes where blended matrices collapse (candy-wrapper effect).
+     * The products follow FMat4: a * b applies b first, then a.
+     * @note The functions expect unit dual quaternions, Normalize brings a blend back to one
+    */
+    struct FDualQuat
+    {
+        FQuat m_real;
+        FQuat m_dual;
+
+        /**
+         * @brief Creates the identity transform
+        */
+        constexpr FDualQuat();
+
+        /**
+         * @brief Creates a dual quaternion from its parts
+         * @param p_real The real part
+         * @param p_dual The dual part
+        */
+        constexpr FDualQuat(const FQuat& p_real, const FQuat& p_dual);
+
+        /**
+         * @brief Creates the transform rotating by p_rotation then translating by p_translation
+         * @param p_rotation A unit quaternion
+         * @param p_translation The translation
+        */
+        FDualQuat(const FQuat& p_rotation, const FVec3& p_translation);
+
+        /**
+         * @brief Creates a dual quaternion from a rigid matrix, the linear part must be a rotation
+         * @param p_matrix A rotation and translation
+        */
+        explicit FDualQuat(const FMat4& p_matrix);
+
+        FDualQuat operator*(const FDualQuat& p_other) const;
+        FDualQuat& operator*=(const FDualQuat& p_other);
+        FVec3 operator*(const FVec3& p_point) const;
+
+        bool operator==(const FDualQuat& p_other) const;
+        bool operator!=(const FDualQuat& p_other) const;
+
+        /**
+         * @brief Returns the rotation, the real part
+        */
+        FQuat GetRotation() const;
+
+        /**
+         * @brief Returns the translation, 2 * dual * conjugate(real)
+        */
+        FVec3 GetTranslation() const;
+
+        /**
+         * @brief Returns the equivalent rotation and translation matrix
+        */
+        FMat4 ToMat4() const;
+
+        /**
+         * @brief Multiplies two dual quaternions, p_right is applied first
+        */
+        static FDualQuat Multiply(const FDualQuat& p_left, const FDualQuat& p_right);
+
+        /**
+         * @brief Scales both parts to a unit real part and removes the component of the dual part along it
+         * @note A zero real part gives the identity
+        */
+        static FDualQuat Normalize(const FDualQuat& p_value);
+
+        /**
+         * @brief Returns the inverse of a unit dual quaternion, the quaternion conjugate of both parts
+        */
+        static FDualQuat Inverse(const FDualQuat& p_value);
+
+        static FVec3 TransformPoint(const FDualQuat& p_transform, const FVec3& p_point);
+        static FVec3 TransformDirection(const FDualQuat& p_transform, const FVec3& p_direction);
+
+        /**
+         * @brief Dual quaternion skinning of a vertex stream
+         * @details Each vertex blends the bones of its influences by weight, flipping the bones on the
+         * other hemisphere of its first bone, normalizes the blend and transforms its position.
+         * Vertices without weight keep their position.
+         * @param p_bones The bone transforms, unit dual quaternions
+         * @param p_influences The bones and weights of each vertex, every bone index below p_bones.size()
+         * @param p_positions The bind pose positions, same size as p_influences
+         * @param p_result Receives the skinned positions, resized to p_positions and allowed to be p_positions
+        */
+        static void Skin(std::span<const FDualQuat> p_bones, const FSkinInfluences& p_influences, const FVec3Stream& p_positions, FVec3Stream& p_result);
+    };
+
+    std::ostream& operator<<(std::ostream& p_stream, const FDualQuat& p_value);
+
+    static_assert(sizeof(FDualQuat) == 8 * sizeof(float), "FDualQuat must be 8 contiguous floats");
+}
+
+namespace lm
+{
+    constexpr FDualQuat::FDualQuat() : m_real(FQuat::identity), m_dual(0.0f, 0.0f, 0.0f, 0.0f)
+    {
+    }
+
+    constexpr FDualQuat::FDualQuat(const FQuat& p_real, const FQuat& p_dual) : m_real(p_real), m_dual(p_dual)
+    {
+    }
+}
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <span>
 #include <stdexcept>
+#include <type_traits>
+
+#include "../SIMD/SIMD.h"
+#include "../LibMathsConfig.h"
 
 namespace lm
 {
@@ -8,11 +13,25 @@ namespace lm
     struct FVec4;
     struct FMat4;
     struct FMat3;
+    struct FAffine34;
 
-    struct FQuat
+    /**
+     * @note 16 bytes aligned, on SSE targets the components share their storage with a __m128 register
+    */
+    struct alignas(16) FQuat
     {
     public:
-        float x, y, z, w;
+        union
+        {
+            struct
+            {
+                float x, y, z, w;
+            };
+
+#if LIBMATHS_USE_SSE
+            __m128 m_simd;
+#endif
+        };
 
     public:
 
@@ -26,9 +45,9 @@ namespace lm
          * @brief Default constructor
          * @details Set all components to 0
         */
-        FQuat();
+        constexpr FQuat();
 
-        FQuat(const float p_init);
+        constexpr FQuat(const float p_init);
 
         /**
          * @brief Constructor
@@ -36,7 +55,14 @@ namespace lm
          * @param value Value to set all components to
          * @return A new quaternion with all components set to value
         */
-        FQuat(float x, float y, float z, float w = 0.f);
+        constexpr FQuat(float x, float y, float z, float w = 0.f) : x(x), y(y), z(z), w(w) {}
+
+#if LIBMATHS_USE_SSE
+        /**
+         * @brief Create a quaternion from a SSE register holding x, y, z, w
+        */
+        explicit FQuat(__m128 p_simd) : m_simd(p_simd) {}
+#endif
 
         /**
          * @brief Constructor copy
@@ -44,7 +70,7 @@ namespace lm
          * @param q FQuat to copy from
          * @return A new quaternion with the same components as q
         */
-        FQuat(FQuat const& q);
+        constexpr FQuat(FQuat const& q) = default;
 
         FQuat(FQuat&& p_toMove) noexcept = default;
 
@@ -93,7 +119,7 @@ namespace lm
          * @note This is faster than length() because it avoids a square root
          * @note This is useful for comparing the length of two quaternions
         */
-        static float Length2(FQuat const& p);
+        static constexpr float Length2(FQuat const& p);
 
         /**
          * @brief Get the Length of the quaternion
@@ -117,7 +143,7 @@ namespace lm
          * @return A new quaternion with the same direction as the original but with a length of 1
          * @note If the length of the quaternion is 0, the quaternion (0, 0, 0, 1) is returned
         */
-        static FQuat Conjugate(FQuat const& p);
+        static constexpr FQuat Conjugate(FQuat const& p);
 
         /**
          * @brief Get the inverse of the quaternion
@@ -133,7 +159,7 @@ namespace lm
          * @param p The other quaternion
          * @return The dot product of the two quaternions
         */
-        static float Dot(FQuat const& p, FQuat const& q);
+        static constexpr float Dot(FQuat const& p, FQuat const& q);
 
         /**
          * @brief Get the cross product of two quaternions
@@ -141,7 +167,7 @@ namespace lm
          * @param p The other quaternion
          * @return The cross product of the two quaternions
         */
-        static FQuat Cross(FQuat const& p, FQuat const& q);
+        static constexpr FQuat Cross(FQuat const& p, FQuat const& q);
 
         /************************************\
         *                                    *
@@ -151,31 +177,31 @@ namespace lm
 
         // -- Unary arithmetic operators --
 
-        FQuat operator=(FQuat const& q);
+        constexpr FQuat& operator=(FQuat const& q) = default;
 
-        FQuat operator+=(FQuat const& q);
+        constexpr FQuat operator+=(FQuat const& q);
 
-        FQuat operator-=(FQuat const& q);
+        constexpr FQuat operator-=(FQuat const& q);
 
-        FQuat operator*=(FQuat const& r);
+        constexpr FQuat operator*=(FQuat const& r);
 
-        FQuat operator*=(const float s);
+        constexpr FQuat operator*=(const float s);
 
         FQuat operator/=(const float s);
 
         // -- Unary bit operators --
 
-        FQuat operator-() const;
+        constexpr FQuat operator-() const;
 
         // -- Binary operators --
 
-        const FQuat operator+(FQuat const& q) const;
+        constexpr const FQuat operator+(FQuat const& q) const;
 
-        const FQuat operator-(FQuat const& q) const;
+        constexpr const FQuat operator-(FQuat const& q) const;
 
-        const FQuat operator*(FQuat const& p) const;
+        constexpr const FQuat operator*(FQuat const& p) const;
 
-        const FQuat operator*(float const& s) const;
+        constexpr const FQuat operator*(float const& s) const;
 
         const FVec3 operator*(FVec3 const& v) const;
 
@@ -185,9 +211,9 @@ namespace lm
 
         // -- Boolean operators --
 
-        bool operator==(FQuat const& q) const;
+        constexpr bool operator==(FQuat const& q) const;
 
-        bool operator!=(FQuat const& q) const;
+        constexpr bool operator!=(FQuat const& q) const;
         /**
          * @brief Returns true if the quaternion is a unit quaternion.
          * @return True if the quaternion is a unit quaternion.
@@ -296,15 +322,217 @@ namespace lm
         *	@return The interpolated quaternion
         */
         static FQuat SLerp(FQuat const& q1, FQuat const& q2, float t);
+
+        /**
+         * @brief SLerp approximated without trigonometry: a NLerp whose factor is corrected by a polynomial in t and the cosine
+         * @param q1 The first unit quaternion
+         * @param q2 The second unit quaternion
+         * @param t The interpolation factor, clamped to [0, 1]
+         * @return The interpolated quaternion, normalized
+         * @note The rotation is within 7.8e-4 radians (0.045 degrees) of the exact slerp over every
+         * pair of unit quaternions and every t, where NLerp is up to 0.14 radians off
+        */
+        static FQuat SLerpFast(FQuat const& q1, FQuat const& q2, float t);
+
+        /**
+         * @brief Rotates every vector of p_vectors by p_rotation, in place, VFloat::Width vectors at a time
+         * @param p_rotation A unit quaternion
+        */
+        static void RotateVectors(const FQuat& p_rotation, std::span<FVec3> p_vectors);
+
+        /**
+         * @brief Rotates p_vectors[i] by the unit quaternion p_rotations[i], in place
+         * @note The two spans must have the same size
+        */
+        static void RotateVectors(std::span<const FQuat> p_rotations, std::span<FVec3> p_vectors);
+
+        /**
+         * @brief Writes the rotation matrix of p_rotations[i] in p_result[i], VFloat::Width quaternions at a time
+         * @note The quaternions need not be normalized. The two spans must have the same size
+        */
+        static void ToRotateMat3(std::span<const FQuat> p_rotations, std::span<FMat3> p_result);
+
+        /**
+         * @brief Writes the rotation of p_rotations[i] in p_result[i], with a zero translation
+         * @note The quaternions need not be normalized. The two spans must have the same size
+        */
+        static void ToAffine(std::span<const FQuat> p_rotations, std::span<FAffine34> p_result);
+
+        /**
+         * @brief Writes the rotation of p_rotations[i] in p_result[i], with a zero translation
+         * @note The quaternions need not be normalized. The two spans must have the same size
+        */
+        static void ToMat4(std::span<const FQuat> p_rotations, std::span<FMat4> p_result);
+
+        /**
+         * @brief Writes the quaternion of the rotation matrix p_matrices[i] in p_result[i]
+         * @note Same results as FromMatrix3, the case of the largest diagonal term is picked without branches.
+         * The two spans must have the same size
+        */
+        static void FromMatrix3(std::span<const FMat3> p_matrices, std::span<FQuat> p_result);
     };
 
     FVec3 operator*(const FVec3& v, FQuat const& q);
 
     FVec4 operator*(const FVec4& v, FQuat const& q);
 
-    FQuat operator*(float const& s, FQuat const& q);
+    constexpr FQuat operator*(float const& s, FQuat const& q);
 
     std::ostream& operator<<(std::ostream& os, FQuat const& q);
 
     std::istream& operator>>(std::istream& is, FQuat& q);
-}
\ No newline at end of file
+}
+
+namespace lm
+{
+    inline constexpr FQuat FQuat::identity = FQuat(0, 0, 0, 1);
+
+    constexpr FQuat::FQuat() : x(0), y(0), z(0), w(0) {}
+
+    constexpr FQuat::FQuat(const float p_init) : x(p_init), y(p_init), z(p_init), w(0) {}
+
+    constexpr float FQuat::Length2(const FQuat& q)
+    {
+        return (q.x * q.x) + (q.y * q.y) + (q.z * q.z) + (q.w * q.w);
+    }
+
+    constexpr FQuat FQuat::Conjugate(const FQuat& q)
+    {
+        return FQuat(-q.x, -q.y, -q.z, q.w);
+    }
+
+    constexpr float FQuat::Dot(const FQuat& q1, const FQuat& q2)
+    {
+        return (q1.x * q2.x) + (q1.y * q2.y) + (q1.z * q2.z) + (q1.w * q2.w);
+    }
+
+    constexpr FQuat FQuat::Cross(const FQuat& q1, const FQuat& q2)
+    {
+        return FQuat(
+            (q1.w * q2.x) + (q1.x * q2.w) + (q1.y * q2.z) - (q1.z * q2.y),
+            (q1.w * q2.y) + (q1.y * q2.w) + (q1.z * q2.x) - (q1.x * q2.z),
+            (q1.w * q2.z) + (q1.z * q2.w) + (q1.x * q2.y) - (q1.y * q2.x),
+            (q1.w * q2.w) - (q1.x * q2.x) - (q1.y * q2.y) - (q1.z * q2.z)
+        );
+    }
+
+    constexpr FQuat FQuat::operator+=(FQuat const& q)
+    {
+#if LIBMATHS_USE_SSE
+        if (!std::is_constant_evaluated())
+        {
+            m_simd = _mm_add_ps(m_simd, q.m_simd);
+            return *this;
+        }
+#endif
+
+        x += q.x;
+        y += q.y;
+        z += q.z;
+        w += q.w;
+
+        return *this;
+    }
+
+    constexpr FQuat FQuat::operator-=(FQuat const& q)
+    {
+#if LIBMATHS_USE_SSE
+        if (!std::is_constant_evaluated())
+        {
+            m_simd = _mm_sub_ps(m_simd, q.m_simd);
+            return *this;
+        }
+#endif
+
+        x -= q.x;
+        y -= q.y;
+        z -= q.z;
+        w -= q.w;
+
+        return *this;
+    }
+
+    constexpr FQuat FQuat::operator*=(FQuat const& r)
+    {
+        *this = *this * r;
+        return *this;
+    }
+
+    constexpr FQuat FQuat::operator*=(const float s)
+    {
+#if LIBMATHS_USE_SSE
+        if (!std::is_constant_evaluated())
+        {
+            m_simd = _mm_mul_ps(m_simd, _mm_set1_ps(s));
+            return *this;
+        }
+#endif
+
+        x *= s;
+        y *= s;
+        z *= s;
+        w *= s;
+
+        return *this;
+    }
+
+    constexpr FQuat FQuat::operator-() const
+    {
+#if LIBMATHS_USE_SSE
+        if (!std::is_constant_evaluated())
+            return FQuat(_mm_xor_ps(m_simd, _mm_set1_ps(-0.0f)));
+#endif
+
+        return FQuat(-x, -y, -z, -w);
+    }
+
+    constexpr const FQuat FQuat::operator+(FQuat const& q) const
+    {
+        return FQuat(*this) += q;
+    }
+
+    constexpr const FQuat FQuat::operator-(FQuat const& q) const
+    {
+        return FQuat(*this) -= q;
+    }
+
+    constexpr const FQuat FQuat::operator*(FQuat const& p) const
+    {
+#if LIBMATHS_USE_SSE
+        if (!std::is_constant_evaluated())
+            return FQuat(simd::QuatMultiply(m_simd, p.m_simd));
+#endif
+
+        FQuat const q(*this);
+        return FQuat(
+            (q.w * p.x) + (q.x * p.w) + (q.y * p.z) - (q.z * p.y),
+            (q.w * p.y) + (q.y * p.w) + (q.z * p.x) - (q.x * p.z),
+            (q.w * p.z) + (q.z * p.w) + (q.x * p.y) - (q.y * p.x),
+            (q.w * p.w) - (q.x * p.x) - (q.y * p.y) - (q.z * p.z)
+        );
+    }
+
+    constexpr const FQuat FQuat::operator*(float const& s) const
+    {
+        return FQuat(*this) *= s;
+    }
+
+    constexpr bool FQuat::operator==(FQuat const& q) const
+    {
+        return x == q.x && y == q.y && z == q.z && w == q.w;
+    }
+
+    constexpr bool FQuat::operator!=(FQuat const& q) const
+    {
+        return x != q.x || y != q.y || z != q.z || w != q.w;
+    }
+
+    constexpr FQuat operator*(float const& s, FQuat const& q)
+    {
+        return q * s;
+    }
+}
+
+#if LIBMATHS_INLINE
+#include "FQuat.inl"
+#endif
@@ -0,0 +1,345 @@
+#pragma once
+
+/**
+ * Definitions of the FQuat functions: included by FQuat.hpp when LIBMATHS_INLINE is
+ * set, compiled once by FQuat.cpp otherwise
+*/
+
+#include "../LibMathsConfig.h"
+#include "FQuat.hpp"
+#include "../Mat3/FMat3.hpp"
+#include "../Mat4/FMat4.hpp"
+#include "../Vec3/FVec3.hpp"
+#include "../Vec4/FVec4.hpp"
+#include "../Utilities.h"
+
+namespace lm
+{
+    LIBMATHS_INLINE_API FQuat::FQuat(FVec3 axis, float angle)
+    {
+        float radAngle = TO_RADIANS(angle);
+        axis = FVec3::Normalize(axis);
+        float s = sin(radAngle / 2);
+        x = axis.x * s;
+        y = axis.y * s;
+        z = axis.z * s;
+        w = cos(radAngle / 2);
+    }
+
+    LIBMATHS_INLINE_API FQuat::FQuat(const FMat3& other) { *this = FromMatrix3(other); }
+
+    LIBMATHS_INLINE_API float& FQuat::operator[](const int index)
+    {
+        switch (index)
+        {
+        case 0:		return x;
+        case 1:		return y;
+        case 2:		return z;
+        case 3:		return w;
+
+        case 'x':	return x;
+        case 'y':	return y;
+        case 'z':	return z;
+        case 'w':	return w;
+
+        default:
+            throw std::runtime_error("Quaternion::operator[]: Invalide index or out of range");
+        }
+    }
+
+    LIBMATHS_INLINE_API const float FQuat::operator[](const int index) const
+    {
+        switch (index)
+        {
+        case 0:		return x;
+        case 1:		return y;
+        case 2:		return z;
+        case 3:		return w;
+
+        case 'x':	return x;
+        case 'y':	return y;
+        case 'z':	return z;
+        case 'w':	return w;
+
+        default:
+            throw std::runtime_error("Quaternion::operator[]: Invalide index or out of range");
+        }
+    }
+
+    LIBMATHS_INLINE_API float FQuat::Length(const FQuat& q)
+    {
+        return sqrt(Length2(q));
+    }
+
+    LIBMATHS_INLINE_API FQuat FQuat::Normalize(const FQuat& q)
+    {
+        float length = Length(q);
+        return FQuat(q.x / length, q.y / length, q.z / length, q.w / length);
+    }
+
+    LIBMATHS_INLINE_API FQuat FQuat::Inverse(const FQuat& q)
+    {
+        return Conjugate(q) / Length2(q);
+    }
+
+    LIBMATHS_INLINE_API FQuat FQuat::operator/=(const float s)
+    {
+        x /= s;
+        y /= s;
+        z /= s;
+        w /= s;
+
+        return *this;
+    }
+
+    LIBMATHS_INLINE_API const FVec3 FQuat::operator*(FVec3 const& v) const
+    {
+        // v + w * t + u x t with t = 2 * u x v, spelled out so no FVec3 function is called. Moving the
+        // vector in and out of a register costs more than the shuffles save, the batches use SIMD instead
+        const float tx = 2.0f * (y * v.z - z * v.y);
+        const float ty = 2.0f * (z * v.x - x * v.z);
+        const float tz = 2.0f * (x * v.y - y * v.x);
+
+        return FVec3(
+            v.x + w * tx + (y * tz - z * ty),
+            v.y + w * ty + (z * tx - x * tz),
+            v.z + w * tz + (x * ty - y * tx));
+    }
+
+    LIBMATHS_INLINE_API const FVec4 FQuat::operator*(FVec4 const& v) const
+    {
+        return FVec4(*this * FVec3(v.x, v.y, v.z), v.w);
+    }
+
+    LIBMATHS_INLINE_API const FQuat FQuat::operator/(const float s) const
+    {
+        return FQuat(
+            x / s, y / s, z / s, w / s);
+    }
+
+    LIBMATHS_INLINE_API bool FQuat::isUnit() const
+    {
+        return Dot(*this, *this) == 1;
+    }
+
+    LIBMATHS_INLINE_API float FQuat::getAngle() const
+    {
+        if (abs(w) > cosf(TO_RADIANS(0.5f))) {
+            return std::asin(sqrtf(x * x + y * y + z * z)) * 2.f;
+        }
+        return float(2.f * acos(w));
+    }
+
+    LIBMATHS_INLINE_API float FQuat::getAngle(FQuat const& q) const
+    {
+        return float(2 * acos(Dot(*this, q)));
+    }
+
+    LIBMATHS_INLINE_API FQuat FQuat::Rotate(FQuat const& q, FVec3 const& v)
+    {
+        FQuat qv = FQuat(v.x, v.y, v.z, 0);
+        return q * qv * Inverse(q);
+    }
+
+    LIBMATHS_INLINE_API FQuat FQuat::Rotate(FQuat const& p, FQuat const& q)
+    {
+        return p * q * Inverse(p);
+    }
+
+    LIBMATHS_INLINE_API FQuat FQuat::Rotate(FQuat const& q, FVec3 const& v, float const& angle)
+    {
+        return Rotate(q, FQuat(v, angle));
+    }
+
+    LIBMATHS_INLINE_API FQuat FQuat::FromEuler(const FVec3& euler)
+    {
+        return FromEuler(euler.x, euler.y, euler.z);
+    }
+
+    LIBMATHS_INLINE_API FQuat FQuat::FromEuler(float pitch, float yaw, float roll)
+    {
+        FQuat qPitch({ 1,0,0 }, pitch);
+        FQuat qYaw({ 0,1,0 }, yaw);
+        FQuat qRoll({ 0,0,1 }, roll);
+
+        return Normalize(qRoll * qYaw * qPitch);
+    }
+
+    LIBMATHS_INLINE_API FMat3 FQuat::ToRotateMat3(FQuat const& p_q)
+    {
+        FQuat q = Normalize(p_q);
+        FMat3 Result = FMat3::Identity();
+        float xx = q.x * q.x;
+        float xy = q.x * q.y;
+        float xz = q.x * q.z;
+        float xw = q.x * q.w;
+        float yy = q.y * q.y;
+        float yz = q.y * q.z;
+        float yw = q.y * q.w;
+        float zz = q.z * q.z;
+        float zw = q.z * q.w;
+
+        Result[0][0] = float(1) - float(2) * (yy + zz);
+        Result[0][1] = float(2) * (xy + zw);
+        Result[0][2] = float(2) * (xz - yw);
+
+        Result[1][0] = float(2) * (xy - zw);
+        Result[1][1] = float(1) - float(2) * (xx + zz);
+        Result[1][2] = float(2) * (yz + xw);
+
+        Result[2][0] = float(2) * (xz + yw);
+        Result[2][1] = float(2) * (yz - xw);
+        Result[2][2] = float(1) - float(2) * (xx + yy);
+        return Result;
+    }
+
+    LIBMATHS_INLINE_API FQuat FQuat::FromMatrix3(FMat3 const& m)
+    {
+        FQuat result;
+        float t;
+
+        if (m[2][2] < 0)
+        {
+            if (m[0][0] > m[1][1])
+            {
+                t = 1 + m[0][0] - m[1][1] - m[2][2];
+                result = FQuat(t, m[0][1] + m[1][0], m[2][0] + m[0][2], m[1][2] - m[2][1]);
+            }
+            else
+            {
+                t = 1 - m[0][0] + m[1][1] - m[2][2];
+                result = FQuat(m[0][1] + m[1][0], t, m[1][2] + m[2][1], m[2][0] - m[0][2]);
+            }
+        }
+        else
+        {
+            if (m[0][0] < -m[1][1])
+            {
+                t = 1 - m[0][0] - m[1][1] + m[2][2];
+                result = FQuat(m[2][0] + m[0][2], m[1][2] + m[2][1], t, m[0][1] - m[1][0]);
+            }
+            else
+            {
+                t = 1 + m[0][0] + m[1][1] + m[2][2];
+                result = FQuat(m[1][2] - m[2][1], m[2][0] - m[0][2], m[0][1] - m[1][0], t);
+            }
+        }
+
+        result = result * (0.5f / sqrtf(t));
+        return result;
+    }
+
+    LIBMATHS_INLINE_API FQuat FQuat::Lerp(FQuat const& q1, FQuat const& q2, float t)
+    {
+        float alpha = clamp(t, 0.0f, 1.0f);
+        FQuat q = q1 + alpha * (q2 - q1);
+        return q;
+    }
+
+    LIBMATHS_INLINE_API FQuat FQuat::NLerp(FQuat const& q1, FQuat const& q2, float t)
+    {
+        float alpha = clamp(t, 0.0f, 1.0f);
+        FQuat q;
+
+        float dot = FQuat::Dot(q1, q2);
+        if (dot < 0)
+        {
+            q = q1 + alpha * (-q2 - q1);
+        }
+        else
+        {
+            q = q1 + alpha * (q2 - q1);
+        }
+        return FQuat::Normalize(q);
+    }
+
+    LIBMATHS_INLINE_API FQuat FQuat::SLerp(FQuat const& q1, FQuat const& q2, float t)
+    {
+        FQuat from = q1;
+        FQuat to = q2;
+
+        t = clamp(t, 0.f, 1.f);
+        float cosAngle = FQuat::Dot(from, to);
+
+        if (cosAngle < 0.f)
+        {
+            cosAngle = -cosAngle;
+            to = FQuat(-to.x, -to.y, -to.z, -to.w);
+        }
+
+        if (cosAngle < 0.95f)
+        {
+            float angle = std::acos(cosAngle);
+            float sinAngle = std::sin(angle);
+            float invSinAngle = 1.f / sinAngle;
+            float t1 = std::sin((1 - t) * angle) * invSinAngle;
+            float t2 = std::sin(t * angle) * invSinAngle;
+            return FQuat(from.x * t1 + to.x * t2, from.y * t1 + to.y * t2, from.z * t1 + to.z * t2, from.w * t1 + to.w * t2);
+        }
+        else
+        {
+            return FQuat::Lerp(from, to, t);
+        }
+    }
+
+    LIBMATHS_INLINE_API FQuat FQuat::SLerpFast(FQuat const& q1, FQuat const& q2, float t)
+    {
+        t = clamp(t, 0.f, 1.f);
+        const float cosAngle = FQuat::Dot(q1, q2);
+        const float d = std::fabs(cosAngle);
+
+        // "Approximating slerp", Arseny Kapoulkine: t + t (t - 1/2) (t - 1) k, zero at 0, 1/2 and 1
+        const float a = 1.0904f + d * (-3.2452f + d * (3.55645f - d * 1.43519f));
+        const float b = 0.848013f + d * (-1.06021f + d * 0.215638f);
+        const float k = a * (t - 0.5f) * (t - 0.5f) + b;
+        const float alpha = t + t * (t - 0.5f) * (t - 1.f) * k;
+
+        // q2 or -q2, whichever is on the side of q1
+        return FQuat::Normalize(q1 * (1.f - alpha) + q2 * std::copysign(alpha, cosAngle));
+    }
+
+    LIBMATHS_INLINE_API FVec3 operator*(const FVec3& v, FQuat const& q)
+    {
+        return FQuat::Inverse(q) * v;
+    }
+
+    LIBMATHS_INLINE_API FVec4 operator*(const FVec4& v, FQuat const& q)
+    {
+        return FQuat::Inverse(q) * v;
+    }
+
+    LIBMATHS_INLINE_API std::ostream& operator<<(std::ostream& os, FQuat const& q)
+    {
+        os << "FQuat(" << q.x << ", " << q.y << ", " << q.z << ", " << q.w << ")";
+        return os;
+    }
+
+    LIBMATHS_INLINE_API std::istream& operator>>(std::istream& is, FQuat& q)
+    {
+        char c;
+
+        // Remove "FQuat("
+        for (int i = 0; i < 11; ++i)
+        {
+            is >> c;
+        }
+
+        is >> q.x;
+
+        is >> c;
+
+        is >> q.y;
+
+        is >> c;
+
+        is >> q.z;
+
+        is >> c;
+
+        is >> q.w;
+
+        is >> c;
+
+        return is;
+    }
+}
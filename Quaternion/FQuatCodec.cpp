@@ -0,0 +1,79 @@
+#include "FQuatCodec.hpp"
+#include "../SIMD/Dispatch.hpp"
+#include "../SIMD/QuatCodecKernels.h"
+
+#include <cstring>
+#include <stdexcept>
+
+using namespace lm;
+
+uint32_t lm::FQuatCodec::Encode32(const FQuat& p_rotation)
+{
+    return simd::QuatEncode32Scalar(&p_rotation.x);
+}
+
+FQuat lm::FQuatCodec::Decode32(uint32_t p_code)
+{
+    FQuat result;
+    simd::QuatDecode32Scalar(p_code, &result.x);
+    return result;
+}
+
+FPackedQuat48 lm::FQuatCodec::Encode48(const FQuat& p_rotation)
+{
+    uint16_t words[3];
+    simd::QuatEncode48Scalar(&p_rotation.x, words);
+
+    // Merged in a register, three 16 bits stores read back as the returned 64 bits would stall
+    const uint64_t bits = words[0] | static_cast<uint64_t>(words[1]) << 16 | static_cast<uint64_t>(words[2]) << 32;
+    FPackedQuat48 result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+FQuat lm::FQuatCodec::Decode48(const FPackedQuat48& p_code)
+{
+    FQuat result;
+    simd::QuatDecode48Scalar(p_code.m_words, &result.x);
+    return result;
+}
+
+void lm::FQuatCodec::Encode32(std::span<const FQuat> p_rotations, std::span<uint32_t> p_codes)
+{
+    if (p_rotations.size() != p_codes.size())
+    {
+        throw std::logic_error("FQuatCodec::Encode32: spans must have the same size");
+    }
+
+    simd::Kernels().quatEncode32(p_rotations.data(), p_codes.data(), p_codes.size());
+}
+
+void lm::FQuatCodec::Decode32(std::span<const uint32_t> p_codes, std::span<FQuat> p_rotations)
+{
+    if (p_codes.size() != p_rotations.size())
+    {
+        throw std::logic_error("FQuatCodec::Decode32: spans must have the same size");
+    }
+
+    simd::Kernels().quatDecode32(p_codes.data(), p_rotations.data(), p_rotations.size());
+}
+
+void lm::FQuatCodec::Encode48(std::span<const FQuat> p_rotations, std::span<FPackedQuat48> p_codes)
+{
+    if (p_rotations.size() != p_codes.size())
+    {
+        throw std::logic_error("FQuatCodec::Encode48: spans must have the same size");
+    }
+
+    simd::Kernels().quatEncode48(p_rotations.data(), reinterpret_cast<uint16_t*>(p_codes.data()), p_codes.size());
+}
+
+void lm::FQuatCodec::Decode48(std::span<const FPackedQuat48> p_codes, std::span<FQuat> p_rotations)
+{
+    if (p_codes.size() != p_rotations.size())
+    {
+        throw std::logic_error("FQuatCodec::Decode48: spans must have the same size");
+    }
+
+    simd::Kernels().quatDecode48(reinterpret_cast<const uint16_t*>(p_codes.data()), p_rotations.data(), p_rotations.size());
+}
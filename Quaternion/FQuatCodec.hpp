@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "FQuat.hpp"
+
+namespace lm
+{
+    /**
+     * @brief A unit quaternion packed in 48 bits by FQuatCodec::Encode48
+    */
+    struct FPackedQuat48
+    {
+        uint16_t m_words[3];
+
+        bool operator==(const FPackedQuat48& p_other) const = default;
+    };
+
+    static_assert(sizeof(FPackedQuat48) == 6, "FPackedQuat48 arrays must be packed 6 bytes records");
+
+    /**
+     * @brief Smallest three compression of unit quaternions, in 32 or 48 bits instead of 16 bytes
+     * @details The component of largest magnitude is dropped and rebuilt from the unit length, its
+     * index and sign are stored with the three others quantized over [-1/sqrt(2), 1/sqrt(2)]: 10, 10
+     * and 9 bits in 32 bits, 15 bits each in 48 bits. The sign is kept, a decoded quaternion is in
+     * the hemisphere of the encoded one, so it can still be blended with its neighbours.
+     * Zero is a quantization level, so the identity and the half turns about an axis decode exactly.
+     * From the quantization steps, the decoded rotation is within (largest error measured over a
+     * million random rotations by Tests/QuatCodecTests.cpp in parentheses):
+     * - 32 bits: 6.5e-3 radians, 0.37 degrees (5.8e-3), components within 2.8e-3 (2.4e-3)
+     * - 48 bits: 1.5e-4 radians, 0.0086 degrees (1.3e-4), components within 6.5e-5 (5.7e-5)
+     * @note The quaternions must be normalized. The batch functions give the same codes and
+     * quaternions as the single value ones, up to a rounding on the rebuilt component
+    */
+    struct FQuatCodec
+    {
+        static uint32_t Encode32(const FQuat& p_rotation);
+        static FQuat Decode32(uint32_t p_code);
+
+        static FPackedQuat48 Encode48(const FQuat& p_rotation);
+        static FQuat Decode48(const FPackedQuat48& p_code);
+
+        /**
+         * @brief Encodes every rotation of p_rotations, VFloat::Width at a time
+         * @note The two spans must have the same size
+        */
+        static void Encode32(std::span<const FQuat> p_rotations, std::span<uint32_t> p_codes);
+        static void Decode32(std::span<const uint32_t> p_codes, std::span<FQuat> p_rotations);
+
+        static void Encode48(std::span<const FQuat> p_rotations, std::span<FPackedQuat48> p_codes);
+        static void Decode48(std::span<const FPackedQuat48> p_codes, std::span<FQuat> p_rotations);
+    };
+}
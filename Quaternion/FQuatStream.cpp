@@ -0,0 +1,232 @@
+#include "FQuatStream.hpp"
+#include "../SIMD/Dispatch.hpp"
+
+#include <stdexcept>
+#include <string>
+
+using namespace lm;
+
+static constexpr int s_components = 4;
+
+using InterpolateKernel = void (*)(const float* const*, const float* const*, const float*, float, float* const*, size_t);
+
+/**
+ * Runs an interpolation kernel over the p_start.Size() elements, p_alphas may be null
+*/
+static void Interpolate(const FQuatStream& p_start, const FQuatStream& p_end, const float* p_alphas, float p_alpha, FQuatStream& p_result,
+    const char* p_function, InterpolateKernel p_kernel)
+{
+    if (p_start.Size() != p_end.Size())
+    {
+        throw std::logic_error(std::string(p_function) + ": streams must have the same size");
+    }
+
+    p_result.Resize(p_start.Size());
+
+    const float* const start[] = { p_start.X(), p_start.Y(), p_start.Z(), p_start.W() };
+    const float* const end[] = { p_end.X(), p_end.Y(), p_end.Z(), p_end.W() };
+    float* const result[] = { p_result.X(), p_result.Y(), p_result.Z(), p_result.W() };
+    p_kernel(start, end, p_alphas, p_alpha, result, p_start.Size());
+}
+
+lm::FQuatStream::Reference::operator FQuat() const
+{
+    return FQuat(x, y, z, w);
+}
+
+FQuatStream::Reference& lm::FQuatStream::Reference::operator=(const FQuat& p_value)
+{
+    x = p_value.x;
+    y = p_value.y;
+    z = p_value.z;
+    w = p_value.w;
+    return *this;
+}
+
+FQuatStream::Reference& lm::FQuatStream::Reference::operator=(const Reference& p_other)
+{
+    return *this = static_cast<FQuat>(p_other);
+}
+
+lm::FQuatStream::FQuatStream() : m_lanes(s_components)
+{
+}
+
+lm::FQuatStream::FQuatStream(size_t p_size) : m_lanes(s_components)
+{
+    m_lanes.Resize(p_size);
+}
+
+lm::FQuatStream::FQuatStream(std::span<const FQuat> p_values) : m_lanes(s_components)
+{
+    Load(p_values);
+}
+
+FQuatStream::Reference lm::FQuatStream::operator[](size_t p_index)
+{
+    if (p_index >= Size())
+    {
+        throw std::out_of_range("FQuatStream: index out of range");
+    }
+
+    return Reference{ X()[p_index], Y()[p_index], Z()[p_index], W()[p_index] };
+}
+
+FQuat lm::FQuatStream::operator[](size_t p_index) const
+{
+    if (p_index >= Size())
+    {
+        throw std::out_of_range("FQuatStream: index out of range");
+    }
+
+    return FQuat(X()[p_index], Y()[p_index], Z()[p_index], W()[p_index]);
+}
+
+size_t lm::FQuatStream::Size() const
+{
+    return m_lanes.Size();
+}
+
+void lm::FQuatStream::Resize(size_t p_size)
+{
+    m_lanes.Resize(p_size);
+}
+
+float* lm::FQuatStream::X() { return m_lanes.Lane(0); }
+float* lm::FQuatStream::Y() { return m_lanes.Lane(1); }
+float* lm::FQuatStream::Z() { return m_lanes.Lane(2); }
+float* lm::FQuatStream::W() { return m_lanes.Lane(3); }
+const float* lm::FQuatStream::X() const { return m_lanes.Lane(0); }
+const float* lm::FQuatStream::Y() const { return m_lanes.Lane(1); }
+const float* lm::FQuatStream::Z() const { return m_lanes.Lane(2); }
+const float* lm::FQuatStream::W() const { return m_lanes.Lane(3); }
+
+void lm::FQuatStream::Load(std::span<const FQuat> p_values)
+{
+    m_lanes.Resize(p_values.size());
+
+    float* const lanes[] = { X(), Y(), Z(), W() };
+    simd::Kernels().streamDeinterleave(reinterpret_cast<const float*>(p_values.data()), s_components, lanes, p_values.size());
+}
+
+void lm::FQuatStream::Store(std::span<FQuat> p_result) const
+{
+    if (p_result.size() != Size())
+    {
+        throw std::logic_error("FQuatStream::Store: span must have the size of the stream");
+    }
+
+    const float* const lanes[] = { X(), Y(), Z(), W() };
+    simd::Kernels().streamInterleave(lanes, s_components, reinterpret_cast<float*>(p_result.data()), p_result.size());
+}
+
+void lm::FQuatStream::Add(const FQuatStream& p_left, const FQuatStream& p_right, FQuatStream& p_result)
+{
+    if (p_left.Size() != p_right.Size())
+    {
+        throw std::logic_error("FQuatStream::Add: streams must have the same size");
+    }
+
+    p_result.Resize(p_left.Size());
+
+    for (int lane = 0; lane < s_components; lane++)
+        simd::Kernels().streamAdd(p_left.m_lanes.Lane(lane), p_right.m_lanes.Lane(lane), p_result.m_lanes.Lane(lane), p_result.m_lanes.PaddedSize());
+}
+
+void lm::FQuatStream::Scale(const FQuatStream& p_values, float p_scale, FQuatStream& p_result)
+{
+    p_result.Resize(p_values.Size());
+
+    for (int lane = 0; lane < s_components; lane++)
+        simd::Kernels().streamScale(p_values.m_lanes.Lane(lane), p_scale, p_result.m_lanes.Lane(lane), p_result.m_lanes.PaddedSize());
+}
+
+void lm::FQuatStream::Dot(const FQuatStream& p_left, const FQuatStream& p_right, std::span<float> p_result)
+{
+    if (p_left.Size() != p_right.Size() || p_left.Size() != p_result.size())
+    {
+        throw std::logic_error("FQuatStream::Dot: streams and result must have the same size");
+    }
+
+    const float* const left[] = { p_left.X(), p_left.Y(), p_left.Z(), p_left.W() };
+    const float* const right[] = { p_right.X(), p_right.Y(), p_right.Z(), p_right.W() };
+    simd::Kernels().streamDot(left, right, s_components, p_result.data(), p_result.size());
+}
+
+void lm::FQuatStream::Length(const FQuatStream& p_values, std::span<float> p_result)
+{
+    if (p_values.Size() != p_result.size())
+    {
+        throw std::logic_error("FQuatStream::Length: stream and result must have the same size");
+    }
+
+    const float* const values[] = { p_values.X(), p_values.Y(), p_values.Z(), p_values.W() };
+    simd::Kernels().streamLength(values, s_components, p_result.data(), p_result.size());
+}
+
+void lm::FQuatStream::Normalize(const FQuatStream& p_values, FQuatStream& p_result)
+{
+    p_result.Resize(p_values.Size());
+
+    const float* const values[] = { p_values.X(), p_values.Y(), p_values.Z(), p_values.W() };
+    float* const result[] = { p_result.X(), p_result.Y(), p_result.Z(), p_result.W() };
+    simd::Kernels().streamNormalize(values, s_components, result, p_result.m_lanes.PaddedSize());
+}
+
+void lm::FQuatStream::Lerp(const FQuatStream& p_start, const FQuatStream& p_end, float p_alpha, FQuatStream& p_result)
+{
+    if (p_start.Size() != p_end.Size())
+    {
+        throw std::logic_error("FQuatStream::Lerp: streams must have the same size");
+    }
+
+    p_result.Resize(p_start.Size());
+
+    for (int lane = 0; lane < s_components; lane++)
+        simd::Kernels().streamLerp(p_start.m_lanes.Lane(lane), p_end.m_lanes.Lane(lane), p_alpha, p_result.m_lanes.Lane(lane), p_result.m_lanes.PaddedSize());
+}
+
+void lm::FQuatStream::NLerp(const FQuatStream& p_start, const FQuatStream& p_end, float p_alpha, FQuatStream& p_result)
+{
+    Interpolate(p_start, p_end, nullptr, p_alpha, p_result, "FQuatStream::NLerp", simd::Kernels().quatStreamNLerp);
+}
+
+void lm::FQuatStream::NLerp(const FQuatStream& p_start, const FQuatStream& p_end, std::span<const float> p_alphas, FQuatStream& p_result)
+{
+    if (p_alphas.size() != p_start.Size())
+    {
+        throw std::logic_error("FQuatStream::NLerp: alphas and streams must have the same size");
+    }
+
+    Interpolate(p_start, p_end, p_alphas.data(), 0.0f, p_result, "FQuatStream::NLerp", simd::Kernels().quatStreamNLerp);
+}
+
+void lm::FQuatStream::SLerp(const FQuatStream& p_start, const FQuatStream& p_end, float p_alpha, FQuatStream& p_result)
+{
+    Interpolate(p_start, p_end, nullptr, p_alpha, p_result, "FQuatStream::SLerp", simd::Kernels().quatStreamSLerp);
+}
+
+void lm::FQuatStream::SLerp(const FQuatStream& p_start, const FQuatStream& p_end, std::span<const float> p_alphas, FQuatStream& p_result)
+{
+    if (p_alphas.size() != p_start.Size())
+    {
+        throw std::logic_error("FQuatStream::SLerp: alphas and streams must have the same size");
+    }
+
+    Interpolate(p_start, p_end, p_alphas.data(), 0.0f, p_result, "FQuatStream::SLerp", simd::Kernels().quatStreamSLerp);
+}
+
+void lm::FQuatStream::SLerpFast(const FQuatStream& p_start, const FQuatStream& p_end, float p_alpha, FQuatStream& p_result)
+{
+    Interpolate(p_start, p_end, nullptr, p_alpha, p_result, "FQuatStream::SLerpFast", simd::Kernels().quatStreamSLerpFast);
+}
+
+void lm::FQuatStream::SLerpFast(const FQuatStream& p_start, const FQuatStream& p_end, std::span<const float> p_alphas, FQuatStream& p_result)
+{
+    if (p_alphas.size() != p_start.Size())
+    {
+        throw std::logic_error("FQuatStream::SLerpFast: alphas and streams must have the same size");
+    }
+
+    Interpolate(p_start, p_end, p_alphas.data(), 0.0f, p_result, "FQuatStream::SLerpFast", simd::Kernels().quatStreamSLerpFast);
+}
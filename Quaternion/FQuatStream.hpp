@@ -0,0 +1,178 @@
+#pragma once
+
+#include <span>
+
+#include "FQuat.hpp"
+#include "../SIMD/LaneBuffer.hpp"
+
+namespace lm
+{
+    /**
+     * Structure of arrays storage of FQuat: the x, y, z and w components live in 4 aligned arrays
+     * @note The operations run VFloat::Width elements at a time on the batch kernels
+    */
+    struct FQuatStream
+    {
+        /**
+         * Proxy to one element, reads and writes go to the component arrays
+        */
+        struct Reference
+        {
+            float& x;
+            float& y;
+            float& z;
+            float& w;
+
+            operator FQuat() const;
+            Reference& operator=(const FQuat& p_value);
+            Reference& operator=(const Reference& p_other);
+        };
+
+        /**
+         * @brief Creates an empty stream
+        */
+        FQuatStream();
+
+        /**
+         * @brief Creates a stream of p_size zero quaternions
+         * @param p_size The number of elements
+        */
+        explicit FQuatStream(size_t p_size);
+
+        /**
+         * @brief Creates a stream from an array of quaternions
+         * @param p_values The quaternions to copy
+        */
+        explicit FQuatStream(std::span<const FQuat> p_values);
+
+        Reference operator[](size_t p_index);
+        FQuat operator[](size_t p_index) const;
+
+        /**
+         * @brief Returns the number of elements
+        */
+        size_t Size() const;
+
+        /**
+         * @brief Changes the number of elements, new elements are zero quaternions
+         * @param p_size The number of elements
+        */
+        void Resize(size_t p_size);
+
+        float* X();
+        float* Y();
+        float* Z();
+        float* W();
+        const float* X() const;
+        const float* Y() const;
+        const float* Z() const;
+        const float* W() const;
+
+        /**
+         * @brief Replaces the elements with an array of quaternions
+         * @param p_values The quaternions to copy
+        */
+        void Load(std::span<const FQuat> p_values);
+
+        /**
+         * @brief Copies the elements to an array of quaternions
+         * @param p_result Receives the quaternions, must have the size of the stream
+        */
+        void Store(std::span<FQuat> p_result) const;
+
+        /**
+         * @brief Adds two streams element-wise
+         * @param p_left The first stream
+         * @param p_right The second stream, must have the size of p_left
+         * @param p_result Receives the sums, resized to p_left and allowed to be either operand
+        */
+        static void Add(const FQuatStream& p_left, const FQuatStream& p_right, FQuatStream& p_result);
+
+        /**
+         * @brief Multiplies every element by a scalar
+         * @param p_values The stream to scale
+         * @param p_scale The scalar
+         * @param p_result Receives the scaled quaternions, may be p_values
+        */
+        static void Scale(const FQuatStream& p_values, float p_scale, FQuatStream& p_result);
+
+        /**
+         * @brief Computes the dot product of each pair of elements
+         * @param p_left The first stream
+         * @param p_right The second stream, must have the size of p_left
+         * @param p_result Receives the dot products, must have the size of p_left
+        */
+        static void Dot(const FQuatStream& p_left, const FQuatStream& p_right, std::span<float> p_result);
+
+
+        /**
+         * @brief Computes the length of each element
+         * @param p_values The stream
+         * @param p_result Receives the lengths, must have the size of p_values
+        */
+        static void Length(const FQuatStream& p_values, std::span<float> p_result);
+
+        /**
+         * @brief Normalizes each element, zero quaternions stay zero
+         * @param p_values The stream
+         * @param p_result Receives the unit quaternions, may be p_values
+        */
+        static void Normalize(const FQuatStream& p_values, FQuatStream& p_result);
+
+        /**
+         * @brief Interpolates each pair of elements
+         * @param p_start The stream at p_alpha = 0
+         * @param p_end The stream at p_alpha = 1, must have the size of p_start
+         * @param p_alpha The interpolation factor
+         * @param p_result Receives the interpolated quaternions, may be either operand
+        */
+        static void Lerp(const FQuatStream& p_start, const FQuatStream& p_end, float p_alpha, FQuatStream& p_result);
+
+        /**
+         * @brief Interpolates each pair of elements through the shortest arc then normalizes, like FQuat::NLerp
+         * @param p_start The stream at p_alpha = 0
+         * @param p_end The stream at p_alpha = 1, must have the size of p_start
+         * @param p_alpha The interpolation factor, clamped to [0, 1]
+         * @param p_result Receives the interpolated quaternions, may be either operand
+        */
+        static void NLerp(const FQuatStream& p_start, const FQuatStream& p_end, float p_alpha, FQuatStream& p_result);
+
+        /**
+         * @brief Same as NLerp with an interpolation factor per element
+         * @param p_alphas The interpolation factors, must have the size of p_start
+        */
+        static void NLerp(const FQuatStream& p_start, const FQuatStream& p_end, std::span<const float> p_alphas, FQuatStream& p_result);
+
+        /**
+         * @brief Spherical interpolation of each pair of unit quaternions through the shortest arc
+         * @param p_start The stream at p_alpha = 0
+         * @param p_end The stream at p_alpha = 1, must have the size of p_start
+         * @param p_alpha The interpolation factor, clamped to [0, 1]
+         * @param p_result Receives the interpolated quaternions, may be either operand
+         * @note Unlike FQuat::SLerp, which switches to an unnormalized Lerp below a cosine of 0.95, the
+         * spherical weights are used down to 1.4e-3 radians between the quaternions
+        */
+        static void SLerp(const FQuatStream& p_start, const FQuatStream& p_end, float p_alpha, FQuatStream& p_result);
+
+        /**
+         * @brief Same as SLerp with an interpolation factor per element
+         * @param p_alphas The interpolation factors, must have the size of p_start
+        */
+        static void SLerp(const FQuatStream& p_start, const FQuatStream& p_end, std::span<const float> p_alphas, FQuatStream& p_result);
+
+        /**
+         * @brief Same as SLerp at the cost of NLerp, the alphas of a normalized lerp are corrected by a polynomial
+         * @note The result is within 7.8e-4 radians (0.045 degrees) of the rotation given by SLerp, NLerp is up to 0.14 radians off
+        */
+        static void SLerpFast(const FQuatStream& p_start, const FQuatStream& p_end, float p_alpha, FQuatStream& p_result);
+
+        /**
+         * @brief Same as SLerpFast with an interpolation factor per element
+         * @param p_alphas The interpolation factors, must have the size of p_start
+        */
+        static void SLerpFast(const FQuatStream& p_start, const FQuatStream& p_end, std::span<const float> p_alphas, FQuatStream& p_result);
+
+    private:
+        simd::FLaneBuffer m_lanes;
+    };
+}
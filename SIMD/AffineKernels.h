@@ -0,0 +1,302 @@
+#pragma once
+
+#include <cstddef>
+
+#include "SIMD.h"
+#include "VFloat.h"
+#include "../Affine/FAffine34.hpp"
+#include "../Vec3/FVec3.hpp"
+
+/**
+ * FAffine34 kernels shared by the FAffine34 entry points.
+ *
+ * Row i of a transform holds linear row i in x, y, z and translation i in w.
+ * The batch kernels move VFloat::Width transforms to structure of arrays with
+ * a stride of 12 floats, the remaining ones use the single transform kernels.
+*/
+namespace lm::simd::inline LIBMATHS_ISA_NAMESPACE
+{
+    static_assert(sizeof(FAffine34) == 12 * sizeof(float), "FAffine34 arrays must be packed 3x4 records");
+
+    /**
+     * Compute p_left * p_right into p_result, 36 multiplies
+     * @note p_result may alias either operand
+    */
+    LIBMATHS_FORCEINLINE void Affine34Multiply(const FAffine34& p_left, const FAffine34& p_right, FAffine34& p_result)
+    {
+#if LIBMATHS_USE_SSE
+        const __m128 right0 = p_right.m_rows[0].m_simd;
+        const __m128 right1 = p_right.m_rows[1].m_simd;
+        const __m128 right2 = p_right.m_rows[2].m_simd;
+        const __m128 left[3] = { p_left.m_rows[0].m_simd, p_left.m_rows[1].m_simd, p_left.m_rows[2].m_simd };
+        const __m128 translationMask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+
+        for (int row = 0; row < 3; row++)
+        {
+            // Linear row * right rows, plus the left translation in w
+            __m128 result = _mm_add_ps(_mm_mul_ps(Swizzle<0, 0, 0, 0>(left[row]), right0), _mm_and_ps(left[row], translationMask));
+            result = MulAdd(Swizzle<1, 1, 1, 1>(left[row]), right1, result);
+            p_result.m_rows[row].m_simd = MulAdd(Swizzle<2, 2, 2, 2>(left[row]), right2, result);
+        }
+#else
+        const float* left = &p_left.m_rows[0].x;
+        const float* right = &p_right.m_rows[0].x;
+        float result[12];
+
+        for (int row = 0; row < 3; row++)
+        {
+            for (int column = 0; column < 4; column++)
+            {
+                result[row * 4 + column] = left[row * 4] * right[column] + left[row * 4 + 1] * right[4 + column] + left[row * 4 + 2] * right[8 + column];
+            }
+
+            result[row * 4 + 3] += left[row * 4 + 3];
+        }
+
+        float* destination = &p_result.m_rows[0].x;
+
+        for (int i = 0; i < 12; i++)
+            destination[i] = result[i];
+#endif
+    }
+
+    /**
+     * Compute the inverse of p_transform into p_result: the 3x3 inverse from cross products, then
+     * the translation moved through it
+     * @note p_result may alias p_transform
+    */
+    LIBMATHS_FORCEINLINE void Affine34Inverse(const FAffine34& p_transform, FAffine34& p_result)
+    {
+#if LIBMATHS_USE_SSE
+        const __m128 row0 = p_transform.m_rows[0].m_simd;
+        const __m128 row1 = p_transform.m_rows[1].m_simd;
+        const __m128 row2 = p_transform.m_rows[2].m_simd;
+
+        // Cross products of the rows are the columns of the adjugate
+        __m128 column0 = Cross3(row1, row2);
+        __m128 column1 = Cross3(row2, row0);
+        __m128 column2 = Cross3(row0, row1);
+
+        const __m128 linearMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+        const __m128 oneOverDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), Dot4(_mm_and_ps(row0, linearMask), column0));
+
+        column0 = _mm_mul_ps(column0, oneOverDeterminant);
+        column1 = _mm_mul_ps(column1, oneOverDeterminant);
+        column2 = _mm_mul_ps(column2, oneOverDeterminant);
+
+        // -inverse(L) * t, as a combination of the columns of inverse(L)
+        __m128 translation = _mm_mul_ps(column0, Swizzle<3, 3, 3, 3>(row0));
+        translation = MulAdd(column1, Swizzle<3, 3, 3, 3>(row1), translation);
+        translation = MulAdd(column2, Swizzle<3, 3, 3, 3>(row2), translation);
+        translation = _mm_sub_ps(_mm_setzero_ps(), translation);
+
+        _MM_TRANSPOSE4_PS(column0, column1, column2, translation);
+
+        p_result.m_rows[0].m_simd = column0;
+        p_result.m_rows[1].m_simd = column1;
+        p_result.m_rows[2].m_simd = column2;
+#else
+        const float* m = &p_transform.m_rows[0].x;
+
+        const float c00 = m[5] * m[10] - m[6] * m[9];
+        const float c01 = m[6] * m[8] - m[4] * m[10];
+        const float c02 = m[4] * m[9] - m[5] * m[8];
+        const float c10 = m[9] * m[2] - m[10] * m[1];
+        const float c11 = m[10] * m[0] - m[8] * m[2];
+        const float c12 = m[8] * m[1] - m[9] * m[0];
+        const float c20 = m[1] * m[6] - m[2] * m[5];
+        const float c21 = m[2] * m[4] - m[0] * m[6];
+        const float c22 = m[0] * m[5] - m[1] * m[4];
+
+        const float oneOverDeterminant = 1.0f / (m[0] * c00 + m[1] * c01 + m[2] * c02);
+
+        // Row i of the inverse is component i of the three adjugate columns
+        const float inverse[3][3] =
+        {
+            { c00 * oneOverDeterminant, c10 * oneOverDeterminant, c20 * oneOverDeterminant },
+            { c01 * oneOverDeterminant, c11 * oneOverDeterminant, c21 * oneOverDeterminant },
+            { c02 * oneOverDeterminant, c12 * oneOverDeterminant, c22 * oneOverDeterminant }
+        };
+
+        const float tx = m[3];
+        const float ty = m[7];
+        const float tz = m[11];
+        float* destination = &p_result.m_rows[0].x;
+
+        for (int row = 0; row < 3; row++)
+        {
+            destination[row * 4] = inverse[row][0];
+            destination[row * 4 + 1] = inverse[row][1];
+            destination[row * 4 + 2] = inverse[row][2];
+            destination[row * 4 + 3] = -(inverse[row][0] * tx + inverse[row][1] * ty + inverse[row][2] * tz);
+        }
+#endif
+    }
+
+    /**
+     * Compose p_count pairs of transforms
+     * @note p_result may be one of the inputs but must not overlap them partially
+    */
+    inline void Affine34MultiplyBatch(const FAffine34* p_left, const FAffine34* p_right, FAffine34* p_result, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        if constexpr (width > 1)
+        {
+            for (; i + width <= p_count; i += width)
+            {
+                VFloat left[3][4];
+                VFloat right[3][4];
+                VFloat result[3][4];
+
+                for (int row = 0; row < 3; row++)
+                {
+                    LoadTransposed4(&p_left[i].m_rows[row].x, 12, left[row]);
+                    LoadTransposed4(&p_right[i].m_rows[row].x, 12, right[row]);
+                }
+
+                for (int row = 0; row < 3; row++)
+                {
+                    for (int column = 0; column < 4; column++)
+                    {
+                        VFloat value = column == 3 ? left[row][3] : VFloat::Splat(0.0f);
+                        value = MulAdd(left[row][0], right[0][column], value);
+                        value = MulAdd(left[row][1], right[1][column], value);
+                        result[row][column] = MulAdd(left[row][2], right[2][column], value);
+                    }
+                }
+
+                for (int row = 0; row < 3; row++)
+                    StoreTransposed4(&p_result[i].m_rows[row].x, 12, result[row]);
+            }
+        }
+
+        for (; i < p_count; i++)
+            Affine34Multiply(p_left[i], p_right[i], p_result[i]);
+    }
+
+    /**
+     * Invert p_count transforms
+     * @note p_result may be p_transforms but must not overlap it partially
+    */
+    inline void Affine34InverseBatch(const FAffine34* p_transforms, FAffine34* p_result, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        if constexpr (width > 1)
+        {
+            const VFloat one = VFloat::Splat(1.0f);
+
+            for (; i + width <= p_count; i += width)
+            {
+                VFloat m[3][4];
+
+                for (int row = 0; row < 3; row++)
+                    LoadTransposed4(&p_transforms[i].m_rows[row].x, 12, m[row]);
+
+                // Adjugate columns: cross products of the rows
+                const VFloat c00 = NegMulAdd(m[1][2], m[2][1], m[1][1] * m[2][2]);
+                const VFloat c01 = NegMulAdd(m[1][0], m[2][2], m[1][2] * m[2][0]);
+                const VFloat c02 = NegMulAdd(m[1][1], m[2][0], m[1][0] * m[2][1]);
+                const VFloat c10 = NegMulAdd(m[2][2], m[0][1], m[2][1] * m[0][2]);
+                const VFloat c11 = NegMulAdd(m[2][0], m[0][2], m[2][2] * m[0][0]);
+                const VFloat c12 = NegMulAdd(m[2][1], m[0][0], m[2][0] * m[0][1]);
+                const VFloat c20 = NegMulAdd(m[0][2], m[1][1], m[0][1] * m[1][2]);
+                const VFloat c21 = NegMulAdd(m[0][0], m[1][2], m[0][2] * m[1][0]);
+                const VFloat c22 = NegMulAdd(m[0][1], m[1][0], m[0][0] * m[1][1]);
+
+                const VFloat oneOverDeterminant = one / MulAdd(m[0][0], c00, MulAdd(m[0][1], c01, m[0][2] * c02));
+
+                const VFloat inverse[3][3] =
+                {
+                    { c00 * oneOverDeterminant, c10 * oneOverDeterminant, c20 * oneOverDeterminant },
+                    { c01 * oneOverDeterminant, c11 * oneOverDeterminant, c21 * oneOverDeterminant },
+                    { c02 * oneOverDeterminant, c12 * oneOverDeterminant, c22 * oneOverDeterminant }
+                };
+
+                VFloat result[3][4];
+
+                for (int row = 0; row < 3; row++)
+                {
+                    result[row][0] = inverse[row][0];
+                    result[row][1] = inverse[row][1];
+                    result[row][2] = inverse[row][2];
+                    result[row][3] = VFloat::Splat(0.0f) - MulAdd(inverse[row][0], m[0][3], MulAdd(inverse[row][1], m[1][3], inverse[row][2] * m[2][3]));
+                }
+
+                for (int row = 0; row < 3; row++)
+                    StoreTransposed4(&p_result[i].m_rows[row].x, 12, result[row]);
+            }
+        }
+
+        for (; i < p_count; i++)
+            Affine34Inverse(p_transforms[i], p_result[i]);
+    }
+
+    /**
+     * Transform p_count points or directions by one transform, with the translation when Point is set
+    */
+    template<bool Point>
+    LIBMATHS_FORCEINLINE void Affine34Transform(const FAffine34& p_transform, const FVec3* p_values, FVec3* p_result, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        const float* m = &p_transform.m_rows[0].x;
+        size_t i = 0;
+
+        if constexpr (width > 1)
+        {
+            VFloat rows[3][4];
+
+            for (int row = 0; row < 3; row++)
+            {
+                for (int column = 0; column < 4; column++)
+                    rows[row][column] = VFloat::Splat(Point || column < 3 ? m[row * 4 + column] : 0.0f);
+            }
+
+            for (; i + width <= p_count; i += width)
+            {
+                VFloat in[3];
+                VFloat out[3];
+                LoadTransposed3(&p_values[i].x, in);
+
+                for (int row = 0; row < 3; row++)
+                    out[row] = MulAdd(rows[row][0], in[0], MulAdd(rows[row][1], in[1], MulAdd(rows[row][2], in[2], rows[row][3])));
+
+                StoreTransposed3(&p_result[i].x, out);
+            }
+        }
+
+        for (; i < p_count; i++)
+        {
+            const float x = p_values[i].x;
+            const float y = p_values[i].y;
+            const float z = p_values[i].z;
+            float out[3];
+
+            for (int row = 0; row < 3; row++)
+                out[row] = m[row * 4] * x + m[row * 4 + 1] * y + m[row * 4 + 2] * z + (Point ? m[row * 4 + 3] : 0.0f);
+
+            p_result[i].x = out[0];
+            p_result[i].y = out[1];
+            p_result[i].z = out[2];
+        }
+    }
+
+    /**
+     * Transform p_count points, the translation is applied
+    */
+    inline void Affine34TransformPoints(const FAffine34& p_transform, const FVec3* p_points, FVec3* p_result, size_t p_count)
+    {
+        Affine34Transform<true>(p_transform, p_points, p_result, p_count);
+    }
+
+    /**
+     * Transform p_count directions, the translation is ignored
+    */
+    inline void Affine34TransformDirections(const FAffine34& p_transform, const FVec3* p_directions, FVec3* p_result, size_t p_count)
+    {
+        Affine34Transform<false>(p_transform, p_directions, p_result, p_count);
+    }
+}
@@ -0,0 +1,88 @@
+#include "CPUFeatures.hpp"
+
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define LIBMATHS_X86 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#else
+#define LIBMATHS_X86 0
+#endif
+
+using namespace lm::simd;
+
+#if LIBMATHS_X86
+static void CPUID(unsigned p_leaf, unsigned p_subLeaf, unsigned p_registers[4])
+{
+#if defined(_MSC_VER)
+    __cpuidex(reinterpret_cast<int*>(p_registers), static_cast<int>(p_leaf), static_cast<int>(p_subLeaf));
+#else
+    __cpuid_count(p_leaf, p_subLeaf, p_registers[0], p_registers[1], p_registers[2], p_registers[3]);
+#endif
+}
+
+static uint64_t XGetBV()
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t eax;
+    uint32_t edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+static bool HasBit(unsigned p_register, int p_bit)
+{
+    return (p_register >> p_bit) & 1u;
+}
+#endif
+
+FCPUFeatures FCPUFeatures::Detect()
+{
+    FCPUFeatures features;
+
+#if LIBMATHS_X86
+    unsigned registers[4] = {};
+    CPUID(0, 0, registers);
+    const unsigned maxLeaf = registers[0];
+
+    if (maxLeaf < 1)
+        return features;
+
+    CPUID(1, 0, registers);
+    const unsigned ecx1 = registers[2];
+    const unsigned edx1 = registers[3];
+
+    features.sse2 = HasBit(edx1, 26);
+    features.sse41 = HasBit(ecx1, 19);
+    features.sse42 = HasBit(ecx1, 20);
+
+    // AVX registers are only usable when the OS saves them on context switches
+    const bool osxsave = HasBit(ecx1, 27);
+    const uint64_t xcr0 = osxsave ? XGetBV() : 0;
+    const bool osAvx = (xcr0 & 0x6) == 0x6;
+    const bool osAvx512 = (xcr0 & 0xE6) == 0xE6;
+
+    features.avx = osAvx && HasBit(ecx1, 28);
+    features.fma = features.avx && HasBit(ecx1, 12);
+
+    if (maxLeaf >= 7)
+    {
+        CPUID(7, 0, registers);
+        const unsigned ebx7 = registers[1];
+
+        features.avx2 = features.avx && HasBit(ebx7, 5);
+        features.avx512f = osAvx512 && HasBit(ebx7, 16);
+        features.avx512dq = osAvx512 && HasBit(ebx7, 17);
+        features.avx512vl = osAvx512 && HasBit(ebx7, 31);
+    }
+#endif
+
+    return features;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+namespace lm::simd
+{
+    /**
+     * Instruction sets reported by cpuid and enabled by the operating system
+    */
+    struct FCPUFeatures
+    {
+        bool sse2 = false;
+        bool sse41 = false;
+        bool sse42 = false;
+        bool avx = false;
+        bool avx2 = false;
+        bool fma = false;
+        bool avx512f = false;
+        bool avx512dq = false;
+        bool avx512vl = false;
+
+        /**
+         * Query the running CPU
+        */
+        static FCPUFeatures Detect();
+    };
+}
@@ -0,0 +1,117 @@
+#include "Dispatch.hpp"
+#include "CPUFeatures.hpp"
+
+#include <atomic>
+
+using namespace lm;
+using namespace lm::simd;
+
+namespace lm::simd
+{
+    extern const FKernelTable g_kernelsBase;
+#if LIBMATHS_HAS_SSE42_KERNELS
+    extern const FKernelTable g_kernelsSSE42;
+#endif
+#if LIBMATHS_HAS_AVX2_KERNELS
+    extern const FKernelTable g_kernelsAVX2;
+#endif
+#if LIBMATHS_HAS_AVX512_KERNELS
+    extern const FKernelTable g_kernelsAVX512;
+#endif
+}
+
+// Extra levels first, the base table is always usable since the whole library is built for it
+static const FKernelTable* const s_tables[] =
+{
+#if LIBMATHS_HAS_AVX512_KERNELS
+    &g_kernelsAVX512,
+#endif
+#if LIBMATHS_HAS_AVX2_KERNELS
+    &g_kernelsAVX2,
+#endif
+#if LIBMATHS_HAS_SSE42_KERNELS
+    &g_kernelsSSE42,
+#endif
+    &g_kernelsBase
+};
+
+static std::atomic<const FKernelTable*> s_activeTable = nullptr;
+
+static bool IsSupported(const FKernelTable& p_table)
+{
+    if (&p_table == &g_kernelsBase)
+        return true;
+
+    static const FCPUFeatures features = FCPUFeatures::Detect();
+
+    switch (p_table.level)
+    {
+    case ESIMDLevel::Scalar:    return true;
+    case ESIMDLevel::SSE2:      return features.sse2;
+    case ESIMDLevel::SSE42:     return features.sse42;
+    case ESIMDLevel::AVX2:      return features.avx2 && features.fma;
+    case ESIMDLevel::AVX512:    return features.avx512f && features.avx512dq && features.avx512vl && features.avx2 && features.fma;
+    default:                    return false;
+    }
+}
+
+static const FKernelTable& SelectTable()
+{
+    for (const FKernelTable* table : s_tables)
+    {
+        if (IsSupported(*table))
+            return *table;
+    }
+
+    return g_kernelsBase;
+}
+
+const FKernelTable& lm::simd::Kernels()
+{
+    const FKernelTable* table = s_activeTable.load(std::memory_order_acquire);
+
+    if (table == nullptr)
+    {
+        table = &SelectTable();
+        s_activeTable.store(table, std::memory_order_release);
+    }
+
+    return *table;
+}
+
+ESIMDLevel lm::GetSIMDLevel()
+{
+    return Kernels().level;
+}
+
+ESIMDLevel lm::GetSupportedSIMDLevel()
+{
+    return SelectTable().level;
+}
+
+bool lm::SetSIMDLevel(ESIMDLevel p_level)
+{
+    for (const FKernelTable* table : s_tables)
+    {
+        if (table->level == p_level && IsSupported(*table))
+        {
+            s_activeTable.store(table, std::memory_order_release);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+const char* lm::ToString(ESIMDLevel p_level)
+{
+    switch (p_level)
+    {
+    case ESIMDLevel::Scalar:    return "Scalar";
+    case ESIMDLevel::SSE2:      return "SSE2";
+    case ESIMDLevel::SSE42:     return "SSE4.2";
+    case ESIMDLevel::AVX2:      return "AVX2";
+    case ESIMDLevel::AVX512:    return "AVX-512";
+    default:                    return "Unknown";
+    }
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace lm
+{
+    struct FAffine34;
+    struct FMat3;
+    struct FMat4;
+    struct FQuat;
+    struct FVec3;
+    struct FVec4;
+
+    /**
+     * @brief Instruction set levels the batch kernels are built for
+    */
+    enum class ESIMDLevel
+    {
+        Scalar,
+        SSE2,
+        SSE42,
+        AVX2,
+        AVX512
+    };
+
+    /**
+     * @brief Returns the level of the kernels used by the batch functions
+     * @note The level is chosen once from cpuid, or forced at build time with the LIBMATHS_SIMD CMake option
+    */
+    ESIMDLevel GetSIMDLevel();
+
+    /**
+     * @brief Returns the highest level built into the library that the running CPU supports
+    */
+    ESIMDLevel GetSupportedSIMDLevel();
+
+    /**
+     * @brief Selects the kernels of the given level
+     * @param p_level The level to use
+     * @return false if the level is not built into the library or not supported by the CPU
+     * @note Meant for benchmarks and tests, the default selection is already the fastest
+    */
+    bool SetSIMDLevel(ESIMDLevel p_level);
+
+    /**
+     * @brief Returns the name of a level
+     * @param p_level The level
+    */
+    const char* ToString(ESIMDLevel p_level);
+
+    namespace simd
+    {
+        /**
+         * Entry points of the batch kernels for one instruction set level
+        */
+        struct FKernelTable
+        {
+            ESIMDLevel level;
+
+            void (*mat4MultiplyBatch)(const FMat4* p_left, const FMat4* p_right, FMat4* p_result, size_t p_count);
+            void (*mat4InverseBatch)(const FMat4* p_matrices, FMat4* p_result, size_t p_count);
+            void (*mat4TransformPoints)(const FMat4& p_matrix, const FVec3* p_points, FVec3* p_result, size_t p_count);
+            void (*mat4TransformPointsDivide)(const FMat4& p_matrix, const FVec3* p_points, FVec3* p_result, size_t p_count);
+            void (*mat4TransformDirections)(const FMat4& p_matrix, const FVec3* p_directions, FVec3* p_result, size_t p_count);
+            void (*mat4TransformPointsHomogeneous)(const FMat4& p_matrix, const FVec3* p_points, FVec4* p_result, size_t p_count);
+            void (*mat4TransformVectors)(const FMat4& p_matrix, const FVec4* p_vectors, FVec4* p_result, size_t p_count);
+            void (*mat4TRSBatch)(const float* const* p_translations, const float* const* p_rotations, const float* const* p_scales, FMat4* p_result, size_t p_count);
+
+            void (*affine34MultiplyBatch)(const FAffine34* p_left, const FAffine34* p_right, FAffine34* p_result, size_t p_count);
+            void (*affine34InverseBatch)(const FAffine34* p_transforms, FAffine34* p_result, size_t p_count);
+            void (*affine34TransformPoints)(const FAffine34& p_transform, const FVec3* p_points, FVec3* p_result, size_t p_count);
+            void (*affine34TransformDirections)(const FAffine34& p_transform, const FVec3* p_directions, FVec3* p_result, size_t p_count);
+
+            void (*quatRotateVectors)(const FQuat& p_rotation, const FVec3* p_vectors, FVec3* p_result, size_t p_count);
+            void (*quatRotateVectorsEach)(const FQuat* p_rotations, const FVec3* p_vectors, FVec3* p_result, size_t p_count);
+            void (*quatStreamNLerp)(const float* const* p_start, const float* const* p_end, const float* p_alphas, float p_alpha, float* const* p_result, size_t p_count);
+            void (*quatStreamSLerp)(const float* const* p_start, const float* const* p_end, const float* p_alphas, float p_alpha, float* const* p_result, size_t p_count);
+            void (*quatStreamSLerpFast)(const float* const* p_start, const float* const* p_end, const float* p_alphas, float p_alpha, float* const* p_result, size_t p_count);
+            void (*quatEncode32)(const FQuat* p_rotations, uint32_t* p_codes, size_t p_count);
+            void (*quatDecode32)(const uint32_t* p_codes, FQuat* p_rotations, size_t p_count);
+            void (*quatEncode48)(const FQuat* p_rotations, uint16_t* p_codes, size_t p_count);
+            void (*quatDecode48)(const uint16_t* p_codes, FQuat* p_rotations, size_t p_count);
+            void (*quatToMat3Batch)(const FQuat* p_rotations, FMat3* p_result, size_t p_count);
+            void (*quatToAffine34Batch)(const FQuat* p_rotations, FAffine34* p_result, size_t p_count);
+            void (*quatToMat4Batch)(const FQuat* p_rotations, FMat4* p_result, size_t p_count);
+            void (*mat3ToQuatBatch)(const FMat3* p_matrices, FQuat* p_result, size_t p_count);
+
+            void (*dualQuatSkin)(const float* p_bones, const uint32_t* const* p_indices, const float* const* p_weights,
+                const float* const* p_positions, float* const* p_result, size_t p_count);
+            void (*mat4LinearBlendSkin)(const float* p_palette, const uint32_t* const* p_indices, const float* const* p_weights,
+                const float* const* p_positions, const float* const* p_normals, float* const* p_resultPositions, float* const* p_resultNormals, size_t p_count);
+            void (*affine34LinearBlendSkin)(const float* p_palette, const uint32_t* const* p_indices, const float* const* p_weights,
+                const float* const* p_positions, const float* const* p_normals, float* const* p_resultPositions, float* const* p_resultNormals, size_t p_count);
+
+            void (*streamAdd)(const float* p_left, const float* p_right, float* p_result, size_t p_count);
+            void (*streamScale)(const float* p_values, float p_scale, float* p_result, size_t p_count);
+            void (*streamLerp)(const float* p_start, const float* p_end, float p_alpha, float* p_result, size_t p_count);
+            void (*streamDot)(const float* const* p_left, const float* const* p_right, int p_components, float* p_result, size_t p_count);
+            void (*streamLength)(const float* const* p_values, int p_components, float* p_result, size_t p_count);
+            void (*streamNormalize)(const float* const* p_values, int p_components, float* const* p_result, size_t p_count);
+            void (*streamCross)(const float* const* p_left, const float* const* p_right, float* const* p_result, size_t p_count);
+            void (*streamDeinterleave)(const float* p_records, int p_components, float* const* p_lanes, size_t p_count);
+            void (*streamInterleave)(const float* const* p_lanes, int p_components, float* p_records, size_t p_count);
+        };
+
+        /**
+         * Return the kernels of the active level
+        */
+        const FKernelTable& Kernels();
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+/**
+ * Kernel table of the instruction set level the including translation unit is
+ * built for. Each KernelsXXX.cpp defines LIBMATHS_KERNEL_TABLE then includes
+ * this file, CMake gives it the matching compiler flags.
+ *
+ * Only the kernels may be odr-used here: an inline function of the public
+ * headers instantiated with wider flags could be picked by the linker for
+ * every caller.
+*/
+
+#include "Dispatch.hpp"
+#include "Mat4Kernels.h"
+#include "TransformKernels.h"
+#include "AffineKernels.h"
+#include "StreamKernels.h"
+#include "QuatKernels.h"
+#include "QuatCodecKernels.h"
+#include "QuatMatrixKernels.h"
+#include "SkinningKernels.h"
+
+#ifndef LIBMATHS_KERNEL_TABLE
+#error "LIBMATHS_KERNEL_TABLE must name the table defined by this translation unit"
+#endif
+
+namespace lm::simd
+{
+    extern const FKernelTable LIBMATHS_KERNEL_TABLE;
+
+    const FKernelTable LIBMATHS_KERNEL_TABLE =
+    {
+#if LIBMATHS_USE_AVX512
+        ESIMDLevel::AVX512,
+#elif LIBMATHS_USE_AVX2 && LIBMATHS_USE_FMA
+        ESIMDLevel::AVX2,
+#elif LIBMATHS_USE_SSE41
+        ESIMDLevel::SSE42,
+#elif LIBMATHS_USE_SSE
+        ESIMDLevel::SSE2,
+#else
+        ESIMDLevel::Scalar,
+#endif
+
+        &Mat4MultiplyBatch,
+        &Mat4InverseBatch,
+        &Mat4TransformPoints,
+        &Mat4TransformPointsDivide,
+        &Mat4TransformDirections,
+        &Mat4TransformPointsHomogeneous,
+        &Mat4TransformVectors,
+        &Mat4TRSBatch,
+
+        &Affine34MultiplyBatch,
+        &Affine34InverseBatch,
+        &Affine34TransformPoints,
+        &Affine34TransformDirections,
+
+        &QuatRotateVectors,
+        &QuatRotateVectorsEach,
+        &QuatStreamNLerp,
+        &QuatStreamSLerp,
+        &QuatStreamSLerpFast,
+        &QuatEncode32,
+        &QuatDecode32,
+        &QuatEncode48,
+        &QuatDecode48,
+        &QuatToMat3Batch,
+        &QuatToAffine34Batch,
+        &QuatToMat4Batch,
+        &Mat3ToQuatBatch,
+
+        &DualQuatSkin,
+        &Mat4LinearBlendSkin,
+        &Affine34LinearBlendSkin,
+
+        &StreamAdd,
+        &StreamScale,
+        &StreamLerp,
+        &StreamDot,
+        &StreamLength,
+        &StreamNormalize,
+        &StreamCross,
+        &StreamDeinterleave,
+        &StreamInterleave
+    };
+}
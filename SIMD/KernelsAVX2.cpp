@@ -0,0 +1,6 @@
+#define LIBMATHS_KERNEL_TABLE g_kernelsAVX2
+#include "Kernels.inl"
+
+#if !LIBMATHS_USE_AVX2 || !LIBMATHS_USE_FMA
+#error "KernelsAVX2.cpp must be built with AVX2 and FMA enabled"
+#endif
@@ -0,0 +1,6 @@
+#define LIBMATHS_KERNEL_TABLE g_kernelsAVX512
+#include "Kernels.inl"
+
+#if !LIBMATHS_USE_AVX512
+#error "KernelsAVX512.cpp must be built with AVX-512 enabled"
+#endif
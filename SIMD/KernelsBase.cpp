@@ -0,0 +1,3 @@
+// Kernels built with the flags of the rest of the library
+#define LIBMATHS_KERNEL_TABLE g_kernelsBase
+#include "Kernels.inl"
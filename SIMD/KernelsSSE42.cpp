@@ -0,0 +1,2 @@
+#define LIBMATHS_KERNEL_TABLE g_kernelsSSE42
+#include "Kernels.inl"
@@ -0,0 +1,94 @@
+#include "LaneBuffer.hpp"
+
+#include <algorithm>
+#include <new>
+
+using namespace lm::simd;
+
+FLaneBuffer::FLaneBuffer(int p_laneCount) : m_laneCount(p_laneCount)
+{
+}
+
+FLaneBuffer::FLaneBuffer(const FLaneBuffer& p_other) : m_laneCount(p_other.m_laneCount)
+{
+    *this = p_other;
+}
+
+FLaneBuffer::FLaneBuffer(FLaneBuffer&& p_other) noexcept :
+    m_laneCount(p_other.m_laneCount), m_size(p_other.m_size), m_capacity(p_other.m_capacity), m_data(p_other.m_data)
+{
+    p_other.m_size = 0;
+    p_other.m_capacity = 0;
+    p_other.m_data = nullptr;
+}
+
+FLaneBuffer::~FLaneBuffer()
+{
+    ::operator delete[](m_data, std::align_val_t(Alignment));
+}
+
+FLaneBuffer& FLaneBuffer::operator=(const FLaneBuffer& p_other)
+{
+    if (this == &p_other)
+        return *this;
+
+    m_laneCount = p_other.m_laneCount;
+    Reallocate(p_other.PaddedSize());
+    m_size = p_other.m_size;
+
+    for (int lane = 0; lane < m_laneCount; lane++)
+        std::copy_n(p_other.Lane(lane), m_size, Lane(lane));
+
+    return *this;
+}
+
+FLaneBuffer& FLaneBuffer::operator=(FLaneBuffer&& p_other) noexcept
+{
+    std::swap(m_laneCount, p_other.m_laneCount);
+    std::swap(m_size, p_other.m_size);
+    std::swap(m_capacity, p_other.m_capacity);
+    std::swap(m_data, p_other.m_data);
+    return *this;
+}
+
+void FLaneBuffer::Resize(size_t p_size)
+{
+    if (p_size > m_capacity)
+    {
+        FLaneBuffer old = std::move(*this);
+        m_laneCount = old.m_laneCount;
+        Reallocate(std::max((p_size + Padding - 1) / Padding * Padding, old.m_capacity * 2));
+
+        for (int lane = 0; lane < m_laneCount; lane++)
+            std::copy_n(old.Lane(lane), old.m_size, Lane(lane));
+    }
+    else if (p_size < m_size)
+    {
+        for (int lane = 0; lane < m_laneCount; lane++)
+            std::fill(Lane(lane) + p_size, Lane(lane) + m_size, 0.0f);
+    }
+    else
+    {
+        // Kernels writing whole registers may have left any value in the padding
+        for (int lane = 0; lane < m_laneCount; lane++)
+            std::fill(Lane(lane) + m_size, Lane(lane) + p_size, 0.0f);
+    }
+
+    m_size = p_size;
+}
+
+void FLaneBuffer::Reallocate(size_t p_capacity)
+{
+    ::operator delete[](m_data, std::align_val_t(Alignment));
+    m_data = nullptr;
+    m_size = 0;
+    m_capacity = 0;
+
+    if (p_capacity == 0)
+        return;
+
+    const size_t count = p_capacity * m_laneCount;
+    m_data = static_cast<float*>(::operator new[](count * sizeof(float), std::align_val_t(Alignment)));
+    m_capacity = p_capacity;
+    std::fill_n(m_data, count, 0.0f);
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+
+namespace lm::simd
+{
+    /**
+     * Storage of the structure of arrays streams: p_laneCount float arrays of the same size
+     * @note Every lane is 64 bytes aligned and padded to a multiple of 16 floats, so
+     * kernels may read and write whole registers past the last element. Storage
+     * past the last element starts zeroed, but a kernel may leave any value there:
+     * Resize zeroes the elements it adds.
+    */
+    class FLaneBuffer
+    {
+    public:
+        static constexpr size_t Alignment = 64;
+        static constexpr size_t Padding = Alignment / sizeof(float);
+
+        explicit FLaneBuffer(int p_laneCount);
+        FLaneBuffer(const FLaneBuffer& p_other);
+        FLaneBuffer(FLaneBuffer&& p_other) noexcept;
+        ~FLaneBuffer();
+
+        FLaneBuffer& operator=(const FLaneBuffer& p_other);
+        FLaneBuffer& operator=(FLaneBuffer&& p_other) noexcept;
+
+        /**
+         * Change the number of elements, the first elements are kept and the new ones are zeroed
+         * @param p_size
+        */
+        void Resize(size_t p_size);
+
+        /**
+         * Return the number of elements
+        */
+        size_t Size() const { return m_size; }
+
+        /**
+         * Return the number of elements rounded up to the padding
+        */
+        size_t PaddedSize() const { return (m_size + Padding - 1) / Padding * Padding; }
+
+        /**
+         * Return the first element of lane p_lane
+         * @param p_lane
+        */
+        float* Lane(int p_lane) { return m_data + p_lane * m_capacity; }
+        const float* Lane(int p_lane) const { return m_data + p_lane * m_capacity; }
+
+    private:
+        void Reallocate(size_t p_capacity);
+
+        int m_laneCount;
+        size_t m_size = 0;
+        size_t m_capacity = 0;
+        float* m_data = nullptr;
+    };
+}
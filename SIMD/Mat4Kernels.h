@@ -0,0 +1,647 @@
+#pragma once
+
+#include <cstddef>
+
+#include "SIMD.h"
+#include "VFloat.h"
+#include "../Mat4/FMat4.hpp"
+
+/**
+ * 4x4 matrix kernels shared by the FMat4 entry points.
+ *
+ * Matrices are stored as 4 FVec4 rows and combined the GLM way: row i of
+ * p_left * p_right is the sum of the rows of p_left weighted by the
+ * components of row i of p_right.
+*/
+namespace lm::simd::inline LIBMATHS_ISA_NAMESPACE
+{
+#if LIBMATHS_USE_AVX
+    /**
+     * Combine the rows of p_left (duplicated in both halves) weighted by two rows of p_right
+    */
+    LIBMATHS_FORCEINLINE __m256 CombineRows2(__m256 p_left0, __m256 p_left1, __m256 p_left2, __m256 p_left3, __m256 p_right)
+    {
+        __m256 result = _mm256_mul_ps(p_left0, _mm256_shuffle_ps(p_right, p_right, _MM_SHUFFLE(0, 0, 0, 0)));
+#if LIBMATHS_USE_FMA
+        result = _mm256_fmadd_ps(p_left1, _mm256_shuffle_ps(p_right, p_right, _MM_SHUFFLE(1, 1, 1, 1)), result);
+        result = _mm256_fmadd_ps(p_left2, _mm256_shuffle_ps(p_right, p_right, _MM_SHUFFLE(2, 2, 2, 2)), result);
+        result = _mm256_fmadd_ps(p_left3, _mm256_shuffle_ps(p_right, p_right, _MM_SHUFFLE(3, 3, 3, 3)), result);
+#else
+        result = _mm256_add_ps(result, _mm256_mul_ps(p_left1, _mm256_shuffle_ps(p_right, p_right, _MM_SHUFFLE(1, 1, 1, 1))));
+        result = _mm256_add_ps(result, _mm256_mul_ps(p_left2, _mm256_shuffle_ps(p_right, p_right, _MM_SHUFFLE(2, 2, 2, 2))));
+        result = _mm256_add_ps(result, _mm256_mul_ps(p_left3, _mm256_shuffle_ps(p_right, p_right, _MM_SHUFFLE(3, 3, 3, 3))));
+#endif
+        return result;
+    }
+#elif LIBMATHS_USE_SSE
+    /**
+     * Combine the rows of p_left weighted by the components of p_right
+    */
+    LIBMATHS_FORCEINLINE __m128 CombineRows(__m128 p_left0, __m128 p_left1, __m128 p_left2, __m128 p_left3, __m128 p_right)
+    {
+        __m128 result = _mm_mul_ps(p_left0, Swizzle<0, 0, 0, 0>(p_right));
+        result = MulAdd(p_left1, Swizzle<1, 1, 1, 1>(p_right), result);
+        result = MulAdd(p_left2, Swizzle<2, 2, 2, 2>(p_right), result);
+        result = MulAdd(p_left3, Swizzle<3, 3, 3, 3>(p_right), result);
+        return result;
+    }
+#endif
+
+    /**
+     * Compute p_left * p_right into p_result
+     * @note p_result may alias either operand
+    */
+    LIBMATHS_FORCEINLINE void Mat4Multiply(const FMat4& p_left, const FMat4& p_right, FMat4& p_result)
+    {
+#if LIBMATHS_USE_AVX
+        const __m256 left0 = _mm256_broadcast_ps(&p_left.m_matrix[0].m_simd);
+        const __m256 left1 = _mm256_broadcast_ps(&p_left.m_matrix[1].m_simd);
+        const __m256 left2 = _mm256_broadcast_ps(&p_left.m_matrix[2].m_simd);
+        const __m256 left3 = _mm256_broadcast_ps(&p_left.m_matrix[3].m_simd);
+
+        const __m256 right01 = _mm256_loadu_ps(&p_right.m_matrix[0].x);
+        const __m256 right23 = _mm256_loadu_ps(&p_right.m_matrix[2].x);
+
+        _mm256_storeu_ps(&p_result.m_matrix[0].x, CombineRows2(left0, left1, left2, left3, right01));
+        _mm256_storeu_ps(&p_result.m_matrix[2].x, CombineRows2(left0, left1, left2, left3, right23));
+#elif LIBMATHS_USE_SSE
+        const __m128 left0 = p_left.m_matrix[0].m_simd;
+        const __m128 left1 = p_left.m_matrix[1].m_simd;
+        const __m128 left2 = p_left.m_matrix[2].m_simd;
+        const __m128 left3 = p_left.m_matrix[3].m_simd;
+
+        const __m128 right0 = p_right.m_matrix[0].m_simd;
+        const __m128 right1 = p_right.m_matrix[1].m_simd;
+        const __m128 right2 = p_right.m_matrix[2].m_simd;
+        const __m128 right3 = p_right.m_matrix[3].m_simd;
+
+        p_result.m_matrix[0].m_simd = CombineRows(left0, left1, left2, left3, right0);
+        p_result.m_matrix[1].m_simd = CombineRows(left0, left1, left2, left3, right1);
+        p_result.m_matrix[2].m_simd = CombineRows(left0, left1, left2, left3, right2);
+        p_result.m_matrix[3].m_simd = CombineRows(left0, left1, left2, left3, right3);
+#else
+        const FVec4 left0 = p_left.m_matrix[0];
+        const FVec4 left1 = p_left.m_matrix[1];
+        const FVec4 left2 = p_left.m_matrix[2];
+        const FVec4 left3 = p_left.m_matrix[3];
+
+        for (int i = 0; i < 4; i++)
+        {
+            const FVec4 right = p_right.m_matrix[i];
+            p_result.m_matrix[i] = left0 * right.x + left1 * right.y + left2 * right.z + left3 * right.w;
+        }
+#endif
+    }
+
+    /**
+     * Compute p_result[i] = p_left[i] * p_right[i] for p_count pairs
+     * @note The operands of the next pair are loaded while the current one is computed
+    */
+    inline void Mat4MultiplyBatch(const FMat4* p_left, const FMat4* p_right, FMat4* p_result, size_t p_count)
+    {
+        if (p_count == 0)
+            return;
+
+#if LIBMATHS_USE_AVX
+        __m256 left0 = _mm256_broadcast_ps(&p_left[0].m_matrix[0].m_simd);
+        __m256 left1 = _mm256_broadcast_ps(&p_left[0].m_matrix[1].m_simd);
+        __m256 left2 = _mm256_broadcast_ps(&p_left[0].m_matrix[2].m_simd);
+        __m256 left3 = _mm256_broadcast_ps(&p_left[0].m_matrix[3].m_simd);
+        __m256 right01 = _mm256_loadu_ps(&p_right[0].m_matrix[0].x);
+        __m256 right23 = _mm256_loadu_ps(&p_right[0].m_matrix[2].x);
+
+        for (size_t i = 0; i < p_count; i++)
+        {
+            const __m256 result01 = CombineRows2(left0, left1, left2, left3, right01);
+            const __m256 result23 = CombineRows2(left0, left1, left2, left3, right23);
+
+            if (i + 1 < p_count)
+            {
+                left0 = _mm256_broadcast_ps(&p_left[i + 1].m_matrix[0].m_simd);
+                left1 = _mm256_broadcast_ps(&p_left[i + 1].m_matrix[1].m_simd);
+                left2 = _mm256_broadcast_ps(&p_left[i + 1].m_matrix[2].m_simd);
+                left3 = _mm256_broadcast_ps(&p_left[i + 1].m_matrix[3].m_simd);
+                right01 = _mm256_loadu_ps(&p_right[i + 1].m_matrix[0].x);
+                right23 = _mm256_loadu_ps(&p_right[i + 1].m_matrix[2].x);
+            }
+
+            _mm256_storeu_ps(&p_result[i].m_matrix[0].x, result01);
+            _mm256_storeu_ps(&p_result[i].m_matrix[2].x, result23);
+        }
+#elif LIBMATHS_USE_SSE
+        __m128 left0 = p_left[0].m_matrix[0].m_simd;
+        __m128 left1 = p_left[0].m_matrix[1].m_simd;
+        __m128 left2 = p_left[0].m_matrix[2].m_simd;
+        __m128 left3 = p_left[0].m_matrix[3].m_simd;
+        __m128 right0 = p_right[0].m_matrix[0].m_simd;
+        __m128 right1 = p_right[0].m_matrix[1].m_simd;
+        __m128 right2 = p_right[0].m_matrix[2].m_simd;
+        __m128 right3 = p_right[0].m_matrix[3].m_simd;
+
+        for (size_t i = 0; i < p_count; i++)
+        {
+            const __m128 result0 = CombineRows(left0, left1, left2, left3, right0);
+            const __m128 result1 = CombineRows(left0, left1, left2, left3, right1);
+            const __m128 result2 = CombineRows(left0, left1, left2, left3, right2);
+            const __m128 result3 = CombineRows(left0, left1, left2, left3, right3);
+
+            if (i + 1 < p_count)
+            {
+                left0 = p_left[i + 1].m_matrix[0].m_simd;
+                left1 = p_left[i + 1].m_matrix[1].m_simd;
+                left2 = p_left[i + 1].m_matrix[2].m_simd;
+                left3 = p_left[i + 1].m_matrix[3].m_simd;
+                right0 = p_right[i + 1].m_matrix[0].m_simd;
+                right1 = p_right[i + 1].m_matrix[1].m_simd;
+                right2 = p_right[i + 1].m_matrix[2].m_simd;
+                right3 = p_right[i + 1].m_matrix[3].m_simd;
+            }
+
+            p_result[i].m_matrix[0].m_simd = result0;
+            p_result[i].m_matrix[1].m_simd = result1;
+            p_result[i].m_matrix[2].m_simd = result2;
+            p_result[i].m_matrix[3].m_simd = result3;
+        }
+#else
+        for (size_t i = 0; i < p_count; i++)
+        {
+            Mat4Multiply(p_left[i], p_right[i], p_result[i]);
+        }
+#endif
+    }
+
+    /**
+     * Invert VFloat::Width matrices held element by element, p_m[i][j] holding m[i][j] of every matrix
+     * @note Same cofactor expansion as Mat4Inverse, one matrix per lane
+    */
+    LIBMATHS_FORCEINLINE void Mat4InverseSoA(const VFloat p_m[4][4], VFloat p_result[4][4])
+    {
+        const auto factor = [&](int p_a, int p_b, VFloat p_group[4])
+        {
+            p_group[0] = p_m[2][p_a] * p_m[3][p_b] - p_m[3][p_a] * p_m[2][p_b];
+            p_group[1] = p_group[0];
+            p_group[2] = p_m[1][p_a] * p_m[3][p_b] - p_m[3][p_a] * p_m[1][p_b];
+            p_group[3] = p_m[1][p_a] * p_m[2][p_b] - p_m[2][p_a] * p_m[1][p_b];
+        };
+
+        VFloat fac[6][4];
+        factor(2, 3, fac[0]);
+        factor(1, 3, fac[1]);
+        factor(1, 2, fac[2]);
+        factor(0, 3, fac[3]);
+        factor(0, 2, fac[4]);
+        factor(0, 1, fac[5]);
+
+        VFloat vec[4][4];
+        for (int c = 0; c < 4; c++)
+        {
+            vec[c][0] = p_m[1][c];
+            vec[c][1] = p_m[0][c];
+            vec[c][2] = p_m[0][c];
+            vec[c][3] = p_m[0][c];
+        }
+
+        // Unsigned adjugate rows, the sign of element [i][l] is + when i + l is even
+        VFloat inv[4][4];
+        for (int l = 0; l < 4; l++)
+        {
+            inv[0][l] = vec[1][l] * fac[0][l] - vec[2][l] * fac[1][l] + vec[3][l] * fac[2][l];
+            inv[1][l] = vec[0][l] * fac[0][l] - vec[2][l] * fac[3][l] + vec[3][l] * fac[4][l];
+            inv[2][l] = vec[0][l] * fac[1][l] - vec[1][l] * fac[3][l] + vec[3][l] * fac[5][l];
+            inv[3][l] = vec[0][l] * fac[2][l] - vec[1][l] * fac[4][l] + vec[2][l] * fac[5][l];
+        }
+
+        const VFloat determinant = p_m[0][0] * inv[0][0] - p_m[0][1] * inv[1][0] + p_m[0][2] * inv[2][0] - p_m[0][3] * inv[3][0];
+        const VFloat oneOverDeterminant = VFloat::Splat(1.0f) / determinant;
+        const VFloat minusOneOverDeterminant = VFloat::Splat(-1.0f) / determinant;
+
+        for (int i = 0; i < 4; i++)
+            for (int l = 0; l < 4; l++)
+                p_result[i][l] = inv[i][l] * ((i + l) % 2 == 0 ? oneOverDeterminant : minusOneOverDeterminant);
+    }
+
+#if LIBMATHS_USE_SSE
+    /**
+     * Return one cofactor group of the GLM inverse for the columns p_a and p_b:
+     * (m2a * m3b - m3a * m2b, same, m1a * m3b - m3a * m1b, m1a * m2b - m2a * m1b)
+    */
+    template<int A, int B>
+    LIBMATHS_FORCEINLINE __m128 InverseFactor(__m128 p_row1, __m128 p_row2, __m128 p_row3)
+    {
+        const __m128 row3b2b = _mm_shuffle_ps(p_row3, p_row2, _MM_SHUFFLE(B, B, B, B));
+        const __m128 row3a2a = _mm_shuffle_ps(p_row3, p_row2, _MM_SHUFFLE(A, A, A, A));
+
+        const __m128 swap0 = _mm_shuffle_ps(p_row2, p_row1, _MM_SHUFFLE(A, A, A, A));
+        const __m128 swap1 = Swizzle<0, 0, 0, 2>(row3b2b);
+        const __m128 swap2 = Swizzle<0, 0, 0, 2>(row3a2a);
+        const __m128 swap3 = _mm_shuffle_ps(p_row2, p_row1, _MM_SHUFFLE(B, B, B, B));
+
+        return _mm_sub_ps(_mm_mul_ps(swap0, swap1), _mm_mul_ps(swap2, swap3));
+    }
+
+    /**
+     * Return (m1c, m0c, m0c, m0c) for the column C
+    */
+    template<int C>
+    LIBMATHS_FORCEINLINE __m128 InverseColumn(__m128 p_row0, __m128 p_row1)
+    {
+        return Swizzle<0, 2, 2, 2>(_mm_shuffle_ps(p_row1, p_row0, _MM_SHUFFLE(C, C, C, C)));
+    }
+#endif
+
+    /**
+     * Compute the inverse of p_matrix into p_result with the GLM cofactor layout
+     * @note p_result may alias p_matrix
+    */
+    LIBMATHS_FORCEINLINE void Mat4Inverse(const FMat4& p_matrix, FMat4& p_result)
+    {
+#if LIBMATHS_USE_SSE
+        const __m128 row0 = p_matrix.m_matrix[0].m_simd;
+        const __m128 row1 = p_matrix.m_matrix[1].m_simd;
+        const __m128 row2 = p_matrix.m_matrix[2].m_simd;
+        const __m128 row3 = p_matrix.m_matrix[3].m_simd;
+
+        const __m128 fac0 = InverseFactor<2, 3>(row1, row2, row3);
+        const __m128 fac1 = InverseFactor<1, 3>(row1, row2, row3);
+        const __m128 fac2 = InverseFactor<1, 2>(row1, row2, row3);
+        const __m128 fac3 = InverseFactor<0, 3>(row1, row2, row3);
+        const __m128 fac4 = InverseFactor<0, 2>(row1, row2, row3);
+        const __m128 fac5 = InverseFactor<0, 1>(row1, row2, row3);
+
+        const __m128 vec0 = InverseColumn<0>(row0, row1);
+        const __m128 vec1 = InverseColumn<1>(row0, row1);
+        const __m128 vec2 = InverseColumn<2>(row0, row1);
+        const __m128 vec3 = InverseColumn<3>(row0, row1);
+
+        const __m128 signA = _mm_set_ps(-1.0f, 1.0f, -1.0f, 1.0f);
+        const __m128 signB = _mm_set_ps(1.0f, -1.0f, 1.0f, -1.0f);
+
+        const __m128 inv0 = _mm_mul_ps(signA, MulAdd(vec3, fac2, _mm_sub_ps(_mm_mul_ps(vec1, fac0), _mm_mul_ps(vec2, fac1))));
+        const __m128 inv1 = _mm_mul_ps(signB, MulAdd(vec3, fac4, _mm_sub_ps(_mm_mul_ps(vec0, fac0), _mm_mul_ps(vec2, fac3))));
+        const __m128 inv2 = _mm_mul_ps(signA, MulAdd(vec3, fac5, _mm_sub_ps(_mm_mul_ps(vec0, fac1), _mm_mul_ps(vec1, fac3))));
+        const __m128 inv3 = _mm_mul_ps(signB, MulAdd(vec2, fac5, _mm_sub_ps(_mm_mul_ps(vec0, fac2), _mm_mul_ps(vec1, fac4))));
+
+        // First column of the adjugate, dotted with the first row gives the determinant
+        const __m128 column0 = _mm_shuffle_ps(_mm_shuffle_ps(inv0, inv1, _MM_SHUFFLE(0, 0, 0, 0)),
+            _mm_shuffle_ps(inv2, inv3, _MM_SHUFFLE(0, 0, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 oneOverDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), Dot4(row0, column0));
+
+        p_result.m_matrix[0].m_simd = _mm_mul_ps(inv0, oneOverDeterminant);
+        p_result.m_matrix[1].m_simd = _mm_mul_ps(inv1, oneOverDeterminant);
+        p_result.m_matrix[2].m_simd = _mm_mul_ps(inv2, oneOverDeterminant);
+        p_result.m_matrix[3].m_simd = _mm_mul_ps(inv3, oneOverDeterminant);
+#else
+        VFloat in[4][4];
+        VFloat out[4][4];
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 4; j++)
+                in[i][j] = VFloat(p_matrix.m_matrix[i][j]);
+
+        Mat4InverseSoA(in, out);
+
+        for (int i = 0; i < 4; i++)
+            p_result.m_matrix[i] = FVec4(out[i][0].m_value, out[i][1].m_value, out[i][2].m_value, out[i][3].m_value);
+#endif
+    }
+
+    /**
+     * Write the transpose of p_matrix as 16 floats at p_result, which needs no alignment
+    */
+    LIBMATHS_FORCEINLINE void Mat4Transpose(const FMat4& p_matrix, float* p_result)
+    {
+#if LIBMATHS_USE_SSE
+        __m128 row0 = p_matrix.m_matrix[0].m_simd;
+        __m128 row1 = p_matrix.m_matrix[1].m_simd;
+        __m128 row2 = p_matrix.m_matrix[2].m_simd;
+        __m128 row3 = p_matrix.m_matrix[3].m_simd;
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+        _mm_storeu_ps(p_result, row0);
+        _mm_storeu_ps(p_result + 4, row1);
+        _mm_storeu_ps(p_result + 8, row2);
+        _mm_storeu_ps(p_result + 12, row3);
+#else
+        const float* source = &p_matrix.m_matrix[0].x;
+
+        for (int row = 0; row < 4; row++)
+        {
+            for (int column = 0; column < 4; column++)
+                p_result[column * 4 + row] = source[row * 4 + column];
+        }
+#endif
+    }
+
+    /**
+     * Invert an affine p_matrix: the 3x3 inverse from cross products, then the translation moved through it
+     * @note p_result may alias p_matrix
+    */
+    LIBMATHS_FORCEINLINE void Mat4InverseAffine(const FMat4& p_matrix, FMat4& p_result)
+    {
+#if LIBMATHS_USE_SSE
+        const __m128 column0 = p_matrix.m_matrix[0].m_simd;
+        const __m128 column1 = p_matrix.m_matrix[1].m_simd;
+        const __m128 column2 = p_matrix.m_matrix[2].m_simd;
+        const __m128 translation = p_matrix.m_matrix[3].m_simd;
+
+        // Rows of the adjugate, their w lanes are 0 as the w of the columns of an affine matrix are
+        __m128 row0 = Cross3(column1, column2);
+        __m128 row1 = Cross3(column2, column0);
+        __m128 row2 = Cross3(column0, column1);
+        __m128 row3 = _mm_setzero_ps();
+
+        const __m128 oneOverDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), Dot4(column0, row0));
+        row0 = _mm_mul_ps(row0, oneOverDeterminant);
+        row1 = _mm_mul_ps(row1, oneOverDeterminant);
+        row2 = _mm_mul_ps(row2, oneOverDeterminant);
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+        __m128 inverseTranslation = _mm_mul_ps(row0, Swizzle<0, 0, 0, 0>(translation));
+        inverseTranslation = MulAdd(row1, Swizzle<1, 1, 1, 1>(translation), inverseTranslation);
+        inverseTranslation = MulAdd(row2, Swizzle<2, 2, 2, 2>(translation), inverseTranslation);
+
+        p_result.m_matrix[0].m_simd = row0;
+        p_result.m_matrix[1].m_simd = row1;
+        p_result.m_matrix[2].m_simd = row2;
+        p_result.m_matrix[3].m_simd = _mm_sub_ps(_mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f), inverseTranslation);
+#else
+        const float* m = &p_matrix.m_matrix[0].x;
+
+        // Rows of the adjugate: cross products of the columns
+        const float a00 = m[5] * m[10] - m[6] * m[9];
+        const float a01 = m[6] * m[8] - m[4] * m[10];
+        const float a02 = m[4] * m[9] - m[5] * m[8];
+        const float a10 = m[9] * m[2] - m[10] * m[1];
+        const float a11 = m[10] * m[0] - m[8] * m[2];
+        const float a12 = m[8] * m[1] - m[9] * m[0];
+        const float a20 = m[1] * m[6] - m[2] * m[5];
+        const float a21 = m[2] * m[4] - m[0] * m[6];
+        const float a22 = m[0] * m[5] - m[1] * m[4];
+
+        const float oneOverDeterminant = 1.0f / (m[0] * a00 + m[1] * a01 + m[2] * a02);
+
+        const float inverse[3][3] =
+        {
+            { a00 * oneOverDeterminant, a10 * oneOverDeterminant, a20 * oneOverDeterminant },
+            { a01 * oneOverDeterminant, a11 * oneOverDeterminant, a21 * oneOverDeterminant },
+            { a02 * oneOverDeterminant, a12 * oneOverDeterminant, a22 * oneOverDeterminant }
+        };
+
+        const float tx = m[12];
+        const float ty = m[13];
+        const float tz = m[14];
+        float* result = &p_result.m_matrix[0].x;
+
+        for (int column = 0; column < 3; column++)
+        {
+            result[column * 4] = inverse[column][0];
+            result[column * 4 + 1] = inverse[column][1];
+            result[column * 4 + 2] = inverse[column][2];
+            result[column * 4 + 3] = 0.0f;
+        }
+
+        result[12] = -(inverse[0][0] * tx + inverse[1][0] * ty + inverse[2][0] * tz);
+        result[13] = -(inverse[0][1] * tx + inverse[1][1] * ty + inverse[2][1] * tz);
+        result[14] = -(inverse[0][2] * tx + inverse[1][2] * ty + inverse[2][2] * tz);
+        result[15] = 1.0f;
+#endif
+    }
+
+    /**
+     * Invert a rigid p_matrix (orthonormal rotation and translation): the rotation is transposed and the translation rotated back
+     * @note p_result may alias p_matrix
+    */
+    LIBMATHS_FORCEINLINE void Mat4InverseRigid(const FMat4& p_matrix, FMat4& p_result)
+    {
+#if LIBMATHS_USE_SSE
+        __m128 row0 = p_matrix.m_matrix[0].m_simd;
+        __m128 row1 = p_matrix.m_matrix[1].m_simd;
+        __m128 row2 = p_matrix.m_matrix[2].m_simd;
+        __m128 row3 = _mm_setzero_ps();
+        const __m128 translation = p_matrix.m_matrix[3].m_simd;
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+        __m128 inverseTranslation = _mm_mul_ps(row0, Swizzle<0, 0, 0, 0>(translation));
+        inverseTranslation = MulAdd(row1, Swizzle<1, 1, 1, 1>(translation), inverseTranslation);
+        inverseTranslation = MulAdd(row2, Swizzle<2, 2, 2, 2>(translation), inverseTranslation);
+
+        p_result.m_matrix[0].m_simd = row0;
+        p_result.m_matrix[1].m_simd = row1;
+        p_result.m_matrix[2].m_simd = row2;
+        p_result.m_matrix[3].m_simd = _mm_sub_ps(_mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f), inverseTranslation);
+#else
+        const float* m = &p_matrix.m_matrix[0].x;
+        float result[16];
+
+        for (int column = 0; column < 3; column++)
+        {
+            result[column * 4] = m[column];
+            result[column * 4 + 1] = m[4 + column];
+            result[column * 4 + 2] = m[8 + column];
+            result[column * 4 + 3] = 0.0f;
+        }
+
+        // The inverse translation is -transpose(R) * t, the dot products of t with the columns of R
+        for (int component = 0; component < 3; component++)
+            result[12 + component] = -(m[component * 4] * m[12] + m[component * 4 + 1] * m[13] + m[component * 4 + 2] * m[14]);
+
+        result[15] = 1.0f;
+
+        float* destination = &p_result.m_matrix[0].x;
+
+        for (int i = 0; i < 16; i++)
+            destination[i] = result[i];
+#endif
+    }
+
+    /**
+     * Invert p_count matrices, VFloat::Width at a time once transposed to structure of arrays
+     * @note p_result may be p_matrices but must not overlap it partially
+    */
+    inline void Mat4InverseBatch(const FMat4* p_matrices, FMat4* p_result, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        if constexpr (width > 1)
+        {
+            for (; i + width <= p_count; i += width)
+            {
+                VFloat in[4][4];
+                VFloat out[4][4];
+
+                for (int row = 0; row < 4; row++)
+                    LoadTransposed4(&p_matrices[i].m_matrix[row].x, 16, in[row]);
+
+                Mat4InverseSoA(in, out);
+
+                for (int row = 0; row < 4; row++)
+                    StoreTransposed4(&p_result[i].m_matrix[row].x, 16, out[row]);
+            }
+        }
+
+        for (; i < p_count; i++)
+        {
+            Mat4Inverse(p_matrices[i], p_result[i]);
+        }
+    }
+
+    /**
+     * Write the 3 columns of rotation * scale into p_columns, the rotation being a quaternion of any non zero length
+    */
+    LIBMATHS_FORCEINLINE void RotationScale(float p_qx, float p_qy, float p_qz, float p_qw, float p_sx, float p_sy, float p_sz, float (&p_columns)[3][3])
+    {
+        // 2 / |q|^2 folds the normalization into the rotation terms
+        const float s = 2.0f / (p_qx * p_qx + p_qy * p_qy + p_qz * p_qz + p_qw * p_qw);
+        const float xs = p_qx * s;
+        const float ys = p_qy * s;
+        const float zs = p_qz * s;
+        const float xx = p_qx * xs;
+        const float xy = p_qx * ys;
+        const float xz = p_qx * zs;
+        const float yy = p_qy * ys;
+        const float yz = p_qy * zs;
+        const float zz = p_qz * zs;
+        const float xw = p_qw * xs;
+        const float yw = p_qw * ys;
+        const float zw = p_qw * zs;
+
+        p_columns[0][0] = (1.0f - (yy + zz)) * p_sx;
+        p_columns[0][1] = (xy + zw) * p_sx;
+        p_columns[0][2] = (xz - yw) * p_sx;
+
+        p_columns[1][0] = (xy - zw) * p_sy;
+        p_columns[1][1] = (1.0f - (xx + zz)) * p_sy;
+        p_columns[1][2] = (yz + xw) * p_sy;
+
+        p_columns[2][0] = (xz + yw) * p_sz;
+        p_columns[2][1] = (yz - xw) * p_sz;
+        p_columns[2][2] = (1.0f - (xx + yy)) * p_sz;
+    }
+
+    /**
+     * Write translation * rotation * scale into p_result, the rotation being a quaternion of any non zero length
+    */
+    LIBMATHS_FORCEINLINE void Mat4TRS(float p_tx, float p_ty, float p_tz, float p_qx, float p_qy, float p_qz, float p_qw,
+        float p_sx, float p_sy, float p_sz, FMat4& p_result)
+    {
+        float columns[3][3];
+        RotationScale(p_qx, p_qy, p_qz, p_qw, p_sx, p_sy, p_sz, columns);
+
+        for (int i = 0; i < 3; i++)
+        {
+            p_result.m_matrix[i].x = columns[i][0];
+            p_result.m_matrix[i].y = columns[i][1];
+            p_result.m_matrix[i].z = columns[i][2];
+            p_result.m_matrix[i].w = 0.0f;
+        }
+
+        p_result.m_matrix[3].x = p_tx;
+        p_result.m_matrix[3].y = p_ty;
+        p_result.m_matrix[3].z = p_tz;
+        p_result.m_matrix[3].w = 1.0f;
+    }
+
+    /**
+     * Write p_parent * (translation * rotation * scale) into p_result
+     * @note The rows of p_parent are combined with broadcast weights, the local matrix is never stored
+     * and read back, p_result may alias p_parent
+    */
+    LIBMATHS_FORCEINLINE void Mat4MultiplyTRS(const FMat4& p_parent, float p_tx, float p_ty, float p_tz, float p_qx, float p_qy, float p_qz, float p_qw,
+        float p_sx, float p_sy, float p_sz, FMat4& p_result)
+    {
+        float columns[3][3];
+        RotationScale(p_qx, p_qy, p_qz, p_qw, p_sx, p_sy, p_sz, columns);
+
+#if LIBMATHS_USE_SSE
+        const __m128 parent0 = p_parent.m_matrix[0].m_simd;
+        const __m128 parent1 = p_parent.m_matrix[1].m_simd;
+        const __m128 parent2 = p_parent.m_matrix[2].m_simd;
+        const __m128 parent3 = p_parent.m_matrix[3].m_simd;
+
+        for (int i = 0; i < 3; i++)
+        {
+            __m128 row = _mm_mul_ps(parent0, _mm_set1_ps(columns[i][0]));
+            row = MulAdd(parent1, _mm_set1_ps(columns[i][1]), row);
+            p_result.m_matrix[i].m_simd = MulAdd(parent2, _mm_set1_ps(columns[i][2]), row);
+        }
+
+        __m128 translation = MulAdd(parent0, _mm_set1_ps(p_tx), parent3);
+        translation = MulAdd(parent1, _mm_set1_ps(p_ty), translation);
+        p_result.m_matrix[3].m_simd = MulAdd(parent2, _mm_set1_ps(p_tz), translation);
+#else
+        const FVec4 parent0 = p_parent.m_matrix[0];
+        const FVec4 parent1 = p_parent.m_matrix[1];
+        const FVec4 parent2 = p_parent.m_matrix[2];
+        const FVec4 parent3 = p_parent.m_matrix[3];
+
+        for (int i = 0; i < 3; i++)
+        {
+            p_result.m_matrix[i] = parent0 * columns[i][0] + parent1 * columns[i][1] + parent2 * columns[i][2];
+        }
+
+        p_result.m_matrix[3] = parent0 * p_tx + parent1 * p_ty + parent2 * p_tz + parent3;
+#endif
+    }
+
+    /**
+     * Build p_count translation * rotation * scale matrices from structure of arrays lanes
+     * @param p_translations x, y and z lanes
+     * @param p_rotations x, y, z and w lanes of the quaternions
+     * @param p_scales x, y and z lanes
+    */
+    inline void Mat4TRSBatch(const float* const* p_translations, const float* const* p_rotations, const float* const* p_scales, FMat4* p_result, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        if constexpr (width > 1)
+        {
+            const VFloat zero = VFloat::Splat(0.0f);
+            const VFloat one = VFloat::Splat(1.0f);
+            const VFloat two = VFloat::Splat(2.0f);
+
+            for (; i + width <= p_count; i += width)
+            {
+                const VFloat qx = VFloat::Load(p_rotations[0] + i);
+                const VFloat qy = VFloat::Load(p_rotations[1] + i);
+                const VFloat qz = VFloat::Load(p_rotations[2] + i);
+                const VFloat qw = VFloat::Load(p_rotations[3] + i);
+                const VFloat sx = VFloat::Load(p_scales[0] + i);
+                const VFloat sy = VFloat::Load(p_scales[1] + i);
+                const VFloat sz = VFloat::Load(p_scales[2] + i);
+
+                const VFloat s = two / MulAdd(qx, qx, MulAdd(qy, qy, MulAdd(qz, qz, qw * qw)));
+                const VFloat xs = qx * s;
+                const VFloat ys = qy * s;
+                const VFloat zs = qz * s;
+                const VFloat xx = qx * xs;
+                const VFloat xy = qx * ys;
+                const VFloat xz = qx * zs;
+                const VFloat yy = qy * ys;
+                const VFloat yz = qy * zs;
+                const VFloat zz = qz * zs;
+                const VFloat xw = qw * xs;
+                const VFloat yw = qw * ys;
+                const VFloat zw = qw * zs;
+
+                const VFloat columns[4][4] =
+                {
+                    { (one - (yy + zz)) * sx, (xy + zw) * sx, (xz - yw) * sx, zero },
+                    { (xy - zw) * sy, (one - (xx + zz)) * sy, (yz + xw) * sy, zero },
+                    { (xz + yw) * sz, (yz - xw) * sz, (one - (xx + yy)) * sz, zero },
+                    { VFloat::Load(p_translations[0] + i), VFloat::Load(p_translations[1] + i), VFloat::Load(p_translations[2] + i), one }
+                };
+
+                for (int row = 0; row < 4; row++)
+                    StoreTransposed4(&p_result[i].m_matrix[row].x, 16, columns[row]);
+            }
+        }
+
+        for (; i < p_count; i++)
+        {
+            Mat4TRS(p_translations[0][i], p_translations[1][i], p_translations[2][i],
+                p_rotations[0][i], p_rotations[1][i], p_rotations[2][i], p_rotations[3][i],
+                p_scales[0][i], p_scales[1][i], p_scales[2][i], p_result[i]);
+        }
+    }
+}
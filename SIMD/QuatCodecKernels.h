@@ -0,0 +1,366 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "SIMD.h"
+#include "VFloat.h"
+#include "VInt.h"
+#include "../Quaternion/FQuat.hpp"
+
+/**
+ * Smallest three quaternion codecs.
+ *
+ * A unit quaternion is stored as the index of its component of largest
+ * magnitude, the sign of that component and the three other components
+ * quantized over [-1/sqrt(2), 1/sqrt(2)]. The decoder rebuilds the largest
+ * one from the unit length, with its sign, so the hemisphere is kept.
+ * Zero is one of the quantization levels.
+ *
+ * 32 bits: index in bits 30-31, sign in bit 29, then 10, 10 and 9 bits.
+ * 48 bits: three 16 bits words of a 15 bits component each, the high bits
+ * hold the high bit of the index, its low bit and the sign.
+ *
+ * The batch kernels find the largest component with selects, VFloat::Width
+ * records at a time. The remaining records, and the single value functions
+ * of FQuatCodec, use the same formulas in scalar code.
+*/
+namespace lm::simd::inline LIBMATHS_ISA_NAMESPACE
+{
+    static_assert(sizeof(FQuat) == 4 * sizeof(float), "FQuat arrays must be packed xyzw records");
+
+    /**
+     * Bound of the three smallest components of a unit quaternion
+    */
+    inline constexpr float SmallestThreeRange = 0.707106781f;
+
+    /**
+     * Quantization of a component over [-SmallestThreeRange, SmallestThreeRange] on Bits bits
+     * @note 2^Bits - 1 levels, an odd count whose middle one is exactly 0, so the identity and the
+     * rotations about an axis round-trip exactly. The highest code is not used
+    */
+    template<int Bits>
+    struct FQuantization
+    {
+        static constexpr float Steps = static_cast<float>((1u << Bits) - 2u);
+        static constexpr float Scale = Steps / (2.0f * SmallestThreeRange);
+        static constexpr float Step = 2.0f * SmallestThreeRange / Steps;
+        static constexpr float Center = Steps * 0.5f;
+        static constexpr uint32_t Mask = (1u << Bits) - 1u;
+    };
+
+    /**
+     * Clamp p_value to [0, p_max] and round it to the nearest integer, ties to even like RoundToInt
+     * @note With intrinsics when possible: lrint is a library call without -fno-math-errno and the
+     * compilers may branch on the clamp
+    */
+    LIBMATHS_FORCEINLINE uint32_t ClampRoundScalar(float p_value, float p_max)
+    {
+#if LIBMATHS_USE_SSE
+        const __m128 clamped = _mm_min_ss(_mm_max_ss(_mm_set_ss(p_value), _mm_setzero_ps()), _mm_set_ss(p_max));
+        return static_cast<uint32_t>(_mm_cvtss_si32(clamped));
+#else
+        return static_cast<uint32_t>(std::lrint(p_value > p_max ? p_max : (p_value > 0.0f ? p_value : 0.0f)));
+#endif
+    }
+
+    template<int Bits>
+    LIBMATHS_FORCEINLINE uint32_t QuantizeScalar(float p_value)
+    {
+        using Q = FQuantization<Bits>;
+        return ClampRoundScalar((p_value + SmallestThreeRange) * Q::Scale, Q::Steps);
+    }
+
+    template<int Bits>
+    LIBMATHS_FORCEINLINE float DequantizeScalar(uint32_t p_value)
+    {
+        using Q = FQuantization<Bits>;
+        return (static_cast<float>(p_value) - Q::Center) * Q::Step;
+    }
+
+    template<int Bits>
+    LIBMATHS_FORCEINLINE VInt Quantize(VFloat p_value)
+    {
+        using Q = FQuantization<Bits>;
+        const VFloat scaled = (p_value + VFloat::Splat(SmallestThreeRange)) * VFloat::Splat(Q::Scale);
+        return RoundToInt(Min(Max(scaled, VFloat::Splat(0.0f)), VFloat::Splat(Q::Steps)));
+    }
+
+    template<int Bits>
+    LIBMATHS_FORCEINLINE VFloat Dequantize(VInt p_value)
+    {
+        using Q = FQuantization<Bits>;
+        return (ToFloat(p_value) - VFloat::Splat(Q::Center)) * VFloat::Splat(Q::Step);
+    }
+
+    /**
+     * Return |p_value| by clearing the sign bit: std::fabs is an inline function of the standard
+     * library the kernel translation units must not odr-use, and a ternary may become a branch
+    */
+    LIBMATHS_FORCEINLINE float MagnitudeScalar(float p_value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &p_value, sizeof(bits));
+        bits &= 0x7fffffffu;
+        std::memcpy(&p_value, &bits, sizeof(bits));
+        return p_value;
+    }
+
+    /**
+     * Split a quaternion in the index of its largest magnitude (the first one on ties), the sign of that component and the three others
+    */
+    LIBMATHS_FORCEINLINE void SmallestThreeScalar(const float* p_rotation, uint32_t& p_index, uint32_t& p_sign, float p_others[3])
+    {
+        float largest = MagnitudeScalar(p_rotation[3]);
+
+        for (uint32_t c = 0; c < 3; c++)
+            largest = MagnitudeScalar(p_rotation[c]) > largest ? MagnitudeScalar(p_rotation[c]) : largest;
+
+        // Arithmetic on the index rather than branches, which random rotations would mispredict
+        p_index = 3;
+
+        for (uint32_t c = 3; c-- > 0;)
+        {
+            const uint32_t take = !(MagnitudeScalar(p_rotation[c]) < largest);
+            p_index += (c - p_index) & (0u - take);
+        }
+
+        p_sign = p_rotation[p_index] < 0.0f;
+
+        for (uint32_t k = 0; k < 3; k++)
+            p_others[k] = p_rotation[k + (k >= p_index)];
+    }
+
+    /**
+     * Rebuild a quaternion from its three smallest components, the index and the sign of the largest
+    */
+    LIBMATHS_FORCEINLINE void RebuildScalar(uint32_t p_index, uint32_t p_sign, const float p_others[3], float* p_rotation)
+    {
+        const float length2 = p_others[0] * p_others[0] + p_others[1] * p_others[1] + p_others[2] * p_others[2];
+        const float largest = sqrtf(length2 < 1.0f ? 1.0f - length2 : 0.0f);
+
+        for (uint32_t k = 0; k < 3; k++)
+            p_rotation[k + (k >= p_index)] = p_others[k];
+
+        p_rotation[p_index] = largest * (1.0f - 2.0f * static_cast<float>(p_sign));
+    }
+
+    LIBMATHS_FORCEINLINE uint32_t QuatEncode32Scalar(const float* p_rotation)
+    {
+        uint32_t index, sign;
+        float others[3];
+        SmallestThreeScalar(p_rotation, index, sign, others);
+
+        return index << 30 | sign << 29 | QuantizeScalar<10>(others[0]) << 19 | QuantizeScalar<10>(others[1]) << 9 | QuantizeScalar<9>(others[2]);
+    }
+
+    LIBMATHS_FORCEINLINE void QuatDecode32Scalar(uint32_t p_code, float* p_rotation)
+    {
+        const float others[3] =
+        {
+            DequantizeScalar<10>(p_code >> 19 & FQuantization<10>::Mask),
+            DequantizeScalar<10>(p_code >> 9 & FQuantization<10>::Mask),
+            DequantizeScalar<9>(p_code & FQuantization<9>::Mask)
+        };
+
+        RebuildScalar(p_code >> 30, p_code >> 29 & 1u, others, p_rotation);
+    }
+
+    LIBMATHS_FORCEINLINE void QuatEncode48Scalar(const float* p_rotation, uint16_t* p_code)
+    {
+        uint32_t index, sign;
+        float others[3];
+        SmallestThreeScalar(p_rotation, index, sign, others);
+
+        p_code[0] = static_cast<uint16_t>((index >> 1) << 15 | QuantizeScalar<15>(others[0]));
+        p_code[1] = static_cast<uint16_t>((index & 1u) << 15 | QuantizeScalar<15>(others[1]));
+        p_code[2] = static_cast<uint16_t>(sign << 15 | QuantizeScalar<15>(others[2]));
+    }
+
+    LIBMATHS_FORCEINLINE void QuatDecode48Scalar(const uint16_t* p_code, float* p_rotation)
+    {
+        const float others[3] =
+        {
+            DequantizeScalar<15>(p_code[0] & FQuantization<15>::Mask),
+            DequantizeScalar<15>(p_code[1] & FQuantization<15>::Mask),
+            DequantizeScalar<15>(p_code[2] & FQuantization<15>::Mask)
+        };
+
+        RebuildScalar((p_code[0] >> 15) << 1 | p_code[1] >> 15, p_code[2] >> 15, others, p_rotation);
+    }
+
+    /**
+     * Lane version of SmallestThreeScalar, the index and the sign are returned as floats
+    */
+    LIBMATHS_FORCEINLINE void SmallestThree(const VFloat p_rotation[4], VFloat& p_index, VFloat& p_sign, VFloat p_others[3])
+    {
+        VFloat magnitudes[4];
+
+        for (int c = 0; c < 4; c++)
+            magnitudes[c] = Abs(p_rotation[c]);
+
+        const VFloat largest = Max(Max(magnitudes[0], magnitudes[1]), Max(magnitudes[2], magnitudes[3]));
+
+        p_index = VFloat::Splat(3.0f);
+        VFloat value = p_rotation[3];
+
+        for (int c = 3; c-- > 0;)
+        {
+            const VMask smaller = magnitudes[c] < largest;
+            p_index = Select(smaller, p_index, VFloat::Splat(static_cast<float>(c)));
+            value = Select(smaller, value, p_rotation[c]);
+        }
+
+        p_sign = Select(value < VFloat::Splat(0.0f), VFloat::Splat(1.0f), VFloat::Splat(0.0f));
+
+        // Component k is kept when k is before the largest, the next one otherwise
+        for (int k = 0; k < 3; k++)
+            p_others[k] = Select(VFloat::Splat(static_cast<float>(k)) < p_index, p_rotation[k], p_rotation[k + 1]);
+    }
+
+    /**
+     * Lane version of RebuildScalar
+    */
+    LIBMATHS_FORCEINLINE void Rebuild(VFloat p_index, VFloat p_sign, const VFloat p_others[3], VFloat p_rotation[4])
+    {
+        const VFloat length2 = p_others[0] * p_others[0] + p_others[1] * p_others[1] + p_others[2] * p_others[2];
+        VFloat largest = Sqrt(Max(VFloat::Splat(1.0f) - length2, VFloat::Splat(0.0f)));
+        largest = Select(VFloat::Splat(0.5f) < p_sign, -largest, largest);
+
+        p_rotation[0] = Select(VFloat::Splat(0.0f) < p_index, p_others[0], largest);
+
+        for (int c = 1; c < 3; c++)
+        {
+            const VFloat before = Select(VFloat::Splat(c - 0.5f) < p_index, largest, p_others[c - 1]);
+            p_rotation[c] = Select(VFloat::Splat(static_cast<float>(c)) < p_index, p_others[c], before);
+        }
+
+        p_rotation[3] = Select(VFloat::Splat(2.5f) < p_index, largest, p_others[2]);
+    }
+
+    /**
+     * Encode p_count unit quaternions in 32 bits each
+    */
+    inline void QuatEncode32(const FQuat* p_rotations, uint32_t* p_codes, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        for (; i + width <= p_count; i += width)
+        {
+            VFloat rotation[4];
+            LoadTransposed4(&p_rotations[i].x, 4, rotation);
+
+            VFloat index, sign, others[3];
+            SmallestThree(rotation, index, sign, others);
+
+            const VInt code = ShiftLeft<30>(RoundToInt(index)) | ShiftLeft<29>(RoundToInt(sign))
+                | ShiftLeft<19>(Quantize<10>(others[0])) | ShiftLeft<9>(Quantize<10>(others[1])) | Quantize<9>(others[2]);
+            code.Store(p_codes + i);
+        }
+
+        for (; i < p_count; i++)
+            p_codes[i] = QuatEncode32Scalar(&p_rotations[i].x);
+    }
+
+    /**
+     * Decode p_count quaternions of 32 bits
+    */
+    inline void QuatDecode32(const uint32_t* p_codes, FQuat* p_rotations, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        for (; i + width <= p_count; i += width)
+        {
+            const VInt code = VInt::Load(p_codes + i);
+            const VFloat others[3] =
+            {
+                Dequantize<10>(ShiftRight<19>(code) & VInt::Splat(FQuantization<10>::Mask)),
+                Dequantize<10>(ShiftRight<9>(code) & VInt::Splat(FQuantization<10>::Mask)),
+                Dequantize<9>(code & VInt::Splat(FQuantization<9>::Mask))
+            };
+
+            VFloat rotation[4];
+            Rebuild(ToFloat(ShiftRight<30>(code)), ToFloat(ShiftRight<29>(code) & VInt::Splat(1)), others, rotation);
+            StoreTransposed4(&p_rotations[i].x, 4, rotation);
+        }
+
+        for (; i < p_count; i++)
+            QuatDecode32Scalar(p_codes[i], &p_rotations[i].x);
+    }
+
+    /**
+     * Encode p_count unit quaternions in 3 uint16_t each
+    */
+    inline void QuatEncode48(const FQuat* p_rotations, uint16_t* p_codes, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        for (; i + width <= p_count; i += width)
+        {
+            VFloat rotation[4];
+            LoadTransposed4(&p_rotations[i].x, 4, rotation);
+
+            VFloat index, sign, others[3];
+            SmallestThree(rotation, index, sign, others);
+
+            const VInt indexBits = RoundToInt(index);
+            uint32_t words[3][width];
+            (ShiftLeft<14>(indexBits & VInt::Splat(2)) | Quantize<15>(others[0])).Store(words[0]);
+            (ShiftLeft<15>(indexBits & VInt::Splat(1)) | Quantize<15>(others[1])).Store(words[1]);
+            (ShiftLeft<15>(RoundToInt(sign)) | Quantize<15>(others[2])).Store(words[2]);
+
+            // 16 bits words are narrowed while interleaving
+            for (size_t lane = 0; lane < width; lane++)
+            {
+                for (int k = 0; k < 3; k++)
+                    p_codes[3 * (i + lane) + k] = static_cast<uint16_t>(words[k][lane]);
+            }
+        }
+
+        for (; i < p_count; i++)
+            QuatEncode48Scalar(&p_rotations[i].x, p_codes + 3 * i);
+    }
+
+    /**
+     * Decode p_count quaternions of 3 uint16_t
+    */
+    inline void QuatDecode48(const uint16_t* p_codes, FQuat* p_rotations, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        for (; i + width <= p_count; i += width)
+        {
+            uint32_t words[3][width];
+
+            for (size_t lane = 0; lane < width; lane++)
+            {
+                for (int k = 0; k < 3; k++)
+                    words[k][lane] = p_codes[3 * (i + lane) + k];
+            }
+
+            VInt word[3];
+            VFloat others[3];
+
+            for (int k = 0; k < 3; k++)
+            {
+                word[k] = VInt::Load(words[k]);
+                others[k] = Dequantize<15>(word[k] & VInt::Splat(FQuantization<15>::Mask));
+            }
+
+            const VInt index = ShiftLeft<1>(ShiftRight<15>(word[0])) | ShiftRight<15>(word[1]);
+
+            VFloat rotation[4];
+            Rebuild(ToFloat(index), ToFloat(ShiftRight<15>(word[2])), others, rotation);
+            StoreTransposed4(&p_rotations[i].x, 4, rotation);
+        }
+
+        for (; i < p_count; i++)
+            QuatDecode48Scalar(p_codes + 3 * i, &p_rotations[i].x);
+    }
+}
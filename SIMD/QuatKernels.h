@@ -0,0 +1,255 @@
+#pragma once
+
+#include <cstddef>
+
+#include "SIMD.h"
+#include "VFloat.h"
+#include "VMath.h"
+#include "StreamKernels.h"
+#include "../Quaternion/FQuat.hpp"
+#include "../Vec3/FVec3.hpp"
+
+/**
+ * Quaternion kernels.
+ *
+ * The rotations move arrays of vectors to structure of arrays VFloat::Width
+ * at a time and rotate them with v + w * t + u x t, t = 2 * u x v, u being the
+ * vector part of the rotation. The remaining records use the same formula in
+ * scalar code. The interpolations run over padded FQuatStream lanes, every
+ * lane takes the same path. Outputs may be the inputs.
+*/
+namespace lm::simd::inline LIBMATHS_ISA_NAMESPACE
+{
+    static_assert(sizeof(FQuat) == 4 * sizeof(float), "FQuat arrays must be packed xyzw records");
+
+    /**
+     * Rotate the lanes of p_vector by the unit quaternions of the lanes of p_rotation
+    */
+    LIBMATHS_FORCEINLINE void RotateLanes(const VFloat p_rotation[4], VFloat p_vector[3])
+    {
+        const VFloat tx = NegMulAdd(p_rotation[2], p_vector[1], p_rotation[1] * p_vector[2]);
+        const VFloat ty = NegMulAdd(p_rotation[0], p_vector[2], p_rotation[2] * p_vector[0]);
+        const VFloat tz = NegMulAdd(p_rotation[1], p_vector[0], p_rotation[0] * p_vector[1]);
+
+        const VFloat t[3] = { tx + tx, ty + ty, tz + tz };
+
+        p_vector[0] = MulAdd(p_rotation[3], t[0], p_vector[0]) + NegMulAdd(p_rotation[2], t[1], p_rotation[1] * t[2]);
+        p_vector[1] = MulAdd(p_rotation[3], t[1], p_vector[1]) + NegMulAdd(p_rotation[0], t[2], p_rotation[2] * t[0]);
+        p_vector[2] = MulAdd(p_rotation[3], t[2], p_vector[2]) + NegMulAdd(p_rotation[1], t[0], p_rotation[0] * t[1]);
+    }
+
+    /**
+     * Scalar rotation of one vector, the formula of RotateLanes
+    */
+    LIBMATHS_FORCEINLINE void RotateScalar(const float* p_rotation, const FVec3& p_vector, FVec3& p_result)
+    {
+        const float tx = 2.0f * (p_rotation[1] * p_vector.z - p_rotation[2] * p_vector.y);
+        const float ty = 2.0f * (p_rotation[2] * p_vector.x - p_rotation[0] * p_vector.z);
+        const float tz = 2.0f * (p_rotation[0] * p_vector.y - p_rotation[1] * p_vector.x);
+
+        const float x = p_vector.x + p_rotation[3] * tx + (p_rotation[1] * tz - p_rotation[2] * ty);
+        const float y = p_vector.y + p_rotation[3] * ty + (p_rotation[2] * tx - p_rotation[0] * tz);
+        const float z = p_vector.z + p_rotation[3] * tz + (p_rotation[0] * ty - p_rotation[1] * tx);
+
+        p_result.x = x;
+        p_result.y = y;
+        p_result.z = z;
+    }
+
+    /**
+     * Rotate p_count vectors by one unit quaternion
+    */
+    inline void QuatRotateVectors(const FQuat& p_rotation, const FVec3* p_vectors, FVec3* p_result, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        const float* rotation = &p_rotation.x;
+        size_t i = 0;
+
+        if constexpr (width > 1)
+        {
+            const VFloat splat[4] = { VFloat::Splat(rotation[0]), VFloat::Splat(rotation[1]), VFloat::Splat(rotation[2]), VFloat::Splat(rotation[3]) };
+
+            for (; i + width <= p_count; i += width)
+            {
+                VFloat vector[3];
+                LoadTransposed3(&p_vectors[i].x, vector);
+                RotateLanes(splat, vector);
+                StoreTransposed3(&p_result[i].x, vector);
+            }
+        }
+
+        for (; i < p_count; i++)
+            RotateScalar(rotation, p_vectors[i], p_result[i]);
+    }
+
+    /**
+     * Rotate p_vectors[i] by the unit quaternion p_rotations[i] for p_count pairs
+    */
+    inline void QuatRotateVectorsEach(const FQuat* p_rotations, const FVec3* p_vectors, FVec3* p_result, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        if constexpr (width > 1)
+        {
+            for (; i + width <= p_count; i += width)
+            {
+                VFloat rotation[4];
+                VFloat vector[3];
+                LoadTransposed4(&p_rotations[i].x, 4, rotation);
+                LoadTransposed3(&p_vectors[i].x, vector);
+                RotateLanes(rotation, vector);
+                StoreTransposed3(&p_result[i].x, vector);
+            }
+        }
+
+        for (; i < p_count; i++)
+            RotateScalar(&p_rotations[i].x, p_vectors[i], p_result[i]);
+    }
+
+    /**
+     * Return the interpolation factors of block p_index: the lanes of p_alphas, or p_alpha when p_alphas is null, clamped to [0, 1]
+    */
+    LIBMATHS_FORCEINLINE VFloat LoadAlphas(const float* p_alphas, VFloat p_alpha, size_t p_index, size_t p_count)
+    {
+        const VFloat alpha = p_alphas ? LoadPartial(p_alphas + p_index, p_count - p_index) : p_alpha;
+        return Min(Max(alpha, VFloat::Splat(0.0f)), VFloat::Splat(1.0f));
+    }
+
+    /**
+     * Return the dot product of the quaternions of block p_index
+    */
+    LIBMATHS_FORCEINLINE VFloat QuatDot(const VFloat p_left[4], const VFloat p_right[4])
+    {
+        return MulAdd(p_left[3], p_right[3], MulAdd(p_left[2], p_right[2], MulAdd(p_left[1], p_right[1], p_left[0] * p_right[0])));
+    }
+
+    /**
+     * Return the alphas of a normalized lerp whose angles are within 7.8e-4 radians of a slerp
+     * @param p_alpha The slerp factors in [0, 1]
+     * @param p_cos |cos| of the half angle between the quaternions
+     * @note From "Approximating slerp" by Arseny Kapoulkine: a cubic in alpha, zero at 0, 1/2
+     * and 1, whose coefficients are polynomials in p_cos fitted to the error of the plain lerp
+    */
+    LIBMATHS_FORCEINLINE VFloat SLerpFastAlphas(VFloat p_alpha, VFloat p_cos)
+    {
+        const VFloat a = MulAdd(p_cos, MulAdd(p_cos, MulAdd(p_cos, VFloat::Splat(-1.43519f), VFloat::Splat(3.55645f)), VFloat::Splat(-3.2452f)), VFloat::Splat(1.0904f));
+        const VFloat b = MulAdd(p_cos, MulAdd(p_cos, VFloat::Splat(0.215638f), VFloat::Splat(-1.06021f)), VFloat::Splat(0.848013f));
+        const VFloat centered = p_alpha - VFloat::Splat(0.5f);
+        const VFloat k = MulAdd(a * centered, centered, b);
+        return MulAdd(p_alpha * centered * (p_alpha - VFloat::Splat(1.0f)), k, p_alpha);
+    }
+
+    /**
+     * Normalized linear interpolation of p_count quaternion pairs through the shortest arc, with
+     * the alphas of SLerpFastAlphas when Corrected is set
+    */
+    template<bool Corrected>
+    LIBMATHS_FORCEINLINE void QuatStreamNLerpLanes(const float* const* p_start, const float* const* p_end, const float* p_alphas, float p_alpha,
+        float* const* p_result, size_t p_count)
+    {
+        const VFloat zero = VFloat::Splat(0.0f);
+        const VFloat one = VFloat::Splat(1.0f);
+        const VFloat uniformAlpha = VFloat::Splat(p_alpha);
+
+        for (size_t i = 0; i < p_count; i += VFloat::Width)
+        {
+            VFloat start[4];
+            VFloat end[4];
+
+            for (int c = 0; c < 4; c++)
+            {
+                start[c] = VFloat::Load(p_start[c] + i);
+                end[c] = VFloat::Load(p_end[c] + i);
+            }
+
+            const VFloat dot = QuatDot(start, end);
+            VFloat alpha = LoadAlphas(p_alphas, uniformAlpha, i, p_count);
+
+            if constexpr (Corrected)
+                alpha = SLerpFastAlphas(alpha, Abs(dot));
+
+            // q and -q are the same rotation, the end on the side of the start gives the shortest arc
+            const VFloat endWeight = Select(dot < zero, -alpha, alpha);
+
+            VFloat result[4];
+
+            for (int c = 0; c < 4; c++)
+                result[c] = MulAdd(end[c], endWeight, NegMulAdd(start[c], alpha, start[c]));
+
+            const VFloat length2 = QuatDot(result, result);
+            const VFloat inverseLength = Select(length2 > zero, one / Sqrt(length2), zero);
+
+            for (int c = 0; c < 4; c++)
+                (result[c] * inverseLength).Store(p_result[c] + i);
+        }
+    }
+
+    /**
+     * Normalized linear interpolation of p_count quaternion pairs, through the shortest arc
+     * @param p_start x, y, z and w lanes at alpha 0
+     * @param p_end x, y, z and w lanes at alpha 1
+     * @param p_alphas p_count interpolation factors, not padded, or null to use p_alpha for every pair
+     * @param p_result x, y, z and w lanes of the result, zero quaternions stay zero
+    */
+    inline void QuatStreamNLerp(const float* const* p_start, const float* const* p_end, const float* p_alphas, float p_alpha,
+        float* const* p_result, size_t p_count)
+    {
+        QuatStreamNLerpLanes<false>(p_start, p_end, p_alphas, p_alpha, p_result, p_count);
+    }
+
+    /**
+     * Same as QuatStreamNLerp with the alphas corrected by SLerpFastAlphas, within 7.8e-4 radians of QuatStreamSLerp
+    */
+    inline void QuatStreamSLerpFast(const float* const* p_start, const float* const* p_end, const float* p_alphas, float p_alpha,
+        float* const* p_result, size_t p_count)
+    {
+        QuatStreamNLerpLanes<true>(p_start, p_end, p_alphas, p_alpha, p_result, p_count);
+    }
+
+    /**
+     * Spherical linear interpolation of p_count unit quaternion pairs, through the shortest arc
+     * @param p_start x, y, z and w lanes at alpha 0
+     * @param p_end x, y, z and w lanes at alpha 1
+     * @param p_alphas p_count interpolation factors, not padded, or null to use p_alpha for every pair
+     * @param p_result x, y, z and w lanes of the result
+     * @note Below 1.4e-3 radians between the quaternions the weights are the linear ones, which are
+     * then within about 1e-7 of the spherical ones. Zero quaternions give zero
+    */
+    inline void QuatStreamSLerp(const float* const* p_start, const float* const* p_end, const float* p_alphas, float p_alpha,
+        float* const* p_result, size_t p_count)
+    {
+        const VFloat zero = VFloat::Splat(0.0f);
+        const VFloat one = VFloat::Splat(1.0f);
+        const VFloat nearlyParallel = VFloat::Splat(0.999999f);
+        const VFloat uniformAlpha = VFloat::Splat(p_alpha);
+
+        for (size_t i = 0; i < p_count; i += VFloat::Width)
+        {
+            VFloat start[4];
+            VFloat end[4];
+
+            for (int c = 0; c < 4; c++)
+            {
+                start[c] = VFloat::Load(p_start[c] + i);
+                end[c] = VFloat::Load(p_end[c] + i);
+            }
+
+            const VFloat alpha = LoadAlphas(p_alphas, uniformAlpha, i, p_count);
+            const VFloat dot = QuatDot(start, end);
+
+            // The angle is at most pi / 2 once the end is on the side of the start, in the range of Sin
+            const VFloat cosAngle = Min(Abs(dot), one);
+            const VFloat angle = ACos(cosAngle);
+            const VMask linear = cosAngle > nearlyParallel;
+            const VFloat inverseSin = one / Select(linear, one, Sin(angle));
+
+            const VFloat startWeight = Select(linear, one - alpha, Sin((one - alpha) * angle) * inverseSin);
+            VFloat endWeight = Select(linear, alpha, Sin(alpha * angle) * inverseSin);
+            endWeight = Select(dot < zero, -endWeight, endWeight);
+
+            for (int c = 0; c < 4; c++)
+                MulAdd(end[c], endWeight, start[c] * startWeight).Store(p_result[c] + i);
+        }
+    }
+}
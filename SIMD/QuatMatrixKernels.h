@@ -0,0 +1,249 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+#include "SIMD.h"
+#include "VFloat.h"
+#include "../Quaternion/FQuat.hpp"
+#include "../Mat3/FMat3.hpp"
+#include "../Mat4/FMat4.hpp"
+#include "../Affine/FAffine34.hpp"
+
+/**
+ * Conversions between arrays of quaternions and arrays of rotation matrices.
+ *
+ * VFloat::Width records are transposed to lanes at a time. The quaternions do
+ * not need to be normalized: the products are scaled by 2 / |q|^2, which is
+ * the matrix of the normalized quaternion without a square root. An FMat3 is
+ * 9 floats, it is read and written as the 4 floats at 0, 4 and 5, which stay
+ * inside the record. The remaining records are copied to a padded block and
+ * go through the same lanes.
+*/
+namespace lm::simd::inline LIBMATHS_ISA_NAMESPACE
+{
+    static_assert(sizeof(FQuat) == 4 * sizeof(float), "FQuat arrays must be packed xyzw records");
+    static_assert(sizeof(FMat3) == 9 * sizeof(float), "FMat3 arrays must be packed 3x3 records");
+    static_assert(sizeof(FMat4) == 16 * sizeof(float), "FMat4 arrays must be packed 4x4 records");
+    static_assert(sizeof(FAffine34) == 12 * sizeof(float), "FAffine34 arrays must be packed 3x4 records");
+
+    /**
+     * Write the rotation matrix of the lanes of p_rotation in p_columns, p_columns[c][r] being column c, row r
+     * @note The formula of FQuat::ToRotateMat3
+    */
+    LIBMATHS_FORCEINLINE void RotationColumns(const VFloat p_rotation[4], VFloat p_columns[3][3])
+    {
+        const VFloat one = VFloat::Splat(1.0f);
+        const VFloat s = VFloat::Splat(2.0f) / MulAdd(p_rotation[0], p_rotation[0], MulAdd(p_rotation[1], p_rotation[1], MulAdd(p_rotation[2], p_rotation[2], p_rotation[3] * p_rotation[3])));
+        const VFloat xs = p_rotation[0] * s;
+        const VFloat ys = p_rotation[1] * s;
+        const VFloat zs = p_rotation[2] * s;
+        const VFloat xx = p_rotation[0] * xs;
+        const VFloat xy = p_rotation[0] * ys;
+        const VFloat xz = p_rotation[0] * zs;
+        const VFloat yy = p_rotation[1] * ys;
+        const VFloat yz = p_rotation[1] * zs;
+        const VFloat zz = p_rotation[2] * zs;
+        const VFloat xw = p_rotation[3] * xs;
+        const VFloat yw = p_rotation[3] * ys;
+        const VFloat zw = p_rotation[3] * zs;
+
+        p_columns[0][0] = one - (yy + zz);
+        p_columns[0][1] = xy + zw;
+        p_columns[0][2] = xz - yw;
+
+        p_columns[1][0] = xy - zw;
+        p_columns[1][1] = one - (xx + zz);
+        p_columns[1][2] = yz + xw;
+
+        p_columns[2][0] = xz + yw;
+        p_columns[2][1] = yz - xw;
+        p_columns[2][2] = one - (xx + yy);
+    }
+
+    /**
+     * Return the quaternions of the rotation matrices in the lanes of p_columns, p_columns[c][r] being column c, row r
+     * @note The four cases of FQuat::FromMatrix3, the one built on the largest diagonal term is picked with
+     * selects on the same conditions, so both give the same hemisphere
+    */
+    LIBMATHS_FORCEINLINE void RotationFromColumns(const VFloat p_columns[3][3], VFloat p_rotation[4])
+    {
+        const VFloat one = VFloat::Splat(1.0f);
+        const VFloat m00 = p_columns[0][0];
+        const VFloat m11 = p_columns[1][1];
+        const VFloat m22 = p_columns[2][2];
+
+        const VFloat sum01 = p_columns[0][1] + p_columns[1][0];
+        const VFloat sum20 = p_columns[2][0] + p_columns[0][2];
+        const VFloat sum12 = p_columns[1][2] + p_columns[2][1];
+        const VFloat difference12 = p_columns[1][2] - p_columns[2][1];
+        const VFloat difference20 = p_columns[2][0] - p_columns[0][2];
+        const VFloat difference01 = p_columns[0][1] - p_columns[1][0];
+
+        const VFloat tx = one + m00 - m11 - m22;
+        const VFloat ty = one - m00 + m11 - m22;
+        const VFloat tz = one - m00 - m11 + m22;
+        const VFloat tw = one + m00 + m11 + m22;
+
+        const VMask negativeZ = m22 < VFloat::Splat(0.0f);
+        const VMask largestX = m00 > m11;
+        const VMask largestZ = m00 < -m11;
+
+        // x or y when m22 < 0, z or w otherwise
+        const VFloat xy[4] =
+        {
+            Select(largestX, tx, sum01),
+            Select(largestX, sum01, ty),
+            Select(largestX, sum20, sum12),
+            Select(largestX, difference12, difference20)
+        };
+        const VFloat zw[4] =
+        {
+            Select(largestZ, sum20, difference12),
+            Select(largestZ, sum12, difference20),
+            Select(largestZ, tz, difference01),
+            Select(largestZ, difference01, tw)
+        };
+
+        const VFloat t = Select(negativeZ, Select(largestX, tx, ty), Select(largestZ, tz, tw));
+        const VFloat scale = VFloat::Splat(0.5f) / Sqrt(t);
+
+        for (int c = 0; c < 4; c++)
+            p_rotation[c] = Select(negativeZ, xy[c], zw[c]) * scale;
+    }
+
+    /**
+     * Read Width FMat3 records of 9 floats at p_source into p_columns
+    */
+    LIBMATHS_FORCEINLINE void LoadMat3Lanes(const float* p_source, VFloat p_columns[3][3])
+    {
+        VFloat low[4];
+        VFloat middle[4];
+        VFloat high[4];
+        LoadTransposed4(p_source, 9, low);
+        LoadTransposed4(p_source + 4, 9, middle);
+        LoadTransposed4(p_source + 5, 9, high);
+
+        p_columns[0][0] = low[0];
+        p_columns[0][1] = low[1];
+        p_columns[0][2] = low[2];
+        p_columns[1][0] = low[3];
+        p_columns[1][1] = middle[0];
+        p_columns[1][2] = middle[1];
+        p_columns[2][0] = middle[2];
+        p_columns[2][1] = middle[3];
+        p_columns[2][2] = high[3];
+    }
+
+    /**
+     * Write p_columns as Width FMat3 records of 9 floats at p_destination
+    */
+    LIBMATHS_FORCEINLINE void StoreMat3Lanes(float* p_destination, const VFloat p_columns[3][3])
+    {
+        const VFloat low[4] = { p_columns[0][0], p_columns[0][1], p_columns[0][2], p_columns[1][0] };
+        const VFloat middle[4] = { p_columns[1][1], p_columns[1][2], p_columns[2][0], p_columns[2][1] };
+        const VFloat high[4] = { p_columns[1][2], p_columns[2][0], p_columns[2][1], p_columns[2][2] };
+        StoreTransposed4(p_destination, 9, low);
+        StoreTransposed4(p_destination + 4, 9, middle);
+        StoreTransposed4(p_destination + 5, 9, high);
+    }
+
+    /**
+     * Run p_block over the p_count records of p_input, Width at a time, the last ones from a padded copy
+     * @param p_block Called with the input and output floats of Width records
+     * @note The padding records are zeros, their results are discarded
+    */
+    template<size_t InputFloats, size_t OutputFloats, typename Block>
+    LIBMATHS_FORCEINLINE void ForEachBlock(const float* p_input, float* p_output, size_t p_count, Block p_block)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        for (; i + width <= p_count; i += width)
+            p_block(p_input + i * InputFloats, p_output + i * OutputFloats);
+
+        if (i < p_count)
+        {
+            float input[width * InputFloats] = {};
+            float output[width * OutputFloats];
+            std::memcpy(input, p_input + i * InputFloats, (p_count - i) * InputFloats * sizeof(float));
+            p_block(input, output);
+            std::memcpy(p_output + i * OutputFloats, output, (p_count - i) * OutputFloats * sizeof(float));
+        }
+    }
+
+    /**
+     * Write the rotation matrices of p_count quaternions, which need not be normalized
+    */
+    inline void QuatToMat3Batch(const FQuat* p_rotations, FMat3* p_result, size_t p_count)
+    {
+        ForEachBlock<4, 9>(reinterpret_cast<const float*>(p_rotations), reinterpret_cast<float*>(p_result), p_count, [](const float* p_input, float* p_output)
+        {
+            VFloat rotation[4];
+            VFloat columns[3][3];
+            LoadTransposed4(p_input, 4, rotation);
+            RotationColumns(rotation, columns);
+            StoreMat3Lanes(p_output, columns);
+        });
+    }
+
+    /**
+     * Write the rotations of p_count quaternions, which need not be normalized, as FAffine34 without translation
+    */
+    inline void QuatToAffine34Batch(const FQuat* p_rotations, FAffine34* p_result, size_t p_count)
+    {
+        ForEachBlock<4, 12>(reinterpret_cast<const float*>(p_rotations), reinterpret_cast<float*>(p_result), p_count, [](const float* p_input, float* p_output)
+        {
+            const VFloat zero = VFloat::Splat(0.0f);
+            VFloat rotation[4];
+            VFloat columns[3][3];
+            LoadTransposed4(p_input, 4, rotation);
+            RotationColumns(rotation, columns);
+
+            for (int row = 0; row < 3; row++)
+            {
+                const VFloat values[4] = { columns[0][row], columns[1][row], columns[2][row], zero };
+                StoreTransposed4(p_output + row * 4, 12, values);
+            }
+        });
+    }
+
+    /**
+     * Write the rotations of p_count quaternions, which need not be normalized, as FMat4 without translation
+    */
+    inline void QuatToMat4Batch(const FQuat* p_rotations, FMat4* p_result, size_t p_count)
+    {
+        ForEachBlock<4, 16>(reinterpret_cast<const float*>(p_rotations), reinterpret_cast<float*>(p_result), p_count, [](const float* p_input, float* p_output)
+        {
+            const VFloat zero = VFloat::Splat(0.0f);
+            VFloat rotation[4];
+            VFloat columns[3][3];
+            LoadTransposed4(p_input, 4, rotation);
+            RotationColumns(rotation, columns);
+
+            for (int column = 0; column < 3; column++)
+            {
+                const VFloat values[4] = { columns[column][0], columns[column][1], columns[column][2], zero };
+                StoreTransposed4(p_output + column * 4, 16, values);
+            }
+
+            const VFloat translation[4] = { zero, zero, zero, VFloat::Splat(1.0f) };
+            StoreTransposed4(p_output + 12, 16, translation);
+        });
+    }
+
+    /**
+     * Write the quaternions of p_count rotation matrices
+    */
+    inline void Mat3ToQuatBatch(const FMat3* p_matrices, FQuat* p_result, size_t p_count)
+    {
+        ForEachBlock<9, 4>(reinterpret_cast<const float*>(p_matrices), reinterpret_cast<float*>(p_result), p_count, [](const float* p_input, float* p_output)
+        {
+            VFloat columns[3][3];
+            VFloat rotation[4];
+            LoadMat3Lanes(p_input, columns);
+            RotationFromColumns(columns, rotation);
+            StoreTransposed4(p_output, 4, rotation);
+        });
+    }
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+/**
+ * SIMD configuration of LibMaths.
+ *
+ * The instruction sets are detected from the compiler flags of the current
+ * translation unit. Define LIBMATHS_NO_SIMD to force the scalar fallback.
+*/
+
+#if !defined(LIBMATHS_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define LIBMATHS_USE_SSE 1
+#else
+#define LIBMATHS_USE_SSE 0
+#endif
+
+#if LIBMATHS_USE_SSE && (defined(__SSE4_1__) || defined(__AVX__))
+#define LIBMATHS_USE_SSE41 1
+#else
+#define LIBMATHS_USE_SSE41 0
+#endif
+
+#if LIBMATHS_USE_SSE && defined(__AVX__)
+#define LIBMATHS_USE_AVX 1
+#else
+#define LIBMATHS_USE_AVX 0
+#endif
+
+#if LIBMATHS_USE_SSE && defined(__AVX2__)
+#define LIBMATHS_USE_AVX2 1
+#else
+#define LIBMATHS_USE_AVX2 0
+#endif
+
+#if LIBMATHS_USE_SSE && (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#define LIBMATHS_USE_FMA 1
+#else
+#define LIBMATHS_USE_FMA 0
+#endif
+
+#if LIBMATHS_USE_SSE && defined(__AVX512F__)
+#define LIBMATHS_USE_AVX512 1
+#else
+#define LIBMATHS_USE_AVX512 0
+#endif
+
+#if LIBMATHS_USE_SSE
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#define LIBMATHS_FORCEINLINE __forceinline
+#else
+#define LIBMATHS_FORCEINLINE inline __attribute__((always_inline))
+#endif
+
+/**
+ * The kernels live in an inline namespace named after the enabled instruction
+ * sets, so translation units built for different levels (see Dispatch.hpp)
+ * never share an inline definition.
+*/
+#define LIBMATHS_ISA_PASTE_(p_sse, p_sse41, p_avx, p_avx2, p_fma, p_avx512) isa_##p_sse##p_sse41##p_avx##p_avx2##p_fma##p_avx512
+#define LIBMATHS_ISA_PASTE(...) LIBMATHS_ISA_PASTE_(__VA_ARGS__)
+#define LIBMATHS_ISA_NAMESPACE LIBMATHS_ISA_PASTE(LIBMATHS_USE_SSE, LIBMATHS_USE_SSE41, LIBMATHS_USE_AVX, \
+    LIBMATHS_USE_AVX2, LIBMATHS_USE_FMA, LIBMATHS_USE_AVX512)
+
+namespace lm::simd::inline LIBMATHS_ISA_NAMESPACE
+{
+#if LIBMATHS_USE_SSE
+    /**
+     * Shuffle the lanes of a register, lane i of the result is lane Si of p_value
+    */
+    template<int S0, int S1, int S2, int S3>
+    LIBMATHS_FORCEINLINE __m128 Swizzle(__m128 p_value)
+    {
+        return _mm_shuffle_ps(p_value, p_value, _MM_SHUFFLE(S3, S2, S1, S0));
+    }
+
+    /**
+     * Return p_a * p_b + p_c, fused when the target supports it
+    */
+    LIBMATHS_FORCEINLINE __m128 MulAdd(__m128 p_a, __m128 p_b, __m128 p_c)
+    {
+#if LIBMATHS_USE_FMA
+        return _mm_fmadd_ps(p_a, p_b, p_c);
+#else
+        return _mm_add_ps(_mm_mul_ps(p_a, p_b), p_c);
+#endif
+    }
+
+    /**
+     * Return the sum of the four lanes broadcast in every lane
+    */
+    LIBMATHS_FORCEINLINE __m128 HorizontalSum(__m128 p_value)
+    {
+        __m128 sum = _mm_add_ps(p_value, Swizzle<1, 0, 3, 2>(p_value));
+        return _mm_add_ps(sum, Swizzle<2, 3, 0, 1>(sum));
+    }
+
+    /**
+     * Return the 4 lanes dot product broadcast in every lane
+    */
+    LIBMATHS_FORCEINLINE __m128 Dot4(__m128 p_left, __m128 p_right)
+    {
+#if LIBMATHS_USE_SSE41
+        return _mm_dp_ps(p_left, p_right, 0xFF);
+#else
+        return HorizontalSum(_mm_mul_ps(p_left, p_right));
+#endif
+    }
+
+    /**
+     * Return the cross product of the x, y, z lanes, the w lane of the result is 0
+    */
+    LIBMATHS_FORCEINLINE __m128 Cross3(__m128 p_left, __m128 p_right)
+    {
+        return _mm_sub_ps(_mm_mul_ps(Swizzle<1, 2, 0, 3>(p_left), Swizzle<2, 0, 1, 3>(p_right)),
+            _mm_mul_ps(Swizzle<2, 0, 1, 3>(p_left), Swizzle<1, 2, 0, 3>(p_right)));
+    }
+
+    /**
+     * Return the Hamilton product of two x, y, z, w quaternions, p_right being applied first
+     * @note Each lane of p_left scales a swizzle of p_right with its signs flipped by a xor
+    */
+    LIBMATHS_FORCEINLINE __m128 QuatMultiply(__m128 p_left, __m128 p_right)
+    {
+        const __m128 xSigns = _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f);
+        const __m128 ySigns = _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f);
+        const __m128 zSigns = _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f);
+
+        // Two independent chains summed at the end, shorter than one chain of three MulAdd
+        const __m128 wx = MulAdd(Swizzle<0, 0, 0, 0>(p_left), _mm_xor_ps(Swizzle<3, 2, 1, 0>(p_right), xSigns),
+            _mm_mul_ps(Swizzle<3, 3, 3, 3>(p_left), p_right));
+        const __m128 yz = MulAdd(Swizzle<2, 2, 2, 2>(p_left), _mm_xor_ps(Swizzle<1, 0, 3, 2>(p_right), zSigns),
+            _mm_mul_ps(Swizzle<1, 1, 1, 1>(p_left), _mm_xor_ps(Swizzle<2, 3, 0, 1>(p_right), ySigns)));
+        return _mm_add_ps(wx, yz);
+    }
+#endif
+}
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "SIMD.h"
+#include "VFloat.h"
+#include "StreamKernels.h"
+
+/**
+ * Skinning kernels over structure of arrays vertex streams.
+ *
+ * Vertices are processed VFloat::Width at a time, the bone records of the
+ * lanes are loaded whole by index and transposed into registers. The influence and position lanes
+ * are padded so the last block loads whole registers, only its first lanes
+ * are stored.
+*/
+namespace lm::simd::inline LIBMATHS_ISA_NAMESPACE
+{
+    inline constexpr int SkinInfluences = 4;
+
+    /**
+     * Dual quaternion skinning of p_count vertices
+     * @param p_bones 8 floats per bone: the real part x, y, z, w then the dual part x, y, z, w
+     * @param p_indices SkinInfluences lanes of bone indices
+     * @param p_weights SkinInfluences lanes of weights
+     * @param p_positions x, y and z lanes of the bind pose
+     * @param p_result x, y and z lanes of the skinned positions, may be p_positions
+    */
+    inline void DualQuatSkin(const float* p_bones, const uint32_t* const* p_indices, const float* const* p_weights,
+        const float* const* p_positions, float* const* p_result, size_t p_count)
+    {
+        const VFloat zero = VFloat::Splat(0.0f);
+        const VFloat one = VFloat::Splat(1.0f);
+
+        for (size_t i = 0; i < p_count; i += VFloat::Width)
+        {
+            VFloat first[4];
+            VFloat real[4];
+            VFloat dual[4];
+
+            GatherTransposed4(p_bones, 8, p_indices[0] + i, first);
+            GatherTransposed4(p_bones + 4, 8, p_indices[0] + i, dual);
+
+            const VFloat firstWeight = VFloat::Load(p_weights[0] + i);
+
+            for (int c = 0; c < 4; c++)
+            {
+                real[c] = first[c] * firstWeight;
+                dual[c] = dual[c] * firstWeight;
+            }
+
+            for (int influence = 1; influence < SkinInfluences; influence++)
+            {
+                VFloat bone[4];
+                VFloat boneDual[4];
+                GatherTransposed4(p_bones, 8, p_indices[influence] + i, bone);
+                GatherTransposed4(p_bones + 4, 8, p_indices[influence] + i, boneDual);
+
+                // q and -q are the same rotation, blend the one on the side of the first bone
+                const VFloat dot = MulAdd(bone[0], first[0], MulAdd(bone[1], first[1], MulAdd(bone[2], first[2], bone[3] * first[3])));
+                const VFloat weight = VFloat::Load(p_weights[influence] + i);
+                const VFloat signedWeight = Select(dot < zero, -weight, weight);
+
+                for (int c = 0; c < 4; c++)
+                {
+                    real[c] = MulAdd(bone[c], signedWeight, real[c]);
+                    dual[c] = MulAdd(boneDual[c], signedWeight, dual[c]);
+                }
+            }
+
+            // A zero blend gives zero parts, which leave the position unchanged
+            const VFloat squaredLength = MulAdd(real[0], real[0], MulAdd(real[1], real[1], MulAdd(real[2], real[2], real[3] * real[3])));
+            const VFloat inverseLength = Select(squaredLength > zero, one / Sqrt(squaredLength), zero);
+
+            for (int c = 0; c < 4; c++)
+            {
+                real[c] = real[c] * inverseLength;
+                dual[c] = dual[c] * inverseLength;
+            }
+
+            const VFloat px = VFloat::Load(p_positions[0] + i);
+            const VFloat py = VFloat::Load(p_positions[1] + i);
+            const VFloat pz = VFloat::Load(p_positions[2] + i);
+
+            // Rotation: p + 2 * r x (r x p + rw * p)
+            const VFloat ux = MulAdd(real[3], px, NegMulAdd(real[2], py, real[1] * pz));
+            const VFloat uy = MulAdd(real[3], py, NegMulAdd(real[0], pz, real[2] * px));
+            const VFloat uz = MulAdd(real[3], pz, NegMulAdd(real[1], px, real[0] * py));
+
+            const VFloat rx = NegMulAdd(real[2], uy, real[1] * uz);
+            const VFloat ry = NegMulAdd(real[0], uz, real[2] * ux);
+            const VFloat rz = NegMulAdd(real[1], ux, real[0] * uy);
+
+            // Translation: 2 * (rw * d - dw * r + r x d)
+            const VFloat tx = MulAdd(real[3], dual[0], NegMulAdd(dual[3], real[0], NegMulAdd(real[2], dual[1], real[1] * dual[2])));
+            const VFloat ty = MulAdd(real[3], dual[1], NegMulAdd(dual[3], real[1], NegMulAdd(real[0], dual[2], real[2] * dual[0])));
+            const VFloat tz = MulAdd(real[3], dual[2], NegMulAdd(dual[3], real[2], NegMulAdd(real[1], dual[0], real[0] * dual[1])));
+
+            const VFloat two = one + one;
+            const size_t remaining = p_count - i;
+
+            StorePartial(p_result[0] + i, MulAdd(two, rx + tx, px), remaining);
+            StorePartial(p_result[1] + i, MulAdd(two, ry + ty, py), remaining);
+            StorePartial(p_result[2] + i, MulAdd(two, rz + tz, pz), remaining);
+        }
+    }
+
+    /**
+     * Load the palette matrices of Width lanes as 3 rows of 4 registers: the linear part in columns 0 to 2, the translation in column 3
+     * @tparam Rows true for FAffine34 records (3 rows of 4 floats), false for FMat4 records (4 columns of 4 floats)
+    */
+    template<bool Rows>
+    LIBMATHS_FORCEINLINE void GatherPalette(const float* p_palette, const uint32_t* p_indices, VFloat p_matrix[3][4])
+    {
+        if constexpr (Rows)
+        {
+            for (int row = 0; row < 3; row++)
+                GatherTransposed4(p_palette + 4 * row, 12, p_indices, p_matrix[row]);
+        }
+        else
+        {
+            for (int column = 0; column < 4; column++)
+            {
+                VFloat values[4];
+                GatherTransposed4(p_palette + 4 * column, 16, p_indices, values);
+
+                for (int row = 0; row < 3; row++)
+                    p_matrix[row][column] = values[row];
+            }
+        }
+    }
+
+    /**
+     * Linear blend skinning of p_count vertices: the palette matrices of the influences are blended by weight
+     * in registers, then transform the position and, when p_normals is not null, the normal which is renormalized
+     * @tparam Rows true for a FAffine34 palette, false for a FMat4 palette
+     * @param p_palette The first float of the palette
+     * @param p_indices SkinInfluences lanes of palette indices
+     * @param p_weights SkinInfluences lanes of weights
+     * @param p_positions x, y and z lanes of the bind pose positions
+     * @param p_normals x, y and z lanes of the bind pose normals, or null
+     * @param p_resultPositions x, y and z lanes of the skinned positions, may be p_positions
+     * @param p_resultNormals x, y and z lanes of the skinned normals, may be p_normals
+    */
+    template<bool Rows>
+    inline void LinearBlendSkin(const float* p_palette, const uint32_t* const* p_indices, const float* const* p_weights,
+        const float* const* p_positions, const float* const* p_normals, float* const* p_resultPositions, float* const* p_resultNormals, size_t p_count)
+    {
+        const VFloat zero = VFloat::Splat(0.0f);
+        const VFloat one = VFloat::Splat(1.0f);
+
+        for (size_t i = 0; i < p_count; i += VFloat::Width)
+        {
+            VFloat blend[3][4];
+            VFloat bone[3][4];
+
+            GatherPalette<Rows>(p_palette, p_indices[0] + i, bone);
+            VFloat totalWeight = VFloat::Load(p_weights[0] + i);
+
+            for (int row = 0; row < 3; row++)
+                for (int column = 0; column < 4; column++)
+                    blend[row][column] = bone[row][column] * totalWeight;
+
+            for (int influence = 1; influence < SkinInfluences; influence++)
+            {
+                GatherPalette<Rows>(p_palette, p_indices[influence] + i, bone);
+                const VFloat weight = VFloat::Load(p_weights[influence] + i);
+                totalWeight = totalWeight + weight;
+
+                for (int row = 0; row < 3; row++)
+                    for (int column = 0; column < 4; column++)
+                        blend[row][column] = MulAdd(bone[row][column], weight, blend[row][column]);
+            }
+
+            // Vertices without weight keep their position and normal
+            const VMask weighted = (totalWeight > zero) | (totalWeight < zero);
+            const size_t remaining = p_count - i;
+
+            const VFloat px = VFloat::Load(p_positions[0] + i);
+            const VFloat py = VFloat::Load(p_positions[1] + i);
+            const VFloat pz = VFloat::Load(p_positions[2] + i);
+            const VFloat position[3] = { px, py, pz };
+
+            for (int row = 0; row < 3; row++)
+            {
+                const VFloat skinned = MulAdd(blend[row][0], px, MulAdd(blend[row][1], py, MulAdd(blend[row][2], pz, blend[row][3])));
+                StorePartial(p_resultPositions[row] + i, Select(weighted, skinned, position[row]), remaining);
+            }
+
+            if (p_normals == nullptr)
+                continue;
+
+            const VFloat nx = VFloat::Load(p_normals[0] + i);
+            const VFloat ny = VFloat::Load(p_normals[1] + i);
+            const VFloat nz = VFloat::Load(p_normals[2] + i);
+            const VFloat normal[3] = { nx, ny, nz };
+
+            VFloat skinned[3];
+            for (int row = 0; row < 3; row++)
+                skinned[row] = MulAdd(blend[row][0], nx, MulAdd(blend[row][1], ny, blend[row][2] * nz));
+
+            const VFloat squaredLength = MulAdd(skinned[0], skinned[0], MulAdd(skinned[1], skinned[1], skinned[2] * skinned[2]));
+            const VFloat inverseLength = Select(squaredLength > zero, one / Sqrt(squaredLength), zero);
+
+            for (int row = 0; row < 3; row++)
+                StorePartial(p_resultNormals[row] + i, Select(weighted, skinned[row] * inverseLength, normal[row]), remaining);
+        }
+    }
+
+    inline void Mat4LinearBlendSkin(const float* p_palette, const uint32_t* const* p_indices, const float* const* p_weights,
+        const float* const* p_positions, const float* const* p_normals, float* const* p_resultPositions, float* const* p_resultNormals, size_t p_count)
+    {
+        LinearBlendSkin<false>(p_palette, p_indices, p_weights, p_positions, p_normals, p_resultPositions, p_resultNormals, p_count);
+    }
+
+    inline void Affine34LinearBlendSkin(const float* p_palette, const uint32_t* const* p_indices, const float* const* p_weights,
+        const float* const* p_positions, const float* const* p_normals, float* const* p_resultPositions, float* const* p_resultNormals, size_t p_count)
+    {
+        LinearBlendSkin<true>(p_palette, p_indices, p_weights, p_positions, p_normals, p_resultPositions, p_resultNormals, p_count);
+    }
+}
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <cstddef>
+
+#include "SIMD.h"
+#include "VFloat.h"
+
+/**
+ * Kernels of the structure of arrays streams.
+ *
+ * A stream element with N components is spread over N lanes, the lanes come
+ * from FLaneBuffer so they are padded: kernels writing lanes run over the
+ * padded size, kernels reading lanes may read whole registers past p_count.
+ * Results may be written over the inputs.
+*/
+namespace lm::simd::inline LIBMATHS_ISA_NAMESPACE
+{
+    /**
+     * Store the first p_count lanes of p_value
+    */
+    LIBMATHS_FORCEINLINE void StorePartial(float* p_destination, VFloat p_value, size_t p_count)
+    {
+        if (p_count >= VFloat::Width)
+        {
+            p_value.Store(p_destination);
+            return;
+        }
+
+        float lanes[VFloat::Width];
+        p_value.Store(lanes);
+
+        for (size_t i = 0; i < p_count; i++)
+            p_destination[i] = lanes[i];
+    }
+
+    /**
+     * Load the first p_count lanes, the others are 0
+    */
+    LIBMATHS_FORCEINLINE VFloat LoadPartial(const float* p_source, size_t p_count)
+    {
+        if (p_count >= VFloat::Width)
+            return VFloat::Load(p_source);
+
+        float lanes[VFloat::Width] = {};
+
+        for (size_t i = 0; i < p_count; i++)
+            lanes[i] = p_source[i];
+
+        return VFloat::Load(lanes);
+    }
+
+    /**
+     * Return the sum of the squared components of element block p_index
+    */
+    LIBMATHS_FORCEINLINE VFloat SquaredLength(const float* const* p_values, int p_components, size_t p_index)
+    {
+        VFloat result = VFloat::Load(p_values[0] + p_index) * VFloat::Load(p_values[0] + p_index);
+
+        for (int component = 1; component < p_components; component++)
+        {
+            const VFloat value = VFloat::Load(p_values[component] + p_index);
+            result = MulAdd(value, value, result);
+        }
+
+        return result;
+    }
+
+    /**
+     * p_result[i] = p_left[i] + p_right[i] over p_count padded elements
+    */
+    inline void StreamAdd(const float* p_left, const float* p_right, float* p_result, size_t p_count)
+    {
+        for (size_t i = 0; i < p_count; i += VFloat::Width)
+            (VFloat::Load(p_left + i) + VFloat::Load(p_right + i)).Store(p_result + i);
+    }
+
+    /**
+     * p_result[i] = p_values[i] * p_scale over p_count padded elements
+    */
+    inline void StreamScale(const float* p_values, float p_scale, float* p_result, size_t p_count)
+    {
+        const VFloat scale = VFloat::Splat(p_scale);
+
+        for (size_t i = 0; i < p_count; i += VFloat::Width)
+            (VFloat::Load(p_values + i) * scale).Store(p_result + i);
+    }
+
+    /**
+     * p_result[i] = p_start[i] + (p_end[i] - p_start[i]) * p_alpha over p_count padded elements
+    */
+    inline void StreamLerp(const float* p_start, const float* p_end, float p_alpha, float* p_result, size_t p_count)
+    {
+        const VFloat alpha = VFloat::Splat(p_alpha);
+
+        for (size_t i = 0; i < p_count; i += VFloat::Width)
+        {
+            const VFloat start = VFloat::Load(p_start + i);
+            MulAdd(VFloat::Load(p_end + i) - start, alpha, start).Store(p_result + i);
+        }
+    }
+
+    /**
+     * Dot product of p_count elements of p_components lanes, p_result is not padded
+    */
+    inline void StreamDot(const float* const* p_left, const float* const* p_right, int p_components, float* p_result, size_t p_count)
+    {
+        for (size_t i = 0; i < p_count; i += VFloat::Width)
+        {
+            VFloat result = VFloat::Load(p_left[0] + i) * VFloat::Load(p_right[0] + i);
+
+            for (int component = 1; component < p_components; component++)
+                result = MulAdd(VFloat::Load(p_left[component] + i), VFloat::Load(p_right[component] + i), result);
+
+            StorePartial(p_result + i, result, p_count - i);
+        }
+    }
+
+    /**
+     * Length of p_count elements of p_components lanes, p_result is not padded
+    */
+    inline void StreamLength(const float* const* p_values, int p_components, float* p_result, size_t p_count)
+    {
+        for (size_t i = 0; i < p_count; i += VFloat::Width)
+            StorePartial(p_result + i, Sqrt(SquaredLength(p_values, p_components, i)), p_count - i);
+    }
+
+    /**
+     * Normalize p_count padded elements of p_components lanes, zero vectors stay zero
+    */
+    inline void StreamNormalize(const float* const* p_values, int p_components, float* const* p_result, size_t p_count)
+    {
+        const VFloat zero = VFloat::Splat(0.0f);
+        const VFloat one = VFloat::Splat(1.0f);
+
+        for (size_t i = 0; i < p_count; i += VFloat::Width)
+        {
+            const VFloat length2 = SquaredLength(p_values, p_components, i);
+            const VMask nonZero = length2 > zero;
+            const VFloat inverseLength = one / Sqrt(length2);
+
+            for (int component = 0; component < p_components; component++)
+                Select(nonZero, VFloat::Load(p_values[component] + i) * inverseLength, zero).Store(p_result[component] + i);
+        }
+    }
+
+    /**
+     * Cross product of p_count padded 3 components elements
+    */
+    inline void StreamCross(const float* const* p_left, const float* const* p_right, float* const* p_result, size_t p_count)
+    {
+        for (size_t i = 0; i < p_count; i += VFloat::Width)
+        {
+            const VFloat lx = VFloat::Load(p_left[0] + i);
+            const VFloat ly = VFloat::Load(p_left[1] + i);
+            const VFloat lz = VFloat::Load(p_left[2] + i);
+            const VFloat rx = VFloat::Load(p_right[0] + i);
+            const VFloat ry = VFloat::Load(p_right[1] + i);
+            const VFloat rz = VFloat::Load(p_right[2] + i);
+
+            NegMulAdd(lz, ry, ly * rz).Store(p_result[0] + i);
+            NegMulAdd(lx, rz, lz * rx).Store(p_result[1] + i);
+            NegMulAdd(ly, rx, lx * ry).Store(p_result[2] + i);
+        }
+    }
+
+    /**
+     * Split p_count packed records of p_components floats into lanes
+    */
+    inline void StreamDeinterleave(const float* p_records, int p_components, float* const* p_lanes, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        if constexpr (width > 1)
+        {
+            if (p_components == 4)
+            {
+                for (; i + width <= p_count; i += width)
+                {
+                    VFloat values[4];
+                    LoadTransposed4(p_records + i * 4, 4, values);
+
+                    for (int component = 0; component < 4; component++)
+                        values[component].Store(p_lanes[component] + i);
+                }
+            }
+            else if (p_components == 3)
+            {
+                for (; i + width <= p_count; i += width)
+                {
+                    VFloat values[3];
+                    LoadTransposed3(p_records + i * 3, values);
+
+                    for (int component = 0; component < 3; component++)
+                        values[component].Store(p_lanes[component] + i);
+                }
+            }
+        }
+
+        for (; i < p_count; i++)
+        {
+            for (int component = 0; component < p_components; component++)
+                p_lanes[component][i] = p_records[i * p_components + component];
+        }
+    }
+
+    /**
+     * Pack p_count elements of p_components lanes into records
+    */
+    inline void StreamInterleave(const float* const* p_lanes, int p_components, float* p_records, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        if constexpr (width > 1)
+        {
+            if (p_components == 4)
+            {
+                for (; i + width <= p_count; i += width)
+                {
+                    VFloat values[4];
+
+                    for (int component = 0; component < 4; component++)
+                        values[component] = VFloat::Load(p_lanes[component] + i);
+
+                    StoreTransposed4(p_records + i * 4, 4, values);
+                }
+            }
+            else if (p_components == 3)
+            {
+                for (; i + width <= p_count; i += width)
+                {
+                    VFloat values[3];
+
+                    for (int component = 0; component < 3; component++)
+                        values[component] = VFloat::Load(p_lanes[component] + i);
+
+                    StoreTransposed3(p_records + i * 3, values);
+                }
+            }
+        }
+
+        for (; i < p_count; i++)
+        {
+            for (int component = 0; component < p_components; component++)
+                p_records[i * p_components + component] = p_lanes[component][i];
+        }
+    }
+}
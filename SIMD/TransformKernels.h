@@ -0,0 +1,252 @@
+#pragma once
+
+#include <cstddef>
+
+#include "SIMD.h"
+#include "VFloat.h"
+#include "../Mat4/FMat4.hpp"
+#include "../Vec3/FVec3.hpp"
+
+/**
+ * Kernels transforming arrays of points and vectors by one FMat4.
+ *
+ * The records are moved to structure of arrays VFloat::Width at a time, so
+ * every lane transforms its own point with the matrix components splatted
+ * once per call. The remaining records use the same formula in scalar code.
+ * Outputs may be the inputs when both have the same type.
+*/
+namespace lm::simd::inline LIBMATHS_ISA_NAMESPACE
+{
+    static_assert(sizeof(FVec3) == 3 * sizeof(float), "FVec3 arrays must be packed xyz records");
+    static_assert(sizeof(FVec4) == 4 * sizeof(float), "FVec4 arrays must be packed xyzw records");
+
+    /**
+     * Components of a matrix, each splatted across a register
+    */
+    struct VMat4
+    {
+        VFloat m[4][4];
+
+        explicit LIBMATHS_FORCEINLINE VMat4(const FMat4& p_matrix)
+        {
+            const float* source = &p_matrix.m_matrix[0].x;
+
+            for (int row = 0; row < 4; row++)
+            {
+                for (int column = 0; column < 4; column++)
+                    m[row][column] = VFloat::Splat(source[row * 4 + column]);
+            }
+        }
+
+        /**
+         * Return column p_column of the product with (p_x, p_y, p_z, 1)
+        */
+        LIBMATHS_FORCEINLINE VFloat Point(int p_column, VFloat p_x, VFloat p_y, VFloat p_z) const
+        {
+            return MulAdd(m[0][p_column], p_x, MulAdd(m[1][p_column], p_y, MulAdd(m[2][p_column], p_z, m[3][p_column])));
+        }
+
+        /**
+         * Return column p_column of the product with (p_x, p_y, p_z, 0)
+        */
+        LIBMATHS_FORCEINLINE VFloat Direction(int p_column, VFloat p_x, VFloat p_y, VFloat p_z) const
+        {
+            return MulAdd(m[0][p_column], p_x, MulAdd(m[1][p_column], p_y, m[2][p_column] * p_z));
+        }
+    };
+
+    /**
+     * Scalar product of p_matrix with (p_x, p_y, p_z, p_w)
+    */
+    LIBMATHS_FORCEINLINE void TransformScalar(const float* p_matrix, float p_x, float p_y, float p_z, float p_w, float p_result[4])
+    {
+        for (int column = 0; column < 4; column++)
+            p_result[column] = p_matrix[column] * p_x + p_matrix[4 + column] * p_y + p_matrix[8 + column] * p_z + p_matrix[12 + column] * p_w;
+    }
+
+    /**
+     * Transform p_count points, dividing by w when Divide is set
+    */
+    template<bool Divide>
+    LIBMATHS_FORCEINLINE void TransformPoints3(const FMat4& p_matrix, const FVec3* p_points, FVec3* p_result, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        if constexpr (width > 1)
+        {
+            const VMat4 matrix(p_matrix);
+
+            for (; i + width <= p_count; i += width)
+            {
+                VFloat in[3];
+                VFloat out[3];
+                LoadTransposed3(&p_points[i].x, in);
+
+                for (int column = 0; column < 3; column++)
+                    out[column] = matrix.Point(column, in[0], in[1], in[2]);
+
+                if constexpr (Divide)
+                {
+                    const VFloat w = matrix.Point(3, in[0], in[1], in[2]);
+
+                    for (int column = 0; column < 3; column++)
+                        out[column] = out[column] / w;
+                }
+
+                StoreTransposed3(&p_result[i].x, out);
+            }
+        }
+
+        const float* matrix = &p_matrix.m_matrix[0].x;
+
+        for (; i < p_count; i++)
+        {
+            float out[4];
+            TransformScalar(matrix, p_points[i].x, p_points[i].y, p_points[i].z, 1.0f, out);
+
+            if constexpr (Divide)
+            {
+                out[0] /= out[3];
+                out[1] /= out[3];
+                out[2] /= out[3];
+            }
+
+            p_result[i].x = out[0];
+            p_result[i].y = out[1];
+            p_result[i].z = out[2];
+        }
+    }
+
+    /**
+     * Transform p_count points by an affine matrix, w is taken as 1
+    */
+    inline void Mat4TransformPoints(const FMat4& p_matrix, const FVec3* p_points, FVec3* p_result, size_t p_count)
+    {
+        TransformPoints3<false>(p_matrix, p_points, p_result, p_count);
+    }
+
+    /**
+     * Transform p_count points and divide them by the resulting w
+    */
+    inline void Mat4TransformPointsDivide(const FMat4& p_matrix, const FVec3* p_points, FVec3* p_result, size_t p_count)
+    {
+        TransformPoints3<true>(p_matrix, p_points, p_result, p_count);
+    }
+
+    /**
+     * Transform p_count directions, the translation row is ignored
+    */
+    inline void Mat4TransformDirections(const FMat4& p_matrix, const FVec3* p_directions, FVec3* p_result, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        if constexpr (width > 1)
+        {
+            const VMat4 matrix(p_matrix);
+
+            for (; i + width <= p_count; i += width)
+            {
+                VFloat in[3];
+                VFloat out[3];
+                LoadTransposed3(&p_directions[i].x, in);
+
+                for (int column = 0; column < 3; column++)
+                    out[column] = matrix.Direction(column, in[0], in[1], in[2]);
+
+                StoreTransposed3(&p_result[i].x, out);
+            }
+        }
+
+        const float* matrix = &p_matrix.m_matrix[0].x;
+
+        for (; i < p_count; i++)
+        {
+            float out[4];
+            TransformScalar(matrix, p_directions[i].x, p_directions[i].y, p_directions[i].z, 0.0f, out);
+
+            p_result[i].x = out[0];
+            p_result[i].y = out[1];
+            p_result[i].z = out[2];
+        }
+    }
+
+    /**
+     * Transform p_count points into homogeneous coordinates, w is kept undivided
+    */
+    inline void Mat4TransformPointsHomogeneous(const FMat4& p_matrix, const FVec3* p_points, FVec4* p_result, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        if constexpr (width > 1)
+        {
+            const VMat4 matrix(p_matrix);
+
+            for (; i + width <= p_count; i += width)
+            {
+                VFloat in[3];
+                VFloat out[4];
+                LoadTransposed3(&p_points[i].x, in);
+
+                for (int column = 0; column < 4; column++)
+                    out[column] = matrix.Point(column, in[0], in[1], in[2]);
+
+                StoreTransposed4(&p_result[i].x, 4, out);
+            }
+        }
+
+        const float* matrix = &p_matrix.m_matrix[0].x;
+
+        for (; i < p_count; i++)
+        {
+            float out[4];
+            TransformScalar(matrix, p_points[i].x, p_points[i].y, p_points[i].z, 1.0f, out);
+
+            p_result[i].x = out[0];
+            p_result[i].y = out[1];
+            p_result[i].z = out[2];
+            p_result[i].w = out[3];
+        }
+    }
+
+    /**
+     * Transform p_count homogeneous vectors, w takes part in the product
+    */
+    inline void Mat4TransformVectors(const FMat4& p_matrix, const FVec4* p_vectors, FVec4* p_result, size_t p_count)
+    {
+        constexpr size_t width = VFloat::Width;
+        size_t i = 0;
+
+        if constexpr (width > 1)
+        {
+            const VMat4 matrix(p_matrix);
+
+            for (; i + width <= p_count; i += width)
+            {
+                VFloat in[4];
+                VFloat out[4];
+                LoadTransposed4(&p_vectors[i].x, 4, in);
+
+                for (int column = 0; column < 4; column++)
+                    out[column] = MulAdd(matrix.m[3][column], in[3], matrix.Direction(column, in[0], in[1], in[2]));
+
+                StoreTransposed4(&p_result[i].x, 4, out);
+            }
+        }
+
+        const float* matrix = &p_matrix.m_matrix[0].x;
+
+        for (; i < p_count; i++)
+        {
+            float out[4];
+            TransformScalar(matrix, p_vectors[i].x, p_vectors[i].y, p_vectors[i].z, p_vectors[i].w, out);
+
+            p_result[i].x = out[0];
+            p_result[i].y = out[1];
+            p_result[i].z = out[2];
+            p_result[i].w = out[3];
+        }
+    }
+}
@@ -0,0 +1,571 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "SIMD.h"
+
+/**
+ * Register-wide float used by the structure of arrays kernels.
+ *
+ * A VFloat holds VFloat::Width lanes: 16 with AVX-512, 8 with AVX, 4 with
+ * SSE and a single float otherwise, so a kernel written against it runs
+ * unchanged at every instruction set level.
+*/
+namespace lm::simd::inline LIBMATHS_ISA_NAMESPACE
+{
+#if LIBMATHS_USE_AVX512
+    using VRegister = __m512;
+    using VMaskRegister = __mmask16;
+    inline constexpr size_t VWidth = 16;
+#elif LIBMATHS_USE_AVX
+    using VRegister = __m256;
+    using VMaskRegister = __m256;
+    inline constexpr size_t VWidth = 8;
+#elif LIBMATHS_USE_SSE
+    using VRegister = __m128;
+    using VMaskRegister = __m128;
+    inline constexpr size_t VWidth = 4;
+#else
+    using VRegister = float;
+    using VMaskRegister = bool;
+    inline constexpr size_t VWidth = 1;
+#endif
+
+    /**
+     * Lane-wise comparison result
+    */
+    struct VMask
+    {
+        VMaskRegister m_value;
+
+        VMask() = default;
+
+        explicit LIBMATHS_FORCEINLINE VMask(VMaskRegister p_value) : m_value(p_value) {}
+    };
+
+    struct VFloat
+    {
+        static constexpr size_t Width = VWidth;
+
+        VRegister m_value;
+
+        VFloat() = default;
+
+        explicit LIBMATHS_FORCEINLINE VFloat(VRegister p_value) : m_value(p_value) {}
+
+        /**
+         * Return a register with every lane set to p_value
+         * @param p_value
+        */
+        static LIBMATHS_FORCEINLINE VFloat Splat(float p_value)
+        {
+#if LIBMATHS_USE_AVX512
+            return VFloat(_mm512_set1_ps(p_value));
+#elif LIBMATHS_USE_AVX
+            return VFloat(_mm256_set1_ps(p_value));
+#elif LIBMATHS_USE_SSE
+            return VFloat(_mm_set1_ps(p_value));
+#else
+            return VFloat(p_value);
+#endif
+        }
+
+        /**
+         * Load Width contiguous floats
+         * @param p_source
+        */
+        static LIBMATHS_FORCEINLINE VFloat Load(const float* p_source)
+        {
+#if LIBMATHS_USE_AVX512
+            return VFloat(_mm512_loadu_ps(p_source));
+#elif LIBMATHS_USE_AVX
+            return VFloat(_mm256_loadu_ps(p_source));
+#elif LIBMATHS_USE_SSE
+            return VFloat(_mm_loadu_ps(p_source));
+#else
+            return VFloat(*p_source);
+#endif
+        }
+
+        /**
+         * Store the Width lanes contiguously
+         * @param p_destination
+        */
+        LIBMATHS_FORCEINLINE void Store(float* p_destination) const
+        {
+#if LIBMATHS_USE_AVX512
+            _mm512_storeu_ps(p_destination, m_value);
+#elif LIBMATHS_USE_AVX
+            _mm256_storeu_ps(p_destination, m_value);
+#elif LIBMATHS_USE_SSE
+            _mm_storeu_ps(p_destination, m_value);
+#else
+            *p_destination = m_value;
+#endif
+        }
+    };
+
+    LIBMATHS_FORCEINLINE VFloat operator+(VFloat p_left, VFloat p_right)
+    {
+#if LIBMATHS_USE_AVX512
+        return VFloat(_mm512_add_ps(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_AVX
+        return VFloat(_mm256_add_ps(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_SSE
+        return VFloat(_mm_add_ps(p_left.m_value, p_right.m_value));
+#else
+        return VFloat(p_left.m_value + p_right.m_value);
+#endif
+    }
+
+    LIBMATHS_FORCEINLINE VFloat operator-(VFloat p_left, VFloat p_right)
+    {
+#if LIBMATHS_USE_AVX512
+        return VFloat(_mm512_sub_ps(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_AVX
+        return VFloat(_mm256_sub_ps(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_SSE
+        return VFloat(_mm_sub_ps(p_left.m_value, p_right.m_value));
+#else
+        return VFloat(p_left.m_value - p_right.m_value);
+#endif
+    }
+
+    LIBMATHS_FORCEINLINE VFloat operator*(VFloat p_left, VFloat p_right)
+    {
+#if LIBMATHS_USE_AVX512
+        return VFloat(_mm512_mul_ps(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_AVX
+        return VFloat(_mm256_mul_ps(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_SSE
+        return VFloat(_mm_mul_ps(p_left.m_value, p_right.m_value));
+#else
+        return VFloat(p_left.m_value * p_right.m_value);
+#endif
+    }
+
+    LIBMATHS_FORCEINLINE VFloat operator/(VFloat p_left, VFloat p_right)
+    {
+#if LIBMATHS_USE_AVX512
+        return VFloat(_mm512_div_ps(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_AVX
+        return VFloat(_mm256_div_ps(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_SSE
+        return VFloat(_mm_div_ps(p_left.m_value, p_right.m_value));
+#else
+        return VFloat(p_left.m_value / p_right.m_value);
+#endif
+    }
+
+    LIBMATHS_FORCEINLINE VFloat operator-(VFloat p_value)
+    {
+        return VFloat::Splat(0.0f) - p_value;
+    }
+
+    LIBMATHS_FORCEINLINE VFloat operator*(VFloat p_left, float p_right)
+    {
+        return p_left * VFloat::Splat(p_right);
+    }
+
+    LIBMATHS_FORCEINLINE VFloat operator+(VFloat p_left, float p_right)
+    {
+        return p_left + VFloat::Splat(p_right);
+    }
+
+    LIBMATHS_FORCEINLINE VFloat operator-(VFloat p_left, float p_right)
+    {
+        return p_left - VFloat::Splat(p_right);
+    }
+
+    /**
+     * Return p_a * p_b + p_c, fused when the target supports it
+    */
+    LIBMATHS_FORCEINLINE VFloat MulAdd(VFloat p_a, VFloat p_b, VFloat p_c)
+    {
+#if LIBMATHS_USE_AVX512
+        return VFloat(_mm512_fmadd_ps(p_a.m_value, p_b.m_value, p_c.m_value));
+#elif LIBMATHS_USE_AVX && LIBMATHS_USE_FMA
+        return VFloat(_mm256_fmadd_ps(p_a.m_value, p_b.m_value, p_c.m_value));
+#elif LIBMATHS_USE_SSE && LIBMATHS_USE_FMA
+        return VFloat(_mm_fmadd_ps(p_a.m_value, p_b.m_value, p_c.m_value));
+#else
+        return p_a * p_b + p_c;
+#endif
+    }
+
+    /**
+     * Return p_c - p_a * p_b, fused when the target supports it
+    */
+    LIBMATHS_FORCEINLINE VFloat NegMulAdd(VFloat p_a, VFloat p_b, VFloat p_c)
+    {
+#if LIBMATHS_USE_AVX512
+        return VFloat(_mm512_fnmadd_ps(p_a.m_value, p_b.m_value, p_c.m_value));
+#elif LIBMATHS_USE_AVX && LIBMATHS_USE_FMA
+        return VFloat(_mm256_fnmadd_ps(p_a.m_value, p_b.m_value, p_c.m_value));
+#elif LIBMATHS_USE_SSE && LIBMATHS_USE_FMA
+        return VFloat(_mm_fnmadd_ps(p_a.m_value, p_b.m_value, p_c.m_value));
+#else
+        return p_c - p_a * p_b;
+#endif
+    }
+
+    LIBMATHS_FORCEINLINE VFloat Sqrt(VFloat p_value)
+    {
+#if LIBMATHS_USE_AVX512
+        return VFloat(_mm512_sqrt_ps(p_value.m_value));
+#elif LIBMATHS_USE_AVX
+        return VFloat(_mm256_sqrt_ps(p_value.m_value));
+#elif LIBMATHS_USE_SSE
+        return VFloat(_mm_sqrt_ps(p_value.m_value));
+#else
+        return VFloat(std::sqrt(p_value.m_value));
+#endif
+    }
+
+    LIBMATHS_FORCEINLINE VFloat Min(VFloat p_left, VFloat p_right)
+    {
+#if LIBMATHS_USE_AVX512
+        return VFloat(_mm512_min_ps(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_AVX
+        return VFloat(_mm256_min_ps(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_SSE
+        return VFloat(_mm_min_ps(p_left.m_value, p_right.m_value));
+#else
+        return VFloat(p_left.m_value < p_right.m_value ? p_left.m_value : p_right.m_value);
+#endif
+    }
+
+    LIBMATHS_FORCEINLINE VFloat Max(VFloat p_left, VFloat p_right)
+    {
+#if LIBMATHS_USE_AVX512
+        return VFloat(_mm512_max_ps(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_AVX
+        return VFloat(_mm256_max_ps(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_SSE
+        return VFloat(_mm_max_ps(p_left.m_value, p_right.m_value));
+#else
+        return VFloat(p_left.m_value > p_right.m_value ? p_left.m_value : p_right.m_value);
+#endif
+    }
+
+    LIBMATHS_FORCEINLINE VMask operator<(VFloat p_left, VFloat p_right)
+    {
+#if LIBMATHS_USE_AVX512
+        return VMask(_mm512_cmp_ps_mask(p_left.m_value, p_right.m_value, _CMP_LT_OQ));
+#elif LIBMATHS_USE_AVX
+        return VMask(_mm256_cmp_ps(p_left.m_value, p_right.m_value, _CMP_LT_OQ));
+#elif LIBMATHS_USE_SSE
+        return VMask(_mm_cmplt_ps(p_left.m_value, p_right.m_value));
+#else
+        return VMask(p_left.m_value < p_right.m_value);
+#endif
+    }
+
+    LIBMATHS_FORCEINLINE VMask operator>(VFloat p_left, VFloat p_right)
+    {
+        return p_right < p_left;
+    }
+
+    LIBMATHS_FORCEINLINE VMask operator&(VMask p_left, VMask p_right)
+    {
+#if LIBMATHS_USE_AVX512
+        return VMask(static_cast<__mmask16>(p_left.m_value & p_right.m_value));
+#elif LIBMATHS_USE_AVX
+        return VMask(_mm256_and_ps(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_SSE
+        return VMask(_mm_and_ps(p_left.m_value, p_right.m_value));
+#else
+        return VMask(p_left.m_value && p_right.m_value);
+#endif
+    }
+
+    LIBMATHS_FORCEINLINE VMask operator|(VMask p_left, VMask p_right)
+    {
+#if LIBMATHS_USE_AVX512
+        return VMask(static_cast<__mmask16>(p_left.m_value | p_right.m_value));
+#elif LIBMATHS_USE_AVX
+        return VMask(_mm256_or_ps(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_SSE
+        return VMask(_mm_or_ps(p_left.m_value, p_right.m_value));
+#else
+        return VMask(p_left.m_value || p_right.m_value);
+#endif
+    }
+
+    /**
+     * Return p_ifTrue in the lanes where p_mask is set and p_ifFalse elsewhere
+    */
+    LIBMATHS_FORCEINLINE VFloat Select(VMask p_mask, VFloat p_ifTrue, VFloat p_ifFalse)
+    {
+#if LIBMATHS_USE_AVX512
+        return VFloat(_mm512_mask_blend_ps(p_mask.m_value, p_ifFalse.m_value, p_ifTrue.m_value));
+#elif LIBMATHS_USE_AVX
+        return VFloat(_mm256_blendv_ps(p_ifFalse.m_value, p_ifTrue.m_value, p_mask.m_value));
+#elif LIBMATHS_USE_SSE41
+        return VFloat(_mm_blendv_ps(p_ifFalse.m_value, p_ifTrue.m_value, p_mask.m_value));
+#elif LIBMATHS_USE_SSE
+        return VFloat(_mm_or_ps(_mm_and_ps(p_mask.m_value, p_ifTrue.m_value), _mm_andnot_ps(p_mask.m_value, p_ifFalse.m_value)));
+#else
+        return p_mask.m_value ? p_ifTrue : p_ifFalse;
+#endif
+    }
+
+    LIBMATHS_FORCEINLINE VFloat Abs(VFloat p_value)
+    {
+        return Max(p_value, -p_value);
+    }
+
+#if LIBMATHS_USE_AVX512
+    /**
+     * Transpose the 4x4 floats held in every 128 bits lane of four registers
+    */
+    LIBMATHS_FORCEINLINE void Transpose4InLanes(__m512& p_r0, __m512& p_r1, __m512& p_r2, __m512& p_r3)
+    {
+        const __m512 t0 = _mm512_unpacklo_ps(p_r0, p_r1);
+        const __m512 t1 = _mm512_unpackhi_ps(p_r0, p_r1);
+        const __m512 t2 = _mm512_unpacklo_ps(p_r2, p_r3);
+        const __m512 t3 = _mm512_unpackhi_ps(p_r2, p_r3);
+
+        p_r0 = _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        p_r1 = _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        p_r2 = _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        p_r3 = _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+#elif LIBMATHS_USE_AVX
+    /**
+     * Transpose the 4x4 floats held in every 128 bits lane of four registers
+    */
+    LIBMATHS_FORCEINLINE void Transpose4InLanes(__m256& p_r0, __m256& p_r1, __m256& p_r2, __m256& p_r3)
+    {
+        const __m256 t0 = _mm256_unpacklo_ps(p_r0, p_r1);
+        const __m256 t1 = _mm256_unpackhi_ps(p_r0, p_r1);
+        const __m256 t2 = _mm256_unpacklo_ps(p_r2, p_r3);
+        const __m256 t3 = _mm256_unpackhi_ps(p_r2, p_r3);
+
+        p_r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        p_r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        p_r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        p_r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+#endif
+
+    /**
+     * Gather 4 consecutive floats from Width records into 4 registers
+     * @param p_source Address of the first float of the first record
+     * @param p_stride Distance between two records in floats
+     * @param p_result Lane i of p_result[j] receives p_source[i * p_stride + j]
+    */
+    LIBMATHS_FORCEINLINE void LoadTransposed4(const float* p_source, size_t p_stride, VFloat p_result[4])
+    {
+#if LIBMATHS_USE_AVX512
+        __m512 rows[4];
+        for (size_t k = 0; k < 4; k++)
+        {
+            __m512 row = _mm512_castps128_ps512(_mm_loadu_ps(p_source + k * p_stride));
+            row = _mm512_insertf32x4(row, _mm_loadu_ps(p_source + (k + 4) * p_stride), 1);
+            row = _mm512_insertf32x4(row, _mm_loadu_ps(p_source + (k + 8) * p_stride), 2);
+            rows[k] = _mm512_insertf32x4(row, _mm_loadu_ps(p_source + (k + 12) * p_stride), 3);
+        }
+        Transpose4InLanes(rows[0], rows[1], rows[2], rows[3]);
+        for (size_t j = 0; j < 4; j++)
+            p_result[j] = VFloat(rows[j]);
+#elif LIBMATHS_USE_AVX
+        __m256 rows[4];
+        for (size_t k = 0; k < 4; k++)
+        {
+            rows[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p_source + k * p_stride)),
+                _mm_loadu_ps(p_source + (k + 4) * p_stride), 1);
+        }
+        Transpose4InLanes(rows[0], rows[1], rows[2], rows[3]);
+        for (size_t j = 0; j < 4; j++)
+            p_result[j] = VFloat(rows[j]);
+#elif LIBMATHS_USE_SSE
+        __m128 rows[4];
+        for (size_t k = 0; k < 4; k++)
+            rows[k] = _mm_loadu_ps(p_source + k * p_stride);
+        _MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+        for (size_t j = 0; j < 4; j++)
+            p_result[j] = VFloat(rows[j]);
+#else
+        (void)p_stride;
+        for (size_t j = 0; j < 4; j++)
+            p_result[j] = VFloat(p_source[j]);
+#endif
+    }
+
+    /**
+     * Gather 4 consecutive floats from Width records picked by index into 4 registers
+     * @param p_source Address of the first float of record 0
+     * @param p_stride Distance between two records in floats
+     * @param p_indices Width record indices
+     * @param p_result Lane i of p_result[j] receives p_source[p_indices[i] * p_stride + j]
+    */
+    LIBMATHS_FORCEINLINE void GatherTransposed4(const float* p_source, size_t p_stride, const uint32_t* p_indices, VFloat p_result[4])
+    {
+#if LIBMATHS_USE_AVX512
+        __m512 rows[4];
+        for (size_t k = 0; k < 4; k++)
+        {
+            __m512 row = _mm512_castps128_ps512(_mm_loadu_ps(p_source + p_indices[k] * p_stride));
+            row = _mm512_insertf32x4(row, _mm_loadu_ps(p_source + p_indices[k + 4] * p_stride), 1);
+            row = _mm512_insertf32x4(row, _mm_loadu_ps(p_source + p_indices[k + 8] * p_stride), 2);
+            rows[k] = _mm512_insertf32x4(row, _mm_loadu_ps(p_source + p_indices[k + 12] * p_stride), 3);
+        }
+        Transpose4InLanes(rows[0], rows[1], rows[2], rows[3]);
+        for (size_t j = 0; j < 4; j++)
+            p_result[j] = VFloat(rows[j]);
+#elif LIBMATHS_USE_AVX
+        __m256 rows[4];
+        for (size_t k = 0; k < 4; k++)
+        {
+            rows[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p_source + p_indices[k] * p_stride)),
+                _mm_loadu_ps(p_source + p_indices[k + 4] * p_stride), 1);
+        }
+        Transpose4InLanes(rows[0], rows[1], rows[2], rows[3]);
+        for (size_t j = 0; j < 4; j++)
+            p_result[j] = VFloat(rows[j]);
+#elif LIBMATHS_USE_SSE
+        __m128 rows[4];
+        for (size_t k = 0; k < 4; k++)
+            rows[k] = _mm_loadu_ps(p_source + p_indices[k] * p_stride);
+        _MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+        for (size_t j = 0; j < 4; j++)
+            p_result[j] = VFloat(rows[j]);
+#else
+        for (size_t j = 0; j < 4; j++)
+            p_result[j] = VFloat(p_source[p_indices[0] * p_stride + j]);
+#endif
+    }
+
+    /**
+     * Scatter 4 registers back into Width records of 4 consecutive floats
+     * @param p_destination Address of the first float of the first record
+     * @param p_stride Distance between two records in floats
+     * @param p_values Lane i of p_values[j] is written to p_destination[i * p_stride + j]
+    */
+    LIBMATHS_FORCEINLINE void StoreTransposed4(float* p_destination, size_t p_stride, const VFloat p_values[4])
+    {
+#if LIBMATHS_USE_AVX512
+        __m512 rows[4] = { p_values[0].m_value, p_values[1].m_value, p_values[2].m_value, p_values[3].m_value };
+        Transpose4InLanes(rows[0], rows[1], rows[2], rows[3]);
+        for (size_t k = 0; k < 4; k++)
+        {
+            _mm_storeu_ps(p_destination + k * p_stride, _mm512_castps512_ps128(rows[k]));
+            _mm_storeu_ps(p_destination + (k + 4) * p_stride, _mm512_extractf32x4_ps(rows[k], 1));
+            _mm_storeu_ps(p_destination + (k + 8) * p_stride, _mm512_extractf32x4_ps(rows[k], 2));
+            _mm_storeu_ps(p_destination + (k + 12) * p_stride, _mm512_extractf32x4_ps(rows[k], 3));
+        }
+#elif LIBMATHS_USE_AVX
+        __m256 rows[4] = { p_values[0].m_value, p_values[1].m_value, p_values[2].m_value, p_values[3].m_value };
+        Transpose4InLanes(rows[0], rows[1], rows[2], rows[3]);
+        for (size_t k = 0; k < 4; k++)
+        {
+            _mm_storeu_ps(p_destination + k * p_stride, _mm256_castps256_ps128(rows[k]));
+            _mm_storeu_ps(p_destination + (k + 4) * p_stride, _mm256_extractf128_ps(rows[k], 1));
+        }
+#elif LIBMATHS_USE_SSE
+        __m128 rows[4] = { p_values[0].m_value, p_values[1].m_value, p_values[2].m_value, p_values[3].m_value };
+        _MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+        for (size_t k = 0; k < 4; k++)
+            _mm_storeu_ps(p_destination + k * p_stride, rows[k]);
+#else
+        (void)p_stride;
+        for (size_t j = 0; j < 4; j++)
+            p_destination[j] = p_values[j].m_value;
+#endif
+    }
+
+#if LIBMATHS_USE_SSE
+    /**
+     * Split 4 packed xyz records (12 floats) into x, y and z registers
+    */
+    LIBMATHS_FORCEINLINE void Deinterleave3(const float* p_source, __m128& p_x, __m128& p_y, __m128& p_z)
+    {
+        const __m128 a = _mm_loadu_ps(p_source);
+        const __m128 b = _mm_loadu_ps(p_source + 4);
+        const __m128 c = _mm_loadu_ps(p_source + 8);
+
+        p_x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        p_y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        p_z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    /**
+     * Pack x, y and z registers into 4 xyz records (12 floats)
+    */
+    LIBMATHS_FORCEINLINE void Interleave3(float* p_destination, __m128 p_x, __m128 p_y, __m128 p_z)
+    {
+        const __m128 a = _mm_shuffle_ps(_mm_unpacklo_ps(p_x, p_y), _mm_shuffle_ps(p_z, p_x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+        const __m128 b = _mm_shuffle_ps(_mm_shuffle_ps(p_y, p_z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(p_x, p_y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 c = _mm_shuffle_ps(_mm_shuffle_ps(p_z, p_x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(p_y, p_z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+
+        _mm_storeu_ps(p_destination, a);
+        _mm_storeu_ps(p_destination + 4, b);
+        _mm_storeu_ps(p_destination + 8, c);
+    }
+#endif
+
+    /**
+     * Split Width packed xyz records into 3 registers
+     * @param p_source Address of the first record
+     * @param p_result Lane i of p_result[j] receives p_source[i * 3 + j]
+    */
+    LIBMATHS_FORCEINLINE void LoadTransposed3(const float* p_source, VFloat p_result[3])
+    {
+#if LIBMATHS_USE_AVX512
+        __m128 x[4], y[4], z[4];
+        for (int g = 0; g < 4; g++)
+            Deinterleave3(p_source + g * 12, x[g], y[g], z[g]);
+
+        const auto combine = [](const __m128 p_parts[4])
+        {
+            __m512 result = _mm512_castps128_ps512(p_parts[0]);
+            result = _mm512_insertf32x4(result, p_parts[1], 1);
+            result = _mm512_insertf32x4(result, p_parts[2], 2);
+            return _mm512_insertf32x4(result, p_parts[3], 3);
+        };
+
+        p_result[0] = VFloat(combine(x));
+        p_result[1] = VFloat(combine(y));
+        p_result[2] = VFloat(combine(z));
+#elif LIBMATHS_USE_AVX
+        __m128 x[2], y[2], z[2];
+        Deinterleave3(p_source, x[0], y[0], z[0]);
+        Deinterleave3(p_source + 12, x[1], y[1], z[1]);
+
+        p_result[0] = VFloat(_mm256_insertf128_ps(_mm256_castps128_ps256(x[0]), x[1], 1));
+        p_result[1] = VFloat(_mm256_insertf128_ps(_mm256_castps128_ps256(y[0]), y[1], 1));
+        p_result[2] = VFloat(_mm256_insertf128_ps(_mm256_castps128_ps256(z[0]), z[1], 1));
+#elif LIBMATHS_USE_SSE
+        Deinterleave3(p_source, p_result[0].m_value, p_result[1].m_value, p_result[2].m_value);
+#else
+        for (int j = 0; j < 3; j++)
+            p_result[j] = VFloat(p_source[j]);
+#endif
+    }
+
+    /**
+     * Pack 3 registers into Width xyz records
+     * @param p_destination Address of the first record
+     * @param p_values Lane i of p_values[j] is written to p_destination[i * 3 + j]
+    */
+    LIBMATHS_FORCEINLINE void StoreTransposed3(float* p_destination, const VFloat p_values[3])
+    {
+#if LIBMATHS_USE_AVX512
+        Interleave3(p_destination, _mm512_castps512_ps128(p_values[0].m_value), _mm512_castps512_ps128(p_values[1].m_value), _mm512_castps512_ps128(p_values[2].m_value));
+        Interleave3(p_destination + 12, _mm512_extractf32x4_ps(p_values[0].m_value, 1), _mm512_extractf32x4_ps(p_values[1].m_value, 1), _mm512_extractf32x4_ps(p_values[2].m_value, 1));
+        Interleave3(p_destination + 24, _mm512_extractf32x4_ps(p_values[0].m_value, 2), _mm512_extractf32x4_ps(p_values[1].m_value, 2), _mm512_extractf32x4_ps(p_values[2].m_value, 2));
+        Interleave3(p_destination + 36, _mm512_extractf32x4_ps(p_values[0].m_value, 3), _mm512_extractf32x4_ps(p_values[1].m_value, 3), _mm512_extractf32x4_ps(p_values[2].m_value, 3));
+#elif LIBMATHS_USE_AVX
+        Interleave3(p_destination, _mm256_castps256_ps128(p_values[0].m_value), _mm256_castps256_ps128(p_values[1].m_value), _mm256_castps256_ps128(p_values[2].m_value));
+        Interleave3(p_destination + 12, _mm256_extractf128_ps(p_values[0].m_value, 1), _mm256_extractf128_ps(p_values[1].m_value, 1), _mm256_extractf128_ps(p_values[2].m_value, 1));
+#elif LIBMATHS_USE_SSE
+        Interleave3(p_destination, p_values[0].m_value, p_values[1].m_value, p_values[2].m_value);
+#else
+        for (int j = 0; j < 3; j++)
+            p_destination[j] = p_values[j].m_value;
+#endif
+    }
+}
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "SIMD.h"
+#include "VFloat.h"
+
+/**
+ * Register-wide 32 bits integer, with as many lanes as VFloat.
+ *
+ * Only what the bit packing kernels need: conversions from and to VFloat,
+ * bitwise and, or and logical shifts. AVX without AVX2 has no 256 bits
+ * integer instructions, the two 128 bits halves are then processed apart.
+*/
+namespace lm::simd::inline LIBMATHS_ISA_NAMESPACE
+{
+#if LIBMATHS_USE_AVX512
+    using VIntRegister = __m512i;
+#elif LIBMATHS_USE_AVX
+    using VIntRegister = __m256i;
+#elif LIBMATHS_USE_SSE
+    using VIntRegister = __m128i;
+#else
+    using VIntRegister = uint32_t;
+#endif
+
+#if LIBMATHS_USE_AVX && !LIBMATHS_USE_AVX2 && !LIBMATHS_USE_AVX512
+    /**
+     * Apply a __m128i operation to both halves of __m256i registers
+    */
+    template<typename Operation, typename... Registers>
+    LIBMATHS_FORCEINLINE __m256i ByHalves(Operation p_operation, Registers... p_registers)
+    {
+        const __m128i low = p_operation(_mm256_castsi256_si128(p_registers)...);
+        const __m128i high = p_operation(_mm256_extractf128_si256(p_registers, 1)...);
+        return _mm256_insertf128_si256(_mm256_castsi128_si256(low), high, 1);
+    }
+#endif
+
+    struct VInt
+    {
+        static constexpr size_t Width = VWidth;
+
+        VIntRegister m_value;
+
+        VInt() = default;
+
+        explicit LIBMATHS_FORCEINLINE VInt(VIntRegister p_value) : m_value(p_value) {}
+
+        static LIBMATHS_FORCEINLINE VInt Splat(uint32_t p_value)
+        {
+#if LIBMATHS_USE_AVX512
+            return VInt(_mm512_set1_epi32(static_cast<int>(p_value)));
+#elif LIBMATHS_USE_AVX
+            return VInt(_mm256_set1_epi32(static_cast<int>(p_value)));
+#elif LIBMATHS_USE_SSE
+            return VInt(_mm_set1_epi32(static_cast<int>(p_value)));
+#else
+            return VInt(p_value);
+#endif
+        }
+
+        /**
+         * Load Width contiguous integers
+         * @param p_source
+        */
+        static LIBMATHS_FORCEINLINE VInt Load(const uint32_t* p_source)
+        {
+#if LIBMATHS_USE_AVX512
+            return VInt(_mm512_loadu_si512(p_source));
+#elif LIBMATHS_USE_AVX
+            return VInt(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_source)));
+#elif LIBMATHS_USE_SSE
+            return VInt(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p_source)));
+#else
+            return VInt(*p_source);
+#endif
+        }
+
+        /**
+         * Store the Width lanes contiguously
+         * @param p_destination
+        */
+        LIBMATHS_FORCEINLINE void Store(uint32_t* p_destination) const
+        {
+#if LIBMATHS_USE_AVX512
+            _mm512_storeu_si512(p_destination, m_value);
+#elif LIBMATHS_USE_AVX
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(p_destination), m_value);
+#elif LIBMATHS_USE_SSE
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p_destination), m_value);
+#else
+            *p_destination = m_value;
+#endif
+        }
+    };
+
+    /**
+     * Return the lanes of p_value rounded to the nearest integer, ties to even
+    */
+    LIBMATHS_FORCEINLINE VInt RoundToInt(VFloat p_value)
+    {
+#if LIBMATHS_USE_AVX512
+        return VInt(_mm512_cvtps_epi32(p_value.m_value));
+#elif LIBMATHS_USE_AVX
+        return VInt(_mm256_cvtps_epi32(p_value.m_value));
+#elif LIBMATHS_USE_SSE
+        return VInt(_mm_cvtps_epi32(p_value.m_value));
+#else
+        return VInt(static_cast<uint32_t>(std::lrint(p_value.m_value)));
+#endif
+    }
+
+    /**
+     * Return the lanes of p_value, read as signed integers, converted to float
+    */
+    LIBMATHS_FORCEINLINE VFloat ToFloat(VInt p_value)
+    {
+#if LIBMATHS_USE_AVX512
+        return VFloat(_mm512_cvtepi32_ps(p_value.m_value));
+#elif LIBMATHS_USE_AVX
+        return VFloat(_mm256_cvtepi32_ps(p_value.m_value));
+#elif LIBMATHS_USE_SSE
+        return VFloat(_mm_cvtepi32_ps(p_value.m_value));
+#else
+        return VFloat(static_cast<float>(static_cast<int32_t>(p_value.m_value)));
+#endif
+    }
+
+    LIBMATHS_FORCEINLINE VInt operator&(VInt p_left, VInt p_right)
+    {
+#if LIBMATHS_USE_AVX512
+        return VInt(_mm512_and_si512(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_AVX
+        return VInt(_mm256_castps_si256(_mm256_and_ps(_mm256_castsi256_ps(p_left.m_value), _mm256_castsi256_ps(p_right.m_value))));
+#elif LIBMATHS_USE_SSE
+        return VInt(_mm_and_si128(p_left.m_value, p_right.m_value));
+#else
+        return VInt(p_left.m_value & p_right.m_value);
+#endif
+    }
+
+    LIBMATHS_FORCEINLINE VInt operator|(VInt p_left, VInt p_right)
+    {
+#if LIBMATHS_USE_AVX512
+        return VInt(_mm512_or_si512(p_left.m_value, p_right.m_value));
+#elif LIBMATHS_USE_AVX
+        return VInt(_mm256_castps_si256(_mm256_or_ps(_mm256_castsi256_ps(p_left.m_value), _mm256_castsi256_ps(p_right.m_value))));
+#elif LIBMATHS_USE_SSE
+        return VInt(_mm_or_si128(p_left.m_value, p_right.m_value));
+#else
+        return VInt(p_left.m_value | p_right.m_value);
+#endif
+    }
+
+    template<int Bits>
+    LIBMATHS_FORCEINLINE VInt ShiftLeft(VInt p_value)
+    {
+#if LIBMATHS_USE_AVX512
+        return VInt(_mm512_slli_epi32(p_value.m_value, Bits));
+#elif LIBMATHS_USE_AVX2
+        return VInt(_mm256_slli_epi32(p_value.m_value, Bits));
+#elif LIBMATHS_USE_AVX
+        return VInt(ByHalves([](__m128i p_half) { return _mm_slli_epi32(p_half, Bits); }, p_value.m_value));
+#elif LIBMATHS_USE_SSE
+        return VInt(_mm_slli_epi32(p_value.m_value, Bits));
+#else
+        return VInt(p_value.m_value << Bits);
+#endif
+    }
+
+    /**
+     * Shift the lanes right by Bits, filling with zeros
+    */
+    template<int Bits>
+    LIBMATHS_FORCEINLINE VInt ShiftRight(VInt p_value)
+    {
+#if LIBMATHS_USE_AVX512
+        return VInt(_mm512_srli_epi32(p_value.m_value, Bits));
+#elif LIBMATHS_USE_AVX2
+        return VInt(_mm256_srli_epi32(p_value.m_value, Bits));
+#elif LIBMATHS_USE_AVX
+        return VInt(ByHalves([](__m128i p_half) { return _mm_srli_epi32(p_half, Bits); }, p_value.m_value));
+#elif LIBMATHS_USE_SSE
+        return VInt(_mm_srli_epi32(p_value.m_value, Bits));
+#else
+        return VInt(p_value.m_value >> Bits);
+#endif
+    }
+}
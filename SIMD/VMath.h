@@ -0,0 +1,48 @@
+#pragma once
+
+#include "SIMD.h"
+#include "VFloat.h"
+
+/**
+ * Polynomial approximations of elementary functions on VFloat.
+ *
+ * Each one only covers the range the kernels need, so no range reduction is
+ * done and every lane runs the same instructions.
+*/
+namespace lm::simd::inline LIBMATHS_ISA_NAMESPACE
+{
+    /**
+     * Return the sine of p_value in [-pi / 2, pi / 2]
+     * @note Taylor series up to x^11, absolute error below 1e-7 on the range
+    */
+    LIBMATHS_FORCEINLINE VFloat Sin(VFloat p_value)
+    {
+        const VFloat x2 = p_value * p_value;
+
+        VFloat result = VFloat::Splat(-1.0f / 39916800.0f);
+        result = MulAdd(result, x2, VFloat::Splat(1.0f / 362880.0f));
+        result = MulAdd(result, x2, VFloat::Splat(-1.0f / 5040.0f));
+        result = MulAdd(result, x2, VFloat::Splat(1.0f / 120.0f));
+        result = MulAdd(result, x2, VFloat::Splat(-1.0f / 6.0f));
+
+        return MulAdd(result * x2, p_value, p_value);
+    }
+
+    /**
+     * Return the arc cosine of p_value in [0, 1]
+     * @note sqrt(1 - x) times a degree 7 polynomial (Abramowitz and Stegun 4.4.45), absolute error below 2e-7
+    */
+    LIBMATHS_FORCEINLINE VFloat ACos(VFloat p_value)
+    {
+        VFloat result = VFloat::Splat(-0.0012624911f);
+        result = MulAdd(result, p_value, VFloat::Splat(0.0066700901f));
+        result = MulAdd(result, p_value, VFloat::Splat(-0.0170881256f));
+        result = MulAdd(result, p_value, VFloat::Splat(0.0308918810f));
+        result = MulAdd(result, p_value, VFloat::Splat(-0.0501743046f));
+        result = MulAdd(result, p_value, VFloat::Splat(0.0889789874f));
+        result = MulAdd(result, p_value, VFloat::Splat(-0.2145988016f));
+        result = MulAdd(result, p_value, VFloat::Splat(1.5707963050f));
+
+        return Sqrt(VFloat::Splat(1.0f) - p_value) * result;
+    }
+}
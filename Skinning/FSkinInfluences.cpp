@@ -0,0 +1,113 @@
+#include "FSkinInfluences.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+using namespace lm;
+
+lm::FSkinInfluences::FSkinInfluences() : m_weights(MaxInfluences)
+{
+}
+
+lm::FSkinInfluences::FSkinInfluences(size_t p_size) : m_weights(MaxInfluences)
+{
+    Resize(p_size);
+}
+
+size_t lm::FSkinInfluences::Size() const
+{
+    return m_weights.Size();
+}
+
+void lm::FSkinInfluences::Resize(size_t p_size)
+{
+    const size_t oldSize = Size();
+    const size_t oldPadded = m_weights.PaddedSize();
+
+    m_weights.Resize(p_size);
+
+    // The bone arrays follow the padded size of the weights, the kept indices move to their new offsets
+    const size_t padded = m_weights.PaddedSize();
+
+    if (padded == oldPadded)
+    {
+        for (int influence = 0; influence < MaxInfluences; influence++)
+        {
+            uint32_t* bones = m_bones.data() + influence * padded;
+            std::fill(bones + std::min(oldSize, p_size), bones + padded, 0u);
+        }
+
+        return;
+    }
+
+    std::vector<uint32_t> bones(MaxInfluences * padded, 0u);
+    const size_t kept = std::min(oldSize, p_size);
+
+    for (int influence = 0; influence < MaxInfluences; influence++)
+    {
+        std::copy_n(m_bones.data() + influence * oldPadded, kept, bones.data() + influence * padded);
+    }
+
+    m_bones = std::move(bones);
+}
+
+void lm::FSkinInfluences::Set(size_t p_vertex, std::span<const uint32_t> p_bones, std::span<const float> p_weights)
+{
+    CheckVertex(p_vertex, 0, "FSkinInfluences::Set");
+
+    if (p_bones.size() != p_weights.size() || p_bones.size() > MaxInfluences)
+    {
+        throw std::logic_error("FSkinInfluences::Set: bones and weights must have the same size, at most MaxInfluences");
+    }
+
+    for (int influence = 0; influence < MaxInfluences; influence++)
+    {
+        const bool used = static_cast<size_t>(influence) < p_bones.size();
+        Bones(influence)[p_vertex] = used ? p_bones[influence] : 0u;
+        Weights(influence)[p_vertex] = used ? p_weights[influence] : 0.0f;
+    }
+}
+
+uint32_t lm::FSkinInfluences::GetBone(size_t p_vertex, int p_influence) const
+{
+    CheckVertex(p_vertex, p_influence, "FSkinInfluences::GetBone");
+    return Bones(p_influence)[p_vertex];
+}
+
+float lm::FSkinInfluences::GetWeight(size_t p_vertex, int p_influence) const
+{
+    CheckVertex(p_vertex, p_influence, "FSkinInfluences::GetWeight");
+    return Weights(p_influence)[p_vertex];
+}
+
+uint32_t lm::FSkinInfluences::GetMaxBone() const
+{
+    uint32_t result = 0;
+
+    if (m_bones.empty())
+    {
+        return result;
+    }
+
+    for (int influence = 0; influence < MaxInfluences; influence++)
+    {
+        const uint32_t* bones = Bones(influence);
+        result = std::max(result, *std::max_element(bones, bones + m_weights.PaddedSize()));
+    }
+
+    return result;
+}
+
+uint32_t* lm::FSkinInfluences::Bones(int p_influence) { return m_bones.data() + p_influence * m_weights.PaddedSize(); }
+const uint32_t* lm::FSkinInfluences::Bones(int p_influence) const { return m_bones.data() + p_influence * m_weights.PaddedSize(); }
+float* lm::FSkinInfluences::Weights(int p_influence) { return m_weights.Lane(p_influence); }
+const float* lm::FSkinInfluences::Weights(int p_influence) const { return m_weights.Lane(p_influence); }
+
+void lm::FSkinInfluences::CheckVertex(size_t p_vertex, int p_influence, const char* p_function) const
+{
+    if (p_vertex >= Size() || p_influence < 0 || p_influence >= MaxInfluences)
+    {
+        throw std::out_of_range(std::string(p_function) + ": vertex or influence out of range");
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "../SIMD/LaneBuffer.hpp"
+
+namespace lm
+{
+    /**
+     * Structure of arrays storage of the bones influencing each vertex of a skinned mesh
+     * @details Up to MaxInfluences (bone, weight) pairs per vertex, influence i of every vertex lives
+     * in one bone array and one weight array. Unused influences have bone 0 and weight 0.
+     * @note The arrays are padded like the streams so the skinning kernels load whole registers
+    */
+    struct FSkinInfluences
+    {
+        static constexpr int MaxInfluences = 4;
+
+        /**
+         * @brief Creates an empty set of influences
+        */
+        FSkinInfluences();
+
+        /**
+         * @brief Creates the influences of p_size vertices, all unused
+         * @param p_size The number of vertices
+        */
+        explicit FSkinInfluences(size_t p_size);
+
+        /**
+         * @brief Returns the number of vertices
+        */
+        size_t Size() const;
+
+        /**
+         * @brief Changes the number of vertices, new vertices have no influence
+         * @param p_size The number of vertices
+        */
+        void Resize(size_t p_size);
+
+        /**
+         * @brief Sets the influences of a vertex, the slots past the given ones are cleared
+         * @param p_vertex The vertex
+         * @param p_bones The bone indices, at most MaxInfluences
+         * @param p_weights The weights, same size as p_bones
+        */
+        void Set(size_t p_vertex, std::span<const uint32_t> p_bones, std::span<const float> p_weights);
+
+        uint32_t GetBone(size_t p_vertex, int p_influence) const;
+        float GetWeight(size_t p_vertex, int p_influence) const;
+
+        /**
+         * @brief Returns the highest bone index, weights of 0 included since the kernels read every slot
+        */
+        uint32_t GetMaxBone() const;
+
+        uint32_t* Bones(int p_influence);
+        const uint32_t* Bones(int p_influence) const;
+        float* Weights(int p_influence);
+        const float* Weights(int p_influence) const;
+
+    private:
+        void CheckVertex(size_t p_vertex, int p_influence, const char* p_function) const;
+
+        simd::FLaneBuffer m_weights;
+        std::vector<uint32_t> m_bones;
+    };
+}
@@ -0,0 +1,94 @@
+/**
+ * FMat4::Skin and FAffine34::Skin, both run the linear blend skinning kernel on their palette layout.
+*/
+
+#include "FSkinInfluences.hpp"
+#include "../Mat4/FMat4.hpp"
+#include "../Affine/FAffine34.hpp"
+#include "../Vec3/FVec3Stream.hpp"
+#include "../Threading/FWorkerPool.hpp"
+#include "../SIMD/Dispatch.hpp"
+
+#include <stdexcept>
+#include <string>
+
+using namespace lm;
+
+using FLinearBlendSkinKernel = void (*)(const float* p_palette, const uint32_t* const* p_indices, const float* const* p_weights,
+    const float* const* p_positions, const float* const* p_normals, float* const* p_resultPositions, float* const* p_resultNormals, size_t p_count);
+
+// A multiple of the stream padding, so every chunk starts on a whole register
+static constexpr size_t s_chunkSize = 1024;
+
+static void Skin(const char* p_function, FLinearBlendSkinKernel p_kernel, const float* p_palette, size_t p_paletteSize, const FSkinInfluences& p_influences,
+    const FVec3Stream& p_positions, const FVec3Stream& p_normals, FVec3Stream& p_resultPositions, FVec3Stream& p_resultNormals, FWorkerPool* p_pool)
+{
+    const size_t count = p_influences.Size();
+
+    if (p_positions.Size() != count || p_normals.Size() != count)
+    {
+        throw std::logic_error(std::string(p_function) + ": influences, positions and normals must have the same size");
+    }
+
+    if (count > 0 && p_influences.GetMaxBone() >= p_paletteSize)
+    {
+        throw std::out_of_range(std::string(p_function) + ": bone index out of range");
+    }
+
+    p_resultPositions.Resize(count);
+    p_resultNormals.Resize(count);
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    const auto run = [&](size_t p_begin, size_t p_end)
+    {
+        const uint32_t* const indices[] = { p_influences.Bones(0) + p_begin, p_influences.Bones(1) + p_begin, p_influences.Bones(2) + p_begin, p_influences.Bones(3) + p_begin };
+        const float* const weights[] = { p_influences.Weights(0) + p_begin, p_influences.Weights(1) + p_begin, p_influences.Weights(2) + p_begin, p_influences.Weights(3) + p_begin };
+        const float* const positions[] = { p_positions.X() + p_begin, p_positions.Y() + p_begin, p_positions.Z() + p_begin };
+        const float* const normals[] = { p_normals.X() + p_begin, p_normals.Y() + p_begin, p_normals.Z() + p_begin };
+        float* const resultPositions[] = { p_resultPositions.X() + p_begin, p_resultPositions.Y() + p_begin, p_resultPositions.Z() + p_begin };
+        float* const resultNormals[] = { p_resultNormals.X() + p_begin, p_resultNormals.Y() + p_begin, p_resultNormals.Z() + p_begin };
+
+        p_kernel(p_palette, indices, weights, positions, normals, resultPositions, resultNormals, p_end - p_begin);
+    };
+
+    if (p_pool != nullptr)
+    {
+        p_pool->ParallelFor(count, s_chunkSize, run);
+    }
+    else
+    {
+        run(0, count);
+    }
+}
+
+void lm::FMat4::Skin(std::span<const FMat4> p_palette, const FSkinInfluences& p_influences, const FVec3Stream& p_positions, const FVec3Stream& p_normals,
+    FVec3Stream& p_resultPositions, FVec3Stream& p_resultNormals)
+{
+    ::Skin("FMat4::Skin", simd::Kernels().mat4LinearBlendSkin, reinterpret_cast<const float*>(p_palette.data()), p_palette.size(), p_influences,
+        p_positions, p_normals, p_resultPositions, p_resultNormals, nullptr);
+}
+
+void lm::FMat4::Skin(std::span<const FMat4> p_palette, const FSkinInfluences& p_influences, const FVec3Stream& p_positions, const FVec3Stream& p_normals,
+    FVec3Stream& p_resultPositions, FVec3Stream& p_resultNormals, FWorkerPool& p_pool)
+{
+    ::Skin("FMat4::Skin", simd::Kernels().mat4LinearBlendSkin, reinterpret_cast<const float*>(p_palette.data()), p_palette.size(), p_influences,
+        p_positions, p_normals, p_resultPositions, p_resultNormals, &p_pool);
+}
+
+void lm::FAffine34::Skin(std::span<const FAffine34> p_palette, const FSkinInfluences& p_influences, const FVec3Stream& p_positions, const FVec3Stream& p_normals,
+    FVec3Stream& p_resultPositions, FVec3Stream& p_resultNormals)
+{
+    ::Skin("FAffine34::Skin", simd::Kernels().affine34LinearBlendSkin, reinterpret_cast<const float*>(p_palette.data()), p_palette.size(), p_influences,
+        p_positions, p_normals, p_resultPositions, p_resultNormals, nullptr);
+}
+
+void lm::FAffine34::Skin(std::span<const FAffine34> p_palette, const FSkinInfluences& p_influences, const FVec3Stream& p_positions, const FVec3Stream& p_normals,
+    FVec3Stream& p_resultPositions, FVec3Stream& p_resultNormals, FWorkerPool& p_pool)
+{
+    ::Skin("FAffine34::Skin", simd::Kernels().affine34LinearBlendSkin, reinterpret_cast<const float*>(p_palette.data()), p_palette.size(), p_influences,
+        p_positions, p_normals, p_resultPositions, p_resultNormals, &p_pool);
+}
@@ -0,0 +1,176 @@
+/**
+ * FQuatCodec against its documented error bounds.
+ *
+ * Random unit quaternions, plus the identity and the rotations of half a
+ * turn about an axis, are encoded and decoded in 32 and 48 bits. The angle
+ * to the input and the component errors must stay within the bounds of
+ * FQuatCodec, and the decoded quaternions in the hemisphere of the input.
+ * The batch functions must give the codes and quaternions of the single
+ * value ones at every SIMD level.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "TestUtilities.h"
+#include "../Quaternion/FQuat.hpp"
+#include "../Quaternion/FQuatCodec.hpp"
+
+using namespace lm;
+using namespace lm::tests;
+
+static constexpr size_t s_randomCount = 1000003;
+
+/**
+ * Documented bounds of one codec
+*/
+struct FCodecBounds
+{
+    const char* m_name;
+    double m_angle;
+    double m_component;
+};
+
+static constexpr FCodecBounds s_bounds32 = { "32 bits", 6.5e-3, 2.8e-3 };
+static constexpr FCodecBounds s_bounds48 = { "48 bits", 1.5e-4, 6.5e-5 };
+
+/**
+ * Return the identity, the half turns about each axis and their opposites
+*/
+static std::vector<FQuat> MakeExactRotations()
+{
+    std::vector<FQuat> rotations;
+
+    for (int c = 0; c < 4; c++)
+    {
+        for (float sign : { 1.0f, -1.0f })
+        {
+            float components[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            components[c] = sign;
+            rotations.push_back(FQuat(components[0], components[1], components[2], components[3]));
+        }
+    }
+
+    return rotations;
+}
+
+/**
+ * Return the exact rotations followed by random unit quaternions
+*/
+static std::vector<FQuat> MakeRotations()
+{
+    std::mt19937 random(11);
+    std::normal_distribution<float> normal;
+    std::vector<FQuat> rotations = MakeExactRotations();
+
+    while (rotations.size() < s_randomCount)
+        rotations.push_back(FQuat::Normalize(FQuat(normal(random), normal(random), normal(random), normal(random))));
+
+    return rotations;
+}
+
+/**
+ * Check the decoded rotations against the inputs and the documented bounds
+*/
+static void CheckDecoded(const FCodecBounds& p_bounds, std::span<const FQuat> p_rotations, std::span<const FQuat> p_decoded)
+{
+    const size_t exactCount = MakeExactRotations().size();
+    double angleError = 0.0;
+    double componentError = 0.0;
+    size_t otherHemisphere = 0;
+    size_t inexact = 0;
+
+    for (size_t i = 0; i < p_rotations.size(); i++)
+    {
+        const FQuat& rotation = p_rotations[i];
+        const FQuat& decoded = p_decoded[i];
+        const double reference[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+
+        angleError = std::max(angleError, RotationAngle(decoded, reference));
+        componentError = std::max({ componentError, std::fabs(double(decoded.x) - rotation.x), std::fabs(double(decoded.y) - rotation.y),
+            std::fabs(double(decoded.z) - rotation.z), std::fabs(double(decoded.w) - rotation.w) });
+
+        if (FQuat::Dot(decoded, rotation) <= 0.0f)
+            otherHemisphere++;
+
+        if (i < exactCount && !(decoded.x == rotation.x && decoded.y == rotation.y && decoded.z == rotation.z && decoded.w == rotation.w))
+            inexact++;
+    }
+
+    std::printf("%s: rotations within %.3e radians, components within %.3e\n", p_bounds.m_name, angleError, componentError);
+
+    Check(angleError <= p_bounds.m_angle, "%s: a decoded rotation is %.3e radians off", p_bounds.m_name, angleError);
+    Check(componentError <= p_bounds.m_component, "%s: a decoded component is %.3e off", p_bounds.m_name, componentError);
+    Check(otherHemisphere == 0, "%s: %zu decoded quaternions left the hemisphere of the input", p_bounds.m_name, otherHemisphere);
+    Check(inexact == 0, "%s: %zu of the identity and half turns about an axis do not round-trip exactly", p_bounds.m_name, inexact);
+}
+
+/**
+ * Return the largest component difference between two arrays of quaternions
+*/
+static float LargestDifference(std::span<const FQuat> p_left, std::span<const FQuat> p_right)
+{
+    float difference = 0.0f;
+
+    for (size_t i = 0; i < p_left.size(); i++)
+    {
+        difference = std::max({ difference, std::fabs(p_left[i].x - p_right[i].x), std::fabs(p_left[i].y - p_right[i].y),
+            std::fabs(p_left[i].z - p_right[i].z), std::fabs(p_left[i].w - p_right[i].w) });
+    }
+
+    return difference;
+}
+
+int main()
+{
+    const std::vector<FQuat> rotations = MakeRotations();
+    const size_t count = rotations.size();
+
+    // The single value functions do not depend on the SIMD level
+    std::vector<uint32_t> codes32(count);
+    std::vector<FPackedQuat48> codes48(count);
+    std::vector<FQuat> decoded32(count);
+    std::vector<FQuat> decoded48(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        codes32[i] = FQuatCodec::Encode32(rotations[i]);
+        codes48[i] = FQuatCodec::Encode48(rotations[i]);
+        decoded32[i] = FQuatCodec::Decode32(codes32[i]);
+        decoded48[i] = FQuatCodec::Decode48(codes48[i]);
+    }
+
+    CheckDecoded(s_bounds32, rotations, decoded32);
+    CheckDecoded(s_bounds48, rotations, decoded48);
+
+    // The batches give the same codes, and the same quaternions up to a rounding on the rebuilt component
+    ForEachSIMDLevel([&](ESIMDLevel p_level)
+    {
+        std::vector<uint32_t> batchCodes32(count);
+        std::vector<FPackedQuat48> batchCodes48(count);
+        std::vector<FQuat> batchDecoded32(count);
+        std::vector<FQuat> batchDecoded48(count);
+
+        FQuatCodec::Encode32(rotations, batchCodes32);
+        FQuatCodec::Encode48(rotations, batchCodes48);
+        FQuatCodec::Decode32(codes32, batchDecoded32);
+        FQuatCodec::Decode48(codes48, batchDecoded48);
+
+        const float difference32 = LargestDifference(decoded32, batchDecoded32);
+        const float difference48 = LargestDifference(decoded48, batchDecoded48);
+
+        std::printf("%-8s batch decodes within %.3e (32 bits) and %.3e (48 bits) of the single value ones\n",
+            ToString(p_level), difference32, difference48);
+
+        Check(batchCodes32 == codes32, "%s: Encode32 batch codes differ from the single value ones", ToString(p_level));
+        Check(batchCodes48 == codes48, "%s: Encode48 batch codes differ from the single value ones", ToString(p_level));
+        Check(difference32 <= 1e-6f, "%s: Decode32 batch is %.3e from the single value one", ToString(p_level), difference32);
+        Check(difference48 <= 1e-6f, "%s: Decode48 batch is %.3e from the single value one", ToString(p_level), difference48);
+    });
+
+    return Report("QuatCodecTests");
+}
@@ -0,0 +1,219 @@
+/**
+ * FQuat::SLerpFast and FQuatStream::SLerpFast against a double precision slerp.
+ *
+ * The cosine between the quaternions sweeps [-1, 1] and the interpolation
+ * factor [0, 1], for several pairs of directions, at every SIMD level. The
+ * angle of the rotation between the result and the exact one must stay
+ * within the documented 7.8e-4 radians.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "TestUtilities.h"
+#include "../Quaternion/FQuat.hpp"
+#include "../Quaternion/FQuatStream.hpp"
+
+using namespace lm;
+using namespace lm::tests;
+
+static constexpr double s_bound = 7.8e-4;
+static constexpr int s_cosineSteps = 2000;
+static constexpr int s_alphaSteps = 100;
+static constexpr int s_pairs = 4;
+
+// Below this cosine the float and double dot products may pick different paths, both are accepted
+static constexpr double s_ambiguousCosine = 1e-6;
+
+/**
+ * Pair of quaternions at a given cosine and the exact slerp between them
+*/
+struct FSLerpCase
+{
+    FQuat m_start;
+    FQuat m_end;
+    float m_alpha;
+    double m_exact[4];
+    double m_otherPath[4];
+    bool m_ambiguous;
+};
+
+/**
+ * Write the slerp from p_start to p_end, or to -p_end when p_flip, at p_alpha in p_result
+*/
+static void ExactSLerp(const FQuat& p_start, const FQuat& p_end, double p_alpha, bool p_flip, double p_result[4])
+{
+    const double start[4] = { p_start.x, p_start.y, p_start.z, p_start.w };
+    double end[4] = { p_end.x, p_end.y, p_end.z, p_end.w };
+    double cosine = 0.0;
+
+    for (int c = 0; c < 4; c++)
+    {
+        end[c] = p_flip ? -end[c] : end[c];
+        cosine += start[c] * end[c];
+    }
+
+    const double angle = std::acos(std::clamp(cosine, -1.0, 1.0));
+    const double sine = std::sin(angle);
+    const double startWeight = sine < 1e-12 ? 1.0 - p_alpha : std::sin((1.0 - p_alpha) * angle) / sine;
+    const double endWeight = sine < 1e-12 ? p_alpha : std::sin(p_alpha * angle) / sine;
+    double length = 0.0;
+
+    for (int c = 0; c < 4; c++)
+    {
+        p_result[c] = start[c] * startWeight + end[c] * endWeight;
+        length += p_result[c] * p_result[c];
+    }
+
+    for (int c = 0; c < 4; c++)
+        p_result[c] /= std::sqrt(length);
+}
+
+/**
+ * Build the sweep: for each pair of orthogonal directions, every cosine and every alpha of the grid
+*/
+static std::vector<FSLerpCase> MakeCases()
+{
+    std::mt19937 random(7);
+    std::normal_distribution<double> normal;
+    std::vector<FSLerpCase> cases;
+
+    for (int pair = 0; pair < s_pairs; pair++)
+    {
+        // Gram-Schmidt: a random unit quaternion and a unit quaternion orthogonal to it
+        double start[4];
+        double side[4];
+        double startLength = 0.0;
+
+        for (int c = 0; c < 4; c++)
+        {
+            start[c] = normal(random);
+            side[c] = normal(random);
+            startLength += start[c] * start[c];
+        }
+
+        double projection = 0.0;
+        double sideLength = 0.0;
+
+        for (int c = 0; c < 4; c++)
+        {
+            start[c] /= std::sqrt(startLength);
+            projection += start[c] * side[c];
+        }
+
+        for (int c = 0; c < 4; c++)
+        {
+            side[c] -= projection * start[c];
+            sideLength += side[c] * side[c];
+        }
+
+        for (int c = 0; c < 4; c++)
+            side[c] /= std::sqrt(sideLength);
+
+        for (int i = 0; i <= s_cosineSteps; i++)
+        {
+            const double cosine = -1.0 + 2.0 * i / s_cosineSteps;
+            const double sine = std::sqrt(std::max(0.0, 1.0 - cosine * cosine));
+            const FQuat first(static_cast<float>(start[0]), static_cast<float>(start[1]), static_cast<float>(start[2]), static_cast<float>(start[3]));
+            const FQuat second(float(cosine * start[0] + sine * side[0]), float(cosine * start[1] + sine * side[1]),
+                float(cosine * start[2] + sine * side[2]), float(cosine * start[3] + sine * side[3]));
+
+            // The hemisphere from the float inputs
+            const double inputCosine = double(first.x) * second.x + double(first.y) * second.y + double(first.z) * second.z + double(first.w) * second.w;
+
+            for (int j = 0; j <= s_alphaSteps; j++)
+            {
+                FSLerpCase sample;
+                sample.m_start = first;
+                sample.m_end = second;
+                sample.m_alpha = float(j) / s_alphaSteps;
+                sample.m_ambiguous = std::fabs(inputCosine) < s_ambiguousCosine;
+                ExactSLerp(first, second, sample.m_alpha, inputCosine < 0.0, sample.m_exact);
+                ExactSLerp(first, second, sample.m_alpha, inputCosine >= 0.0, sample.m_otherPath);
+                cases.push_back(sample);
+            }
+        }
+    }
+
+    return cases;
+}
+
+/**
+ * Return the angle between p_result and the exact slerp of p_case
+*/
+static double Error(const FSLerpCase& p_case, const FQuat& p_result)
+{
+    const double error = RotationAngle(p_result, p_case.m_exact);
+    return p_case.m_ambiguous ? std::min(error, RotationAngle(p_result, p_case.m_otherPath)) : error;
+}
+
+int main()
+{
+    const std::vector<FSLerpCase> cases = MakeCases();
+
+    std::vector<FQuat> starts;
+    std::vector<FQuat> ends;
+    std::vector<float> alphas;
+
+    for (const FSLerpCase& sample : cases)
+    {
+        starts.push_back(sample.m_start);
+        ends.push_back(sample.m_end);
+        alphas.push_back(sample.m_alpha);
+    }
+
+    const FQuatStream start(starts);
+    const FQuatStream end(ends);
+
+    ForEachSIMDLevel([&](ESIMDLevel p_level)
+    {
+        double scalarError = 0.0;
+        double streamError = 0.0;
+        double uniformError = 0.0;
+
+        for (const FSLerpCase& sample : cases)
+            scalarError = std::max(scalarError, Error(sample, FQuat::SLerpFast(sample.m_start, sample.m_end, sample.m_alpha)));
+
+        // An alpha per element
+        FQuatStream result(cases.size());
+        FQuatStream::SLerpFast(start, end, alphas, result);
+
+        for (size_t i = 0; i < cases.size(); i++)
+            streamError = std::max(streamError, Error(cases[i], result[i]));
+
+        // One alpha for the whole stream, the cases are ordered by pair, cosine then alpha
+        const size_t alphaCount = s_alphaSteps + 1;
+        const size_t rowCount = cases.size() / alphaCount;
+
+        for (size_t j = 0; j < alphaCount; j++)
+        {
+            std::vector<FQuat> rowStarts(rowCount);
+            std::vector<FQuat> rowEnds(rowCount);
+
+            for (size_t row = 0; row < rowCount; row++)
+            {
+                rowStarts[row] = starts[row * alphaCount + j];
+                rowEnds[row] = ends[row * alphaCount + j];
+            }
+
+            FQuatStream rowResult(rowCount);
+            FQuatStream::SLerpFast(FQuatStream(rowStarts), FQuatStream(rowEnds), alphas[j], rowResult);
+
+            for (size_t row = 0; row < rowCount; row++)
+                uniformError = std::max(uniformError, Error(cases[row * alphaCount + j], rowResult[row]));
+        }
+
+        std::printf("%-8s FQuat::SLerpFast %.3e, FQuatStream::SLerpFast %.3e (alpha per element) %.3e (one alpha)\n",
+            ToString(p_level), scalarError, streamError, uniformError);
+
+        Check(scalarError <= s_bound, "%s: FQuat::SLerpFast is %.3e radians off", ToString(p_level), scalarError);
+        Check(streamError <= s_bound, "%s: FQuatStream::SLerpFast is %.3e radians off", ToString(p_level), streamError);
+        Check(uniformError <= s_bound, "%s: FQuatStream::SLerpFast with one alpha is %.3e radians off", ToString(p_level), uniformError);
+    });
+
+    return Report("SLerpFastTests");
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+
+#include "../Quaternion/FQuat.hpp"
+#include "../SIMD/Dispatch.hpp"
+
+/**
+ * Helpers of the test executables: each one checks conditions, prints the failed
+ * ones and returns the number of failures from main, which ctest reports.
+*/
+namespace lm::tests
+{
+    inline int s_failures = 0;
+
+    /**
+     * Count and print a failure when p_condition is false
+     * @param p_format printf format of the message
+    */
+    inline void Check(bool p_condition, const char* p_format, ...)
+    {
+        if (p_condition)
+            return;
+
+        s_failures++;
+
+        std::va_list arguments;
+        va_start(arguments, p_format);
+        std::fprintf(stderr, "FAILED: ");
+        std::vfprintf(stderr, p_format, arguments);
+        std::fprintf(stderr, "\n");
+        va_end(arguments);
+    }
+
+    /**
+     * Return the angle in radians of the rotation between p_quat and p_reference, both unit quaternions
+     * @note From the chord, which stays precise for small angles where acos of the dot product does not.
+     * A quaternion and its opposite are the same rotation
+    */
+    inline double RotationAngle(const FQuat& p_quat, const double p_reference[4])
+    {
+        const double quat[4] = { p_quat.x, p_quat.y, p_quat.z, p_quat.w };
+        double difference = 0.0;
+        double sum = 0.0;
+
+        for (int c = 0; c < 4; c++)
+        {
+            difference += (quat[c] - p_reference[c]) * (quat[c] - p_reference[c]);
+            sum += (quat[c] + p_reference[c]) * (quat[c] + p_reference[c]);
+        }
+
+        const double chord = std::sqrt(std::min(difference, sum));
+        return 4.0 * std::asin(std::min(chord * 0.5, 1.0));
+    }
+
+    /**
+     * Call p_test once per level of the batch kernels that SetSIMDLevel accepts, then restore the active level
+    */
+    template<typename Test>
+    void ForEachSIMDLevel(Test p_test)
+    {
+        const ESIMDLevel active = GetSIMDLevel();
+
+        for (ESIMDLevel level : { ESIMDLevel::Scalar, ESIMDLevel::SSE2, ESIMDLevel::SSE42, ESIMDLevel::AVX2, ESIMDLevel::AVX512 })
+        {
+            if (SetSIMDLevel(level))
+                p_test(level);
+        }
+
+        SetSIMDLevel(active);
+    }
+
+    /**
+     * Print the result of the executable and return its exit code
+    */
+    inline int Report(const char* p_name)
+    {
+        std::printf("%s: %d failure(s)\n", p_name, s_failures);
+        return s_failures == 0 ? 0 : 1;
+    }
+}
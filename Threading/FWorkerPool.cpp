@@ -0,0 +1,114 @@
+#include "FWorkerPool.hpp"
+
+#include <algorithm>
+
+using namespace lm;
+
+lm::FWorkerPool::FWorkerPool(size_t p_threadCount)
+{
+    if (p_threadCount == 0)
+    {
+        p_threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+
+    m_workers.reserve(p_threadCount - 1);
+
+    for (size_t i = 1; i < p_threadCount; i++)
+    {
+        m_workers.emplace_back(&FWorkerPool::WorkerLoop, this);
+    }
+}
+
+lm::FWorkerPool::~FWorkerPool()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stop = true;
+    }
+
+    m_wake.notify_all();
+
+    for (std::thread& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+size_t lm::FWorkerPool::GetThreadCount() const
+{
+    return m_workers.size() + 1;
+}
+
+void lm::FWorkerPool::ParallelFor(size_t p_count, size_t p_chunkSize, const std::function<void(size_t, size_t)>& p_task)
+{
+    p_chunkSize = std::max<size_t>(p_chunkSize, 1);
+
+    // Waking the workers costs more than a single chunk
+    if (p_count <= p_chunkSize || m_workers.empty())
+    {
+        if (p_count > 0)
+        {
+            p_task(0, p_count);
+        }
+
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_task = &p_task;
+        m_count = p_count;
+        m_chunkSize = p_chunkSize;
+        m_nextChunk.store(0, std::memory_order_relaxed);
+        m_busyWorkers = m_workers.size();
+        m_generation++;
+    }
+
+    m_wake.notify_all();
+    RunChunks();
+
+    std::unique_lock lock(m_mutex);
+    m_done.wait(lock, [this] { return m_busyWorkers == 0; });
+    m_task = nullptr;
+}
+
+void lm::FWorkerPool::WorkerLoop()
+{
+    uint64_t generation = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock lock(m_mutex);
+            m_wake.wait(lock, [&] { return m_stop || m_generation != generation; });
+
+            if (m_stop)
+            {
+                return;
+            }
+
+            generation = m_generation;
+        }
+
+        RunChunks();
+
+        std::lock_guard lock(m_mutex);
+
+        if (--m_busyWorkers == 0)
+        {
+            m_done.notify_one();
+        }
+    }
+}
+
+void lm::FWorkerPool::RunChunks()
+{
+    const size_t chunkCount = (m_count + m_chunkSize - 1) / m_chunkSize;
+
+    for (size_t chunk = m_nextChunk.fetch_add(1, std::memory_order_relaxed); chunk < chunkCount;
+        chunk = m_nextChunk.fetch_add(1, std::memory_order_relaxed))
+    {
+        const size_t begin = chunk * m_chunkSize;
+        (*m_task)(begin, std::min(begin + m_chunkSize, m_count));
+    }
+}
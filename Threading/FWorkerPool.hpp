@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lm
+{
+    /**
+     * @brief A fixed set of threads running data-parallel loops
+     * @details ParallelFor splits a range in chunks handed out through an atomic counter, the calling
+     * thread works on chunks too and returns once every chunk is done. Threads sleep between loops.
+     * @note One loop at a time: ParallelFor must not be called concurrently or from inside a task
+    */
+    struct FWorkerPool
+    {
+        /**
+         * @brief Starts the workers
+         * @param p_threadCount Threads working on a loop, the caller included. 0 uses one per hardware thread
+        */
+        explicit FWorkerPool(size_t p_threadCount = 0);
+        ~FWorkerPool();
+
+        FWorkerPool(const FWorkerPool&) = delete;
+        FWorkerPool& operator=(const FWorkerPool&) = delete;
+
+        /**
+         * @brief Returns the number of threads working on a loop, the caller included
+        */
+        size_t GetThreadCount() const;
+
+        /**
+         * @brief Calls p_task(begin, end) on chunks of [0, p_count) from every thread and waits for all of them
+         * @param p_count Size of the range
+         * @param p_chunkSize Size of a chunk, the last one may be smaller. A range of one chunk runs on the caller only
+         * @param p_task Function called on each chunk, it must not throw
+        */
+        void ParallelFor(size_t p_count, size_t p_chunkSize, const std::function<void(size_t, size_t)>& p_task);
+
+    private:
+        void WorkerLoop();
+        void RunChunks();
+
+        std::vector<std::thread> m_workers;
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_done;
+
+        const std::function<void(size_t, size_t)>* m_task = nullptr;
+        size_t m_count = 0;
+        size_t m_chunkSize = 1;
+        std::atomic<size_t> m_nextChunk = 0;
+        size_t m_busyWorkers = 0;
+        uint64_t m_generation = 0;
+        bool m_stop = false;
+    };
+}
@@ -0,0 +1,164 @@
+#include "FTransform.hpp"
+#include "../SIMD/Mat4Kernels.h"
+
+using namespace lm;
+
+lm::FTransform::FTransform() : m_position(FVec3::Zero), m_rotation(FQuat::identity), m_scale(FVec3::One)
+{
+}
+
+lm::FTransform::FTransform(const FVec3& p_position, const FQuat& p_rotation, const FVec3& p_scale) :
+    m_position(p_position), m_rotation(p_rotation), m_scale(p_scale)
+{
+}
+
+FTransform lm::FTransform::operator*(const FTransform& p_other) const
+{
+    return Multiply(*this, p_other);
+}
+
+FTransform& lm::FTransform::operator*=(const FTransform& p_other)
+{
+    Set(m_position + m_rotation * (m_scale * p_other.m_position), m_rotation * p_other.m_rotation, m_scale * p_other.m_scale);
+    return *this;
+}
+
+FVec3 lm::FTransform::operator*(const FVec3& p_point) const
+{
+    return TransformPoint(*this, p_point);
+}
+
+bool lm::FTransform::operator==(const FTransform& p_other) const
+{
+    return m_position == p_other.m_position && m_rotation == p_other.m_rotation && m_scale == p_other.m_scale;
+}
+
+bool lm::FTransform::operator!=(const FTransform& p_other) const
+{
+    return !(*this == p_other);
+}
+
+const FVec3& lm::FTransform::GetPosition() const
+{
+    return m_position;
+}
+
+const FQuat& lm::FTransform::GetRotation() const
+{
+    return m_rotation;
+}
+
+const FVec3& lm::FTransform::GetScale() const
+{
+    return m_scale;
+}
+
+void lm::FTransform::SetPosition(const FVec3& p_position)
+{
+    m_position = p_position;
+    m_version++;
+}
+
+void lm::FTransform::SetRotation(const FQuat& p_rotation)
+{
+    m_rotation = p_rotation;
+    m_version++;
+}
+
+void lm::FTransform::SetScale(const FVec3& p_scale)
+{
+    m_scale = p_scale;
+    m_version++;
+}
+
+void lm::FTransform::Set(const FVec3& p_position, const FQuat& p_rotation, const FVec3& p_scale)
+{
+    m_position = p_position;
+    m_rotation = p_rotation;
+    m_scale = p_scale;
+    m_version++;
+}
+
+void lm::FTransform::Translate(const FVec3& p_offset)
+{
+    SetPosition(m_position + p_offset);
+}
+
+void lm::FTransform::Rotate(const FQuat& p_rotation)
+{
+    SetRotation(p_rotation * m_rotation);
+}
+
+uint64_t lm::FTransform::GetVersion() const
+{
+    return m_version;
+}
+
+const FMat4& lm::FTransform::GetMatrix() const
+{
+    if (m_matrixVersion != m_version)
+    {
+        simd::Mat4TRS(m_position.x, m_position.y, m_position.z, m_rotation.x, m_rotation.y, m_rotation.z, m_rotation.w,
+            m_scale.x, m_scale.y, m_scale.z, m_matrix);
+        m_matrixVersion = m_version;
+    }
+
+    return m_matrix;
+}
+
+const FMat4& lm::FTransform::GetInverseMatrix() const
+{
+    if (m_inverseVersion != m_version)
+    {
+        // (T R S)^-1 = S^-1 R^T T^-1: row r of the inverse is column r of R divided by the scale r
+        float rotation[3][3];
+        simd::RotationScale(m_rotation.x, m_rotation.y, m_rotation.z, m_rotation.w, 1.0f, 1.0f, 1.0f, rotation);
+
+        const float inverseScale[3] = { 1.0f / m_scale.x, 1.0f / m_scale.y, 1.0f / m_scale.z };
+        float translation[3];
+
+        for (int r = 0; r < 3; r++)
+        {
+            translation[r] = -(rotation[r][0] * m_position.x + rotation[r][1] * m_position.y + rotation[r][2] * m_position.z) * inverseScale[r];
+        }
+
+        for (int c = 0; c < 3; c++)
+        {
+            m_inverse.m_matrix[c] = FVec4(rotation[0][c] * inverseScale[0], rotation[1][c] * inverseScale[1], rotation[2][c] * inverseScale[2], 0.0f);
+        }
+
+        m_inverse.m_matrix[3] = FVec4(translation[0], translation[1], translation[2], 1.0f);
+        m_inverseVersion = m_version;
+    }
+
+    return m_inverse;
+}
+
+FTransform lm::FTransform::Multiply(const FTransform& p_left, const FTransform& p_right)
+{
+    return FTransform(p_left.m_position + p_left.m_rotation * (p_left.m_scale * p_right.m_position),
+        p_left.m_rotation * p_right.m_rotation, p_left.m_scale * p_right.m_scale);
+}
+
+FTransform lm::FTransform::Inverse(const FTransform& p_transform)
+{
+    const FQuat rotation = FQuat::Conjugate(p_transform.m_rotation);
+    const FVec3 scale(1.0f / p_transform.m_scale.x, 1.0f / p_transform.m_scale.y, 1.0f / p_transform.m_scale.z);
+
+    return FTransform(scale * (rotation * -p_transform.m_position), rotation, scale);
+}
+
+FVec3 lm::FTransform::TransformPoint(const FTransform& p_transform, const FVec3& p_point)
+{
+    return p_transform.m_position + p_transform.m_rotation * (p_transform.m_scale * p_point);
+}
+
+FVec3 lm::FTransform::TransformDirection(const FTransform& p_transform, const FVec3& p_direction)
+{
+    return p_transform.m_rotation * (p_transform.m_scale * p_direction);
+}
+
+std::ostream& lm::operator<<(std::ostream& p_stream, const FTransform& p_transform)
+{
+    return p_stream << "FTransform(" << p_transform.GetPosition() << ", " << p_transform.GetRotation() << ", " << p_transform.GetScale() << ")";
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+
+#include "../Vec3/FVec3.hpp"
+#include "../Quaternion/FQuat.hpp"
+#include "../Mat4/FMat4.hpp"
+
+namespace lm
+{
+    /**
+     * @brief A translation, rotation and scale applied in the order scale, rotation, translation
+     * @details Transforms compose and invert as TRS values without building matrices. The matrix and
+     * its inverse are built on first request and cached, each mutation bumps a version counter which
+     * invalidates both caches.
+     * @note The caches are filled by const getters: reading one FTransform from several threads
+     * needs the matrices requested once beforehand
+    */
+    struct FTransform
+    {
+        /**
+         * @brief Creates the identity transform
+        */
+        FTransform();
+
+        /**
+         * @brief Creates a transform from its parts
+         * @param p_position The translation
+         * @param p_rotation The rotation, expected of unit length
+         * @param p_scale The scale
+        */
+        FTransform(const FVec3& p_position, const FQuat& p_rotation = FQuat::identity, const FVec3& p_scale = FVec3::One);
+
+        /**
+         * @brief Composes two transforms, p_other is applied first
+        */
+        FTransform operator*(const FTransform& p_other) const;
+        FTransform& operator*=(const FTransform& p_other);
+        FVec3 operator*(const FVec3& p_point) const;
+
+        /**
+         * @brief Compares the parts, the caches are ignored
+        */
+        bool operator==(const FTransform& p_other) const;
+        bool operator!=(const FTransform& p_other) const;
+
+        const FVec3& GetPosition() const;
+        const FQuat& GetRotation() const;
+        const FVec3& GetScale() const;
+
+        void SetPosition(const FVec3& p_position);
+        void SetRotation(const FQuat& p_rotation);
+        void SetScale(const FVec3& p_scale);
+        void Set(const FVec3& p_position, const FQuat& p_rotation, const FVec3& p_scale);
+
+        /**
+         * @brief Moves the transform by p_offset, in the parent space
+        */
+        void Translate(const FVec3& p_offset);
+
+        /**
+         * @brief Rotates the transform by p_rotation, applied after the current rotation
+        */
+        void Rotate(const FQuat& p_rotation);
+
+        /**
+         * @brief Returns the number of mutations so far, two equal versions mean an unchanged transform
+        */
+        uint64_t GetVersion() const;
+
+        /**
+         * @brief Returns Translation * rotation * Scale, built when the transform changed since the last call
+        */
+        const FMat4& GetMatrix() const;
+
+        /**
+         * @brief Returns the inverse of GetMatrix, built in closed form when the transform changed since the last call
+         * @note Exact for any scale, unlike Inverse which has to stay a TRS
+        */
+        const FMat4& GetInverseMatrix() const;
+
+        /**
+         * @brief Composes two transforms, p_right is applied first
+         * @note The scales are multiplied component-wise: a non uniform p_left scale with a rotated p_right
+         * would shear, which a TRS cannot hold. Compose the matrices in that case
+        */
+        static FTransform Multiply(const FTransform& p_left, const FTransform& p_right);
+
+        /**
+         * @brief Returns the TRS undoing p_transform, exact when the scale is uniform
+        */
+        static FTransform Inverse(const FTransform& p_transform);
+
+        /**
+         * @brief Transforms a point: scale, rotation then translation
+        */
+        static FVec3 TransformPoint(const FTransform& p_transform, const FVec3& p_point);
+
+        /**
+         * @brief Transforms a direction: scale then rotation
+        */
+        static FVec3 TransformDirection(const FTransform& p_transform, const FVec3& p_direction);
+
+    private:
+        FVec3 m_position;
+        FQuat m_rotation;
+        FVec3 m_scale;
+        uint64_t m_version = 1;
+
+        // Versions the caches were built at, 0 for never
+        mutable uint64_t m_matrixVersion = 0;
+        mutable uint64_t m_inverseVersion = 0;
+        mutable FMat4 m_matrix;
+        mutable FMat4 m_inverse;
+    };
+
+    std::ostream& operator<<(std::ostream& p_stream, const FTransform& p_transform);
+}
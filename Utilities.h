@@ -25,24 +25,24 @@
 
 #undef PI
 
-#define PI (4.f * atan(1.f))
+#define PI 3.14159265358979323846f
 #define TO_RADIANS(value) value * PI / 180.f
 #define TO_DEGREES(value) value * 180.f / PI
 
 namespace lm
 {
-	inline double radiansToDegrees(const double rad)
+	constexpr double radiansToDegrees(const double rad)
 	{
 		return rad * (HALF_CIRCLE / PI);
 	}
 
-	inline double degreesToRadians(const double deg)
+	constexpr double degreesToRadians(const double deg)
 	{
 		return deg * (PI / HALF_CIRCLE);
 	}
 
 	template<typename T>
-	inline T clamp(const T& value, const T& min, const T& max)
+	constexpr T clamp(const T& value, const T& min, const T& max)
 	{
 		return value < min ? min : (value > max ? max : value);
 	}
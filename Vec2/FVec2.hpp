@@ -1,6 +1,8 @@
 #pragma once
 #include <iostream>
 
+#include "../LibMathsConfig.h"
+
 namespace lm
 {
     struct FVec2
@@ -14,14 +16,14 @@ namespace lm
         
         FVec2() = default;     
         
-        FVec2( float p_init);
+        constexpr FVec2( float p_init);
         
         /**
         * Default constructor
         * @param p_x
         * @param p_y
         */
-        FVec2(float p_x , float p_y );
+        constexpr FVec2(float p_x, float p_y) : x(p_x), y(p_y) {}
 
 
 
@@ -29,7 +31,7 @@ namespace lm
         * Copy constructor
         * @param p_toCopy
         */
-        FVec2(const FVec2& p_toCopy);
+        constexpr FVec2(const FVec2& p_toCopy) = default;
 
         /**
         * Move constructor
@@ -40,43 +42,43 @@ namespace lm
         /**
         * Negation
         */
-        FVec2 operator-() const;
+        constexpr FVec2 operator-() const;
 
         /**
         * Copy assignment
         * @param p_other
         */
-        FVec2 operator=(const FVec2& p_other);
+        constexpr FVec2& operator=(const FVec2& p_other) = default;
 
         /**
         * Calculate the sum of two vectors
         * @param p_other
         */
-        FVec2 operator+(const FVec2& p_other) const;
+        constexpr FVec2 operator+(const FVec2& p_other) const;
 
         /**
         * Add the right vector to the left one
         * @param p_other
         */
-        FVec2& operator+=(const FVec2& p_other);
+        constexpr FVec2& operator+=(const FVec2& p_other);
 
         /**
         * Calculate the substraction of two vectors
         * @param p_other
         */
-        FVec2 operator-(const FVec2& p_other) const;
+        constexpr FVec2 operator-(const FVec2& p_other) const;
 
         /**
         * Remove the right vector from the left one
         * @param p_other
         */
-        FVec2& operator-=(const FVec2& p_other);
+        constexpr FVec2& operator-=(const FVec2& p_other);
 
         /**
         * Calcualte the multiplication of a vector with a scalar
         * @param p_scalar
         */
-        FVec2 operator*(float p_scalar) const;
+        constexpr FVec2 operator*(float p_scalar) const;
 
         FVec2 operator*(const FVec2& p_other) const;
 
@@ -90,7 +92,7 @@ namespace lm
         * Multiply the vector by a scalar
         * @param p_scalar
         */
-        FVec2& operator*=(float p_scalar);
+        constexpr FVec2& operator*=(float p_scalar);
 
         /**
         * Return the division of scalar and actual vector
@@ -145,21 +147,21 @@ namespace lm
         * @param p_left (First vector)
         * @param p_right (Second vector)
         */
-        static FVec2 Add(const FVec2& p_left, const FVec2& p_right);
+        static constexpr FVec2 Add(const FVec2& p_left, const FVec2& p_right);
 
         /**
         * Calculate the substraction of two vectors
         * @param p_left (First vector)
         * @param p_right (Second vector)
         */
-        static FVec2 Substract(const FVec2& p_left, const FVec2& p_right);
+        static constexpr FVec2 Substract(const FVec2& p_left, const FVec2& p_right);
 
         /**
         * Calculate the multiplication of a vector with a scalar
         * @param p_target
         * @param p_scalar
         */
-        static FVec2 Multiply(const FVec2& p_target, float p_scalar);
+        static constexpr FVec2 Multiply(const FVec2& p_target, float p_scalar);
 
         /**
         * Divide scalar to vector left
@@ -179,7 +181,7 @@ namespace lm
         * @param p_left
         * @param p_right
         */
-        static float Dot(const FVec2& p_left, const FVec2& p_right);
+        static constexpr float Dot(const FVec2& p_left, const FVec2& p_right);
 
         /**
         * Return the normalize of the given vector
@@ -260,7 +262,7 @@ namespace lm
      * @param p_scalar
      * @param p_vec
     */
-    FVec2 operator*(float p_scalar, const FVec2& p_vec);
+    constexpr FVec2 operator*(float p_scalar, const FVec2& p_vec);
 
     FVec2 operator*(const FVec2& p_vec, const FVec2& p_other);
 
@@ -272,4 +274,93 @@ namespace lm
      * @param p_vec
     */
     FVec2 operator/(float p_scalar, const FVec2& p_vec);
-}
\ No newline at end of file
+}
+
+namespace lm
+{
+    inline constexpr FVec2 FVec2::One(1.0f, 1.0f);
+    inline constexpr FVec2 FVec2::Zero(0.0f, 0.0f);
+
+    constexpr FVec2::FVec2( float p_init) : x(p_init), y(p_init)
+    {
+    }
+
+    constexpr FVec2 FVec2::operator-() const
+    {
+        return operator*(-1);
+    }
+
+    constexpr FVec2 FVec2::operator+(const FVec2& p_other) const
+    {
+        return Add(*this, p_other);
+    }
+
+    constexpr FVec2& FVec2::operator+=(const FVec2& p_other)
+    {
+        *this = Add(*this, p_other);
+        return *this;
+    }
+
+    constexpr FVec2 FVec2::operator-(const FVec2& p_other) const
+    {
+        return Substract(*this, p_other);
+    }
+
+    constexpr FVec2& FVec2::operator-=(const FVec2& p_other)
+    {
+        *this = Substract(*this, p_other);
+        return *this;
+    }
+
+    constexpr FVec2 FVec2::operator*(float p_scalar) const
+    {
+        return Multiply(*this, p_scalar);
+    }
+
+    constexpr FVec2& FVec2::operator*=(float p_scalar)
+    {
+        *this = Multiply(*this, p_scalar);
+        return *this;
+    }
+
+    constexpr FVec2 FVec2::Add(const FVec2& p_left, const FVec2& p_right)
+    {
+        return FVec2
+        (
+            p_left.x + p_right.x,
+            p_left.y + p_right.y
+        );
+    }
+
+    constexpr FVec2 FVec2::Substract(const FVec2& p_left, const FVec2& p_right)
+    {
+        return FVec2
+        (
+            p_left.x - p_right.x,
+            p_left.y - p_right.y
+        );
+    }
+
+    constexpr FVec2 FVec2::Multiply(const FVec2& p_target, float p_scalar)
+    {
+        return FVec2
+        (
+            p_target.x * p_scalar,
+            p_target.y * p_scalar
+        );
+    }
+
+    constexpr float FVec2::Dot(const FVec2& p_left, const FVec2& p_right)
+    {
+        return p_left.x * p_right.x + p_left.y * p_right.y;
+    }
+
+    constexpr FVec2 operator*(float p_scalar, const FVec2& p_vec)
+    {
+        return FVec2::Multiply(p_vec, p_scalar);
+    }
+}
+
+#if LIBMATHS_INLINE
+#include "FVec2.inl"
+#endif
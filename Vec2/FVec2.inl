@@ -0,0 +1,271 @@
+#pragma once
+
+/**
+ * Definitions of the FVec2 functions: included by FVec2.hpp when LIBMATHS_INLINE is
+ * set, compiled once by FVec2.cpp otherwise
+*/
+
+#include <utility>
+#include <stdexcept>
+#include <iostream>
+#include <algorithm>
+#include <limits>
+
+#include "../LibMathsConfig.h"
+#include "FVec2.hpp"
+#include "../Utilities.h"
+
+namespace lm
+{
+    LIBMATHS_INLINE_API FVec2 FVec2::operator*(const FVec2 &p_other) const
+    {
+        return FVec2(
+            this->x * p_other.x,
+            this->y * p_other.y
+        );
+    }
+
+    LIBMATHS_INLINE_API FVec2 &FVec2::operator*=(const FVec2 &p_other)
+    {
+        *this = FVec2(
+            this->x * p_other.x,
+            this->y * p_other.y
+        );
+        return *this;
+    }
+
+    LIBMATHS_INLINE_API FVec2 &FVec2::operator/=(const FVec2 &p_other)
+    {
+        *this = FVec2(
+            this->x / p_other.x,
+            this->y / p_other.y
+        );
+        return *this;
+    }
+
+    LIBMATHS_INLINE_API FVec2 FVec2::operator/(const FVec2 &p_other) const
+    {
+        return FVec2(
+            this->x / p_other.x,
+            this->y / p_other.y
+        );
+    }
+
+    LIBMATHS_INLINE_API FVec2 FVec2::operator/(float p_scalar) const
+    {
+        return Divide(*this, p_scalar);
+    }
+
+    LIBMATHS_INLINE_API FVec2& FVec2::operator/=(float p_scalar)
+    {
+        *this = Divide(*this, p_scalar);
+        return *this;
+    }
+
+    LIBMATHS_INLINE_API bool FVec2::operator==(const FVec2& p_other)
+    {
+        return
+            this->x == p_other.x &&
+            this->y == p_other.y;
+    }
+
+    LIBMATHS_INLINE_API bool FVec2::operator!=(const FVec2& p_other)
+    {
+        return !operator==(p_other);
+    }
+
+    LIBMATHS_INLINE_API const float& FVec2::operator[](int p_index) const
+    {
+        switch (p_index)
+        {
+        case 0:	return x;
+        case 1:	return y;
+
+        default:
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    LIBMATHS_INLINE_API float& FVec2::operator[](int p_index)
+    {
+        switch (p_index)
+        {
+        case 0:	return x;
+        case 1:	return y;
+
+        default:
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    LIBMATHS_INLINE_API const float& FVec2::operator()(int p_index) const
+    {
+        switch (p_index)
+        {
+        case 0:	return x;
+        case 1:	return y;
+
+        default:
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    LIBMATHS_INLINE_API float& FVec2::operator()(int p_index)
+    {
+        switch (p_index)
+        {
+        case 0:	return x;
+        case 1:	return y;
+
+        default:
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    LIBMATHS_INLINE_API FVec2 FVec2::Divide(const FVec2& p_left, float p_scalar)
+    {
+        FVec2 result(p_left);
+
+        if (p_scalar == 0)
+            throw std::logic_error("Division by 0");
+
+        result.x /= p_scalar;
+        result.y /= p_scalar;
+
+        return result;
+    }
+
+    LIBMATHS_INLINE_API float FVec2::Length(const FVec2& p_target)
+    {
+        return sqrtf(p_target.x * p_target.x + p_target.y * p_target.y);
+    }
+
+    LIBMATHS_INLINE_API FVec2 FVec2::Normalize(const FVec2& p_target)
+    {
+        float length = Length(p_target);
+
+        if (length > 0.0f)
+        {
+            float targetLength = 1.0f / length;
+
+            return FVec2
+            (
+                p_target.x * targetLength,
+                p_target.y * targetLength
+            );
+        }
+        else
+        {
+            return FVec2::Zero;
+        }
+    }
+
+    LIBMATHS_INLINE_API FVec2 FVec2::Lerp(const FVec2& p_start, const FVec2& p_end, float p_alpha)
+    {
+        return (p_start + (p_end - p_start) * p_alpha);
+    }
+
+    LIBMATHS_INLINE_API float FVec2::AngleBetween(const FVec2& p_from, const FVec2& p_to)
+    {
+        float lengthProduct = Length(p_from) * Length(p_to);
+
+        if (lengthProduct > 0.0f)
+        {
+            float fractionResult = Dot(p_from, p_to) / lengthProduct;
+
+            if (fractionResult >= -1.0f && fractionResult <= 1.0f)
+                return acosf(fractionResult);
+        }
+
+        return 0.0f;
+    }
+
+    LIBMATHS_INLINE_API std::ostream& operator<<(std::ostream& p_stream, const FVec2& p_vec)
+    {
+        p_stream << "Vec2(" << p_vec.x << ", " << p_vec.y << ")";
+        return p_stream;
+    }
+
+    LIBMATHS_INLINE_API std::istream& operator>>(std::istream& p_stream, FVec2& p_vec)
+    {
+        p_stream >> p_vec.x >> p_vec.y;
+        return p_stream;
+    }
+
+    LIBMATHS_INLINE_API FVec2 operator/(float p_scalar, const FVec2& p_vec)
+    {
+        return FVec2::Divide(p_vec, p_scalar);
+    }
+
+    LIBMATHS_INLINE_API FVec2 FVec2::Slerp(const FVec2& p_start, const FVec2& p_end, float p_alpha)
+    {
+        float dot = Dot(p_start, p_end);
+
+        if (dot < 0.0f)
+        {
+            dot = -dot;
+        }
+
+        if (dot > 0.9995f)
+        {
+            return Lerp(p_start, p_end, p_alpha);
+        }
+
+        float theta = acosf(dot);
+        float sinTheta = sinf(theta);
+
+        float startWeight = sinf((1.0f - p_alpha) * theta) / sinTheta;
+        float endWeight = sinf(p_alpha * theta) / sinTheta;
+
+        return (p_start * startWeight) + (p_end * endWeight);
+    }
+
+    LIBMATHS_INLINE_API FVec2 FVec2::Clamp(const FVec2& p_target, const FVec2& p_min, const FVec2& p_max)
+    {
+        return FVec2
+        (
+            clamp(p_target.x, p_min.x, p_max.x),
+            clamp(p_target.y, p_min.y, p_max.y)
+        );
+    }
+
+    LIBMATHS_INLINE_API bool FVec2::IsZero() const
+    {
+        return x == 0.0f && y == 0.0f;
+    }
+
+    LIBMATHS_INLINE_API FVec2 FVec2::Reflect(const FVec2& p_target, const FVec2& p_normal)
+    {
+        return p_target - 2.0f * Dot(p_target, p_normal) * p_normal;
+    }
+
+    LIBMATHS_INLINE_API FVec2 FVec2::Project(const FVec2& p_target, const FVec2& p_normal)
+    {
+        return Dot(p_target, p_normal) * p_normal;
+    }
+
+    LIBMATHS_INLINE_API bool FVec2::IsUnit() const
+    {
+        return std::abs(Length(*this) - 1.0f) <= std::numeric_limits<float>::epsilon() ||
+            std::abs(Length(*this) - 1.0f) <= std::numeric_limits<float>::epsilon() *
+            std::max(std::abs(Length(*this)), std::abs(1.0f));
+    }
+
+    LIBMATHS_INLINE_API FVec2 operator*(const FVec2& p_vec, const FVec2& p_other)
+    {
+        return FVec2
+        (
+            p_vec.x * p_other.x,
+            p_vec.y * p_other.y
+        );
+    }
+
+    LIBMATHS_INLINE_API FVec2 operator/(const FVec2& p_vec, const FVec2& p_other)
+    {
+        return FVec2
+        (
+            p_vec.x / p_other.x,
+            p_vec.y / p_other.y
+        );
+    }
+}
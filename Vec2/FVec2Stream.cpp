@@ -0,0 +1,159 @@
+#include "FVec2Stream.hpp"
+#include "../SIMD/Dispatch.hpp"
+
+#include <stdexcept>
+
+using namespace lm;
+
+static constexpr int s_components = 2;
+
+lm::FVec2Stream::Reference::operator FVec2() const
+{
+    return FVec2(x, y);
+}
+
+FVec2Stream::Reference& lm::FVec2Stream::Reference::operator=(const FVec2& p_value)
+{
+    x = p_value.x;
+    y = p_value.y;
+    return *this;
+}
+
+FVec2Stream::Reference& lm::FVec2Stream::Reference::operator=(const Reference& p_other)
+{
+    return *this = static_cast<FVec2>(p_other);
+}
+
+lm::FVec2Stream::FVec2Stream() : m_lanes(s_components)
+{
+}
+
+lm::FVec2Stream::FVec2Stream(size_t p_size) : m_lanes(s_components)
+{
+    m_lanes.Resize(p_size);
+}
+
+lm::FVec2Stream::FVec2Stream(std::span<const FVec2> p_values) : m_lanes(s_components)
+{
+    Load(p_values);
+}
+
+FVec2Stream::Reference lm::FVec2Stream::operator[](size_t p_index)
+{
+    if (p_index >= Size())
+    {
+        throw std::out_of_range("FVec2Stream: index out of range");
+    }
+
+    return Reference{ X()[p_index], Y()[p_index] };
+}
+
+FVec2 lm::FVec2Stream::operator[](size_t p_index) const
+{
+    if (p_index >= Size())
+    {
+        throw std::out_of_range("FVec2Stream: index out of range");
+    }
+
+    return FVec2(X()[p_index], Y()[p_index]);
+}
+
+size_t lm::FVec2Stream::Size() const
+{
+    return m_lanes.Size();
+}
+
+void lm::FVec2Stream::Resize(size_t p_size)
+{
+    m_lanes.Resize(p_size);
+}
+
+float* lm::FVec2Stream::X() { return m_lanes.Lane(0); }
+float* lm::FVec2Stream::Y() { return m_lanes.Lane(1); }
+const float* lm::FVec2Stream::X() const { return m_lanes.Lane(0); }
+const float* lm::FVec2Stream::Y() const { return m_lanes.Lane(1); }
+
+void lm::FVec2Stream::Load(std::span<const FVec2> p_values)
+{
+    m_lanes.Resize(p_values.size());
+
+    float* const lanes[] = { X(), Y() };
+    simd::Kernels().streamDeinterleave(reinterpret_cast<const float*>(p_values.data()), s_components, lanes, p_values.size());
+}
+
+void lm::FVec2Stream::Store(std::span<FVec2> p_result) const
+{
+    if (p_result.size() != Size())
+    {
+        throw std::logic_error("FVec2Stream::Store: span must have the size of the stream");
+    }
+
+    const float* const lanes[] = { X(), Y() };
+    simd::Kernels().streamInterleave(lanes, s_components, reinterpret_cast<float*>(p_result.data()), p_result.size());
+}
+
+void lm::FVec2Stream::Add(const FVec2Stream& p_left, const FVec2Stream& p_right, FVec2Stream& p_result)
+{
+    if (p_left.Size() != p_right.Size())
+    {
+        throw std::logic_error("FVec2Stream::Add: streams must have the same size");
+    }
+
+    p_result.Resize(p_left.Size());
+
+    for (int lane = 0; lane < s_components; lane++)
+        simd::Kernels().streamAdd(p_left.m_lanes.Lane(lane), p_right.m_lanes.Lane(lane), p_result.m_lanes.Lane(lane), p_result.m_lanes.PaddedSize());
+}
+
+void lm::FVec2Stream::Scale(const FVec2Stream& p_values, float p_scale, FVec2Stream& p_result)
+{
+    p_result.Resize(p_values.Size());
+
+    for (int lane = 0; lane < s_components; lane++)
+        simd::Kernels().streamScale(p_values.m_lanes.Lane(lane), p_scale, p_result.m_lanes.Lane(lane), p_result.m_lanes.PaddedSize());
+}
+
+void lm::FVec2Stream::Dot(const FVec2Stream& p_left, const FVec2Stream& p_right, std::span<float> p_result)
+{
+    if (p_left.Size() != p_right.Size() || p_left.Size() != p_result.size())
+    {
+        throw std::logic_error("FVec2Stream::Dot: streams and result must have the same size");
+    }
+
+    const float* const left[] = { p_left.X(), p_left.Y() };
+    const float* const right[] = { p_right.X(), p_right.Y() };
+    simd::Kernels().streamDot(left, right, s_components, p_result.data(), p_result.size());
+}
+
+void lm::FVec2Stream::Length(const FVec2Stream& p_values, std::span<float> p_result)
+{
+    if (p_values.Size() != p_result.size())
+    {
+        throw std::logic_error("FVec2Stream::Length: stream and result must have the same size");
+    }
+
+    const float* const values[] = { p_values.X(), p_values.Y() };
+    simd::Kernels().streamLength(values, s_components, p_result.data(), p_result.size());
+}
+
+void lm::FVec2Stream::Normalize(const FVec2Stream& p_values, FVec2Stream& p_result)
+{
+    p_result.Resize(p_values.Size());
+
+    const float* const values[] = { p_values.X(), p_values.Y() };
+    float* const result[] = { p_result.X(), p_result.Y() };
+    simd::Kernels().streamNormalize(values, s_components, result, p_result.m_lanes.PaddedSize());
+}
+
+void lm::FVec2Stream::Lerp(const FVec2Stream& p_start, const FVec2Stream& p_end, float p_alpha, FVec2Stream& p_result)
+{
+    if (p_start.Size() != p_end.Size())
+    {
+        throw std::logic_error("FVec2Stream::Lerp: streams must have the same size");
+    }
+
+    p_result.Resize(p_start.Size());
+
+    for (int lane = 0; lane < s_components; lane++)
+        simd::Kernels().streamLerp(p_start.m_lanes.Lane(lane), p_end.m_lanes.Lane(lane), p_alpha, p_result.m_lanes.Lane(lane), p_result.m_lanes.PaddedSize());
+}
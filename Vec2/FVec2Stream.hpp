@@ -0,0 +1,128 @@
+#pragma once
+
+#include <span>
+
+#include "FVec2.hpp"
+#include "../SIMD/LaneBuffer.hpp"
+
+namespace lm
+{
+    /**
+     * Structure of arrays storage of FVec2: the x and y components live in 2 aligned arrays
+     * @note The operations run VFloat::Width elements at a time on the batch kernels
+    */
+    struct FVec2Stream
+    {
+        /**
+         * Proxy to one element, reads and writes go to the component arrays
+        */
+        struct Reference
+        {
+            float& x;
+            float& y;
+
+            operator FVec2() const;
+            Reference& operator=(const FVec2& p_value);
+            Reference& operator=(const Reference& p_other);
+        };
+
+        /**
+         * @brief Creates an empty stream
+        */
+        FVec2Stream();
+
+        /**
+         * @brief Creates a stream of p_size zero vectors
+         * @param p_size The number of elements
+        */
+        explicit FVec2Stream(size_t p_size);
+
+        /**
+         * @brief Creates a stream from an array of vectors
+         * @param p_values The vectors to copy
+        */
+        explicit FVec2Stream(std::span<const FVec2> p_values);
+
+        Reference operator[](size_t p_index);
+        FVec2 operator[](size_t p_index) const;
+
+        /**
+         * @brief Returns the number of elements
+        */
+        size_t Size() const;
+
+        /**
+         * @brief Changes the number of elements, new elements are zero vectors
+         * @param p_size The number of elements
+        */
+        void Resize(size_t p_size);
+
+        float* X();
+        float* Y();
+        const float* X() const;
+        const float* Y() const;
+
+        /**
+         * @brief Replaces the elements with an array of vectors
+         * @param p_values The vectors to copy
+        */
+        void Load(std::span<const FVec2> p_values);
+
+        /**
+         * @brief Copies the elements to an array of vectors
+         * @param p_result Receives the vectors, must have the size of the stream
+        */
+        void Store(std::span<FVec2> p_result) const;
+
+        /**
+         * @brief Adds two streams element-wise
+         * @param p_left The first stream
+         * @param p_right The second stream, must have the size of p_left
+         * @param p_result Receives the sums, resized to p_left and allowed to be either operand
+        */
+        static void Add(const FVec2Stream& p_left, const FVec2Stream& p_right, FVec2Stream& p_result);
+
+        /**
+         * @brief Multiplies every element by a scalar
+         * @param p_values The stream to scale
+         * @param p_scale The scalar
+         * @param p_result Receives the scaled vectors, may be p_values
+        */
+        static void Scale(const FVec2Stream& p_values, float p_scale, FVec2Stream& p_result);
+
+        /**
+         * @brief Computes the dot product of each pair of elements
+         * @param p_left The first stream
+         * @param p_right The second stream, must have the size of p_left
+         * @param p_result Receives the dot products, must have the size of p_left
+        */
+        static void Dot(const FVec2Stream& p_left, const FVec2Stream& p_right, std::span<float> p_result);
+
+
+        /**
+         * @brief Computes the length of each element
+         * @param p_values The stream
+         * @param p_result Receives the lengths, must have the size of p_values
+        */
+        static void Length(const FVec2Stream& p_values, std::span<float> p_result);
+
+        /**
+         * @brief Normalizes each element, zero vectors stay zero
+         * @param p_values The stream
+         * @param p_result Receives the unit vectors, may be p_values
+        */
+        static void Normalize(const FVec2Stream& p_values, FVec2Stream& p_result);
+
+        /**
+         * @brief Interpolates each pair of elements
+         * @param p_start The stream at p_alpha = 0
+         * @param p_end The stream at p_alpha = 1, must have the size of p_start
+         * @param p_alpha The interpolation factor
+         * @param p_result Receives the interpolated vectors, may be either operand
+        */
+        static void Lerp(const FVec2Stream& p_start, const FVec2Stream& p_end, float p_alpha, FVec2Stream& p_result);
+
+    private:
+        simd::FLaneBuffer m_lanes;
+    };
+}
@@ -11,52 +11,15 @@
 
 using namespace lm;
 
-const DVec3 DVec3::One(1.0, 1.0, 1.0);
-const DVec3 DVec3::Zero(0.0, 0.0, 0.0);
-const DVec3 DVec3::Forward(0.0, 0.0, 1.0);
-const DVec3 DVec3::Right(1.0, 0.0, 0.0);
-const DVec3 DVec3::Up(0.0, 1.0, 0.0);
-
-DVec3::DVec3() : x(0.0), y(0.0), z(0.0)
-{
-}
-
-DVec3::DVec3(double p_x, double p_y, double p_z)
-{
-    this->x = p_x;
-    this->y = p_y;
-    this->z = p_z;
-}
-
 DVec3::DVec3(const struct FVec4& p_toCopy) : x(p_toCopy.x), y(p_toCopy.y), z(p_toCopy.z)
 {
 }
 
-DVec3::DVec3(const DVec3& p_toCopy) : x(p_toCopy.x), y(p_toCopy.y), z(p_toCopy.z)
-{
-}
-
-DVec3::DVec3(double p_init)
-{
-    this->x = p_init;
-    this->y = p_init;
-    this->z = p_init;
-}
-
 DVec3 DVec3::operator-() const
 {
     return operator*(-1);
 }
 
-DVec3 DVec3::operator=(const DVec3& p_other)
-{
-    this->x = p_other.x;
-    this->y = p_other.y;
-    this->z = p_other.z;
-
-    return *this;
-}
-
 DVec3 DVec3::operator+(const DVec3& p_other) const
 {
     return Add(*this, p_other);
@@ -16,7 +16,7 @@ namespace lm
         double y;
         double z;
 
-        DVec3();
+        constexpr DVec3();
 
         /**
         * Default constructor
@@ -24,16 +24,16 @@ namespace lm
         * @param p_y
         * @param p_z
         */
-        DVec3(double p_x, double p_y, double p_z);
+        constexpr DVec3(double p_x, double p_y, double p_z);
 
-        DVec3(double p_init);
+        constexpr DVec3(double p_init);
 
         DVec3(const struct FVec4& p_toCopy);
         /**
         * Copy constructor
         * @param p_toCopy
         */
-        DVec3(const DVec3& p_toCopy);
+        constexpr DVec3(const DVec3& p_toCopy) = default;
 
         /**
         * Move constructor
@@ -50,7 +50,7 @@ namespace lm
         * Copy assignment
         * @param p_other
         */
-        DVec3 operator=(const DVec3& p_other);
+        constexpr DVec3& operator=(const DVec3& p_other) = default;
 
         /**
         * Calculate the sum of two vectors
@@ -294,4 +294,25 @@ namespace lm
     bool operator==(const DVec3& p_left, const DVec3& p_right);
 
     bool operator!=(const DVec3& p_left, const DVec3& p_right);
-}
\ No newline at end of file
+}
+
+namespace lm
+{
+    constexpr DVec3::DVec3() : x(0.0), y(0.0), z(0.0)
+    {
+    }
+
+    constexpr DVec3::DVec3(double p_x, double p_y, double p_z) : x(p_x), y(p_y), z(p_z)
+    {
+    }
+
+    constexpr DVec3::DVec3(double p_init) : x(p_init), y(p_init), z(p_init)
+    {
+    }
+
+    inline constexpr DVec3 DVec3::One(1.0, 1.0, 1.0);
+    inline constexpr DVec3 DVec3::Zero(0.0, 0.0, 0.0);
+    inline constexpr DVec3 DVec3::Forward(0.0, 0.0, 1.0);
+    inline constexpr DVec3 DVec3::Right(1.0, 0.0, 0.0);
+    inline constexpr DVec3 DVec3::Up(0.0, 1.0, 0.0);
+}
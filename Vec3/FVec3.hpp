@@ -2,6 +2,8 @@
 
 #include <iostream>
 
+#include "../LibMathsConfig.h"
+
 namespace lm
 {
     struct FVec3
@@ -16,7 +18,7 @@ namespace lm
         float y;
         float z;
 
-        FVec3();
+        constexpr FVec3();
 
         /**
         * Default constructor
@@ -24,16 +26,16 @@ namespace lm
         * @param p_y
         * @param p_z
         */
-        FVec3(float p_x, float p_y, float p_z);
+        constexpr FVec3(float p_x, float p_y, float p_z) : x(p_x), y(p_y), z(p_z) {}
 
-        FVec3(float p_init);
+        constexpr FVec3(float p_init);
 
         FVec3(const struct FVec4& p_toCopy);
         /**
         * Copy constructor
         * @param p_toCopy
         */
-        FVec3(const FVec3& p_toCopy);
+        constexpr FVec3(const FVec3& p_toCopy) = default;
 
         /**
         * Move constructor
@@ -44,37 +46,37 @@ namespace lm
         /**
         * Negation
         */
-        FVec3 operator-() const;
+        constexpr FVec3 operator-() const;
 
         /**
         * Copy assignment
         * @param p_other
         */
-        FVec3 operator=(const FVec3& p_other);
+        constexpr FVec3& operator=(const FVec3& p_other) = default;
 
         /**
         * Calculate the sum of two vectors
         * @param p_other
         */
-        FVec3 operator+(const FVec3& p_other) const;
+        constexpr FVec3 operator+(const FVec3& p_other) const;
 
         /**
         * Add the right vector to the left one
         * @param p_other
         */
-        FVec3& operator+=(const FVec3& p_other);
+        constexpr FVec3& operator+=(const FVec3& p_other);
 
         /**
         * Calculate the substraction of two vectors
         * @param p_other
         */
-        FVec3 operator-(const FVec3& p_other) const;
+        constexpr FVec3 operator-(const FVec3& p_other) const;
 
         /**
         * Remove the right vector from the left one
         * @param p_other
         */
-        FVec3& operator-=(const FVec3& p_other);
+        constexpr FVec3& operator-=(const FVec3& p_other);
 
         /**
         * Calculate the division of two vectors
@@ -88,13 +90,13 @@ namespace lm
         * Calcualte the multiplication of a vector with a scalar
         * @param p_scalar
         */
-        FVec3 operator*(float p_scalar) const;
+        constexpr FVec3 operator*(float p_scalar) const;
 
         /**
         * Multiply the vector by a scalar
         * @param p_scalar
         */
-        FVec3& operator*=(float p_scalar);
+        constexpr FVec3& operator*=(float p_scalar);
 
         /**
         * Return the division of scalar and actual vector
@@ -149,21 +151,21 @@ namespace lm
         * @param p_left (First vector)
         * @param p_right (Second vector)
         */
-        static FVec3 Add(const FVec3& p_left, const FVec3& p_right);
+        static constexpr FVec3 Add(const FVec3& p_left, const FVec3& p_right);
 
         /**
         * Calculate the substraction of two vectors
         * @param p_left (First vector)
         * @param p_right (Second vector)
         */
-        static FVec3 Substract(const FVec3& p_left, const FVec3& p_right);
+        static constexpr FVec3 Substract(const FVec3& p_left, const FVec3& p_right);
 
         /**
         * Calculate the multiplication of a vector with a scalar
         * @param p_target
         * @param p_scalar
         */
-        static FVec3 Multiply(const FVec3& p_target, float p_scalar);
+        static constexpr FVec3 Multiply(const FVec3& p_target, float p_scalar);
 
         /**
         * Divide scalar to vector left
@@ -182,14 +184,14 @@ namespace lm
         * Return the length of a vector squared
         * @param p_target
         */
-        static float Length2(const FVec3& p_target);
+        static constexpr float Length2(const FVec3& p_target);
 
         /**
         * Return the dot product of two vectors
         * @param p_left
         * @param p_right
         */
-        static float Dot(const FVec3& p_left, const FVec3& p_right);
+        static constexpr float Dot(const FVec3& p_left, const FVec3& p_right);
 
         /**
         * Return the distance between two vectors
@@ -203,7 +205,7 @@ namespace lm
         * @param p_left
         * @param p_right
         */
-        static FVec3 Cross(const FVec3& p_left, const FVec3& p_right);
+        static constexpr FVec3 Cross(const FVec3& p_left, const FVec3& p_right);
 
         /**
         * Return the normalize of the given vector
@@ -281,7 +283,7 @@ namespace lm
     */
     std::istream& operator>>(std::istream& p_stream, FVec3& p_vec);
 
-    FVec3 operator*(float p_scalar, const FVec3& p_vec);
+    constexpr FVec3 operator*(float p_scalar, const FVec3& p_vec);
 
     FVec3 operator*(const FVec3& p_vec, const FVec3& p_vec2);
 
@@ -294,4 +296,126 @@ namespace lm
     bool operator==(const FVec3& p_left, const FVec3& p_right);
 
     bool operator!=(const FVec3& p_left, const FVec3& p_right);
-}
\ No newline at end of file
+}
+
+namespace lm
+{
+    inline constexpr FVec3 FVec3::One(1.0f, 1.0f, 1.0f);
+    inline constexpr FVec3 FVec3::Zero(0.0f, 0.0f, 0.0f);
+    inline constexpr FVec3 FVec3::Forward(0.0f, 0.0f, 1.0f);
+    inline constexpr FVec3 FVec3::Right(1.0f, 0.0f, 0.0f);
+    inline constexpr FVec3 FVec3::Up(0.0f, 1.0f, 0.0f);
+
+    constexpr FVec3::FVec3() : x(0.0f), y(0.0f), z(0.0f)
+    {
+    }
+
+    constexpr FVec3::FVec3(float p_init)
+    {
+        this->x = p_init;
+        this->y = p_init;
+        this->z = p_init;
+    }
+
+    constexpr FVec3 FVec3::operator-() const
+    {
+        return operator*(-1);
+    }
+
+    constexpr FVec3 FVec3::operator+(const FVec3& p_other) const
+    {
+        return Add(*this, p_other);
+    }
+
+    constexpr FVec3& FVec3::operator+=(const FVec3& p_other)
+    {
+        *this = Add(*this, p_other);
+        return *this;
+    }
+
+    constexpr FVec3 FVec3::operator-(const FVec3& p_other) const
+    {
+        return Substract(*this, p_other);
+    }
+
+    constexpr FVec3& FVec3::operator-=(const FVec3& p_other)
+    {
+        *this = Substract(*this, p_other);
+        return *this;
+    }
+
+    constexpr FVec3 FVec3::operator*(float p_scalar) const
+    {
+        return Multiply(*this, p_scalar);
+    }
+
+    constexpr FVec3& FVec3::operator*=(float p_scalar)
+    {
+        *this = Multiply(*this, p_scalar);
+        return *this;
+    }
+
+    constexpr FVec3 FVec3::Add(const FVec3& p_left, const FVec3& p_right)
+    {
+        return FVec3
+        (
+            p_left.x + p_right.x,
+            p_left.y + p_right.y,
+            p_left.z + p_right.z
+        );
+    }
+
+    constexpr FVec3 FVec3::Substract(const FVec3& p_left, const FVec3& p_right)
+    {
+        return FVec3
+        (
+            p_left.x - p_right.x,
+            p_left.y - p_right.y,
+            p_left.z - p_right.z
+        );
+    }
+
+    constexpr FVec3 FVec3::Multiply(const FVec3& p_target, float p_scalar)
+    {
+        return FVec3
+        (
+            p_target.x * p_scalar,
+            p_target.y * p_scalar,
+            p_target.z * p_scalar
+        );
+    }
+
+    constexpr float FVec3::Dot(const FVec3& p_left, const FVec3& p_right)
+    {
+        return p_left.x * p_right.x + p_left.y * p_right.y + p_left.z * p_right.z;
+    }
+
+    constexpr FVec3 operator*(float p_scalar, const FVec3& p_target)
+    {
+        return FVec3
+        (
+            p_target.x * p_scalar,
+            p_target.y * p_scalar,
+            p_target.z * p_scalar
+        );
+    }
+
+    constexpr FVec3 FVec3::Cross(const FVec3& p_left, const FVec3& p_right)
+    {
+        return FVec3
+        (
+            p_left.y * p_right.z - p_left.z * p_right.y,
+            p_left.z * p_right.x - p_left.x * p_right.z,
+            p_left.x * p_right.y - p_left.y * p_right.x
+        );
+    }
+
+    constexpr float FVec3::Length2(const FVec3& p_target)
+    {
+        return p_target.x * p_target.x + p_target.y * p_target.y + p_target.z * p_target.z;
+    }
+}
+
+#if LIBMATHS_INLINE
+#include "FVec3.inl"
+#endif
@@ -0,0 +1,298 @@
+#pragma once
+
+/**
+ * Definitions of the FVec3 functions: included by FVec3.hpp when LIBMATHS_INLINE is
+ * set, compiled once by FVec3.cpp otherwise
+*/
+
+#include <utility>
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+#include "../LibMathsConfig.h"
+#include "FVec3.hpp"
+#include "../Utilities.h"
+#include "../Vec4/FVec4.hpp"
+
+namespace lm
+{
+    LIBMATHS_INLINE_API FVec3::FVec3(const struct FVec4& p_toCopy) : x(p_toCopy.x), y(p_toCopy.y), z(p_toCopy.z)
+    {
+    }
+
+    LIBMATHS_INLINE_API FVec3& FVec3::operator/(const FVec3& p_other)
+    {
+        FVec3 result = *this;
+        result.x /= p_other.x;
+        result.y /= p_other.y;
+        result.z /= p_other.z;
+        *this = result;
+        return *this;
+    }
+
+    LIBMATHS_INLINE_API FVec3 FVec3::operator/(const FVec3& p_other) const
+    {
+        FVec3 result = *this;
+        result.x /= p_other.x;
+        result.y /= p_other.y;
+        result.z /= p_other.z;
+
+        return result;
+    }
+
+    LIBMATHS_INLINE_API FVec3 FVec3::operator/(float p_scalar) const
+    {
+        return Divide(*this, p_scalar);
+    }
+
+    LIBMATHS_INLINE_API FVec3& FVec3::operator/=(float p_scalar)
+    {
+        *this = Divide(*this, p_scalar);
+        return *this;
+    }
+
+    LIBMATHS_INLINE_API bool FVec3::operator==(const FVec3& p_other)
+    {
+        return
+            this->x == p_other.x &&
+            this->y == p_other.y &&
+            this->z == p_other.z;
+    }
+
+    LIBMATHS_INLINE_API bool FVec3::operator!=(const FVec3& p_other)
+    {
+        return !operator==(p_other);
+    }
+
+    LIBMATHS_INLINE_API const float& FVec3::operator[](int p_index) const
+    {
+        switch (p_index)
+        {
+        case 0: return x;
+        case 1: return y;
+        case 2: return z;
+        default: throw std::out_of_range("Index out of range");
+        }
+    }
+
+    LIBMATHS_INLINE_API float& FVec3::operator[](int p_index)
+    {
+        switch (p_index)
+        {
+        case 0: return x;
+        case 1: return y;
+        case 2: return z;
+        default: throw std::out_of_range("Index out of range");
+        }
+    }
+
+    LIBMATHS_INLINE_API const float& FVec3::operator()(int p_index) const
+    {
+        switch (p_index)
+        {
+        case 0: return x;
+        case 1: return y;
+        case 2: return z;
+        default: throw std::out_of_range("Index out of range");
+        }
+    }
+
+    LIBMATHS_INLINE_API float& FVec3::operator()(int p_index)
+    {
+        switch (p_index)
+        {
+        case 0: return x;
+        case 1: return y;
+        case 2: return z;
+        default: throw std::out_of_range("Index out of range");
+        }
+    }
+
+    LIBMATHS_INLINE_API FVec3 FVec3::Divide(const FVec3& p_left, float p_scalar)
+    {
+        FVec3 result(p_left);
+
+        if (p_scalar == 0)
+            throw std::logic_error("Division by 0");
+
+        result.x /= p_scalar;
+        result.y /= p_scalar;
+        result.z /= p_scalar;
+
+        return result;
+    }
+
+    LIBMATHS_INLINE_API float FVec3::Length(const FVec3& p_target)
+    {
+        return std::sqrt(p_target.x * p_target.x + p_target.y * p_target.y + p_target.z * p_target.z);
+    }
+
+    LIBMATHS_INLINE_API float FVec3::Distance(const FVec3& p_left, const FVec3& p_right)
+    {
+        return std::sqrt
+        (
+            (p_left.x - p_right.x) * (p_left.x - p_right.x) +
+            (p_left.y - p_right.y) * (p_left.y - p_right.y) +
+            (p_left.z - p_right.z) * (p_left.z - p_right.z)
+        );
+    }
+
+    LIBMATHS_INLINE_API FVec3 FVec3::Normalize(const FVec3& p_target)
+    {
+        float length = Length(p_target);
+
+        if (length > 0.0f)
+        {
+            float targetLength = 1.0f / length;
+
+            return FVec3
+            (
+                p_target.x * targetLength,
+                p_target.y * targetLength,
+                p_target.z * targetLength
+            );
+        }
+        else
+        {
+            return FVec3::Zero;
+        }
+    }
+
+    LIBMATHS_INLINE_API FVec3 FVec3::Lerp(const FVec3& p_start, const FVec3& p_end, float p_alpha)
+    {
+        return (p_start + (p_end - p_start) * p_alpha);
+    }
+
+    LIBMATHS_INLINE_API float FVec3::AngleBetween(const FVec3& p_from, const FVec3& p_to)
+    {
+        auto vec1 = Normalize(p_from);
+        auto vec2 = Normalize(p_to);
+        float dot = Dot(vec1, vec2);
+        float lenSq1 = Length2(vec1);
+        float lenSq2 = Length2(vec2);
+        return std::acos(dot / std::sqrt(lenSq1 * lenSq2));
+    }
+
+    LIBMATHS_INLINE_API FVec3 FVec3::Project(const FVec3& p_target, const FVec3& p_onNormal)
+    {
+        float aDotb = Dot(p_target, p_onNormal);
+
+        float bDotB = Dot(p_onNormal, p_onNormal);
+
+        if (bDotB == 0.0f)
+        {
+            return FVec3::Zero;
+        }
+
+        return (aDotb / bDotB) * p_onNormal;
+    }
+
+    LIBMATHS_INLINE_API FVec3 FVec3::Reflect(const FVec3& p_target, const FVec3& p_normal)
+    {
+        return p_target - p_normal * 2.0f * Dot(p_target, p_normal);
+    }
+
+    LIBMATHS_INLINE_API FVec3 FVec3::Refract(const FVec3& p_target, const FVec3& p_normal, float p_eta)
+    {
+        float dot = Dot(p_target, p_normal);
+        float k = 1.0f - p_eta * p_eta * (1.0f - dot * dot);
+
+        if (k < 0.0f)
+            return FVec3::Zero;
+
+        return p_target * p_eta - p_normal * (p_eta * dot + sqrtf(k));
+    }
+
+    LIBMATHS_INLINE_API FVec3 FVec3::Clamp(const FVec3& p_target, const FVec3& p_min, const FVec3& p_max)
+    {
+        return FVec3
+        (
+            clamp(p_target.x, p_min.x, p_max.x),
+            clamp(p_target.y, p_min.y, p_max.y),
+            clamp(p_target.z, p_min.z, p_max.z)
+        );
+    }
+
+    LIBMATHS_INLINE_API bool FVec3::IsUnit() const
+    {
+        return std::abs(Length(*this) - 1.0f) <= std::numeric_limits<float>::epsilon() ||
+            std::abs(Length(*this) - 1.0f) <= std::numeric_limits<float>::epsilon() *
+            std::max(std::abs(Length(*this)), std::abs(1.0f));
+    }
+
+    LIBMATHS_INLINE_API bool FVec3::IsZero() const
+    {
+        return x == 0.0f && y == 0.0f && z == 0.0f;
+    }
+
+    LIBMATHS_INLINE_API std::ostream& operator<<(std::ostream& p_stream, const FVec3& p_target)
+    {
+        p_stream << "FVec3(" << p_target.x << ", " << p_target.y << ", " << p_target.z << ")";
+
+        return p_stream;
+    }
+
+    LIBMATHS_INLINE_API std::istream& operator>>(std::istream& p_stream, FVec3& p_target)
+    {
+        char c;
+        p_stream >> c;
+        p_stream >> p_target.x;
+        p_stream >> c;
+        p_stream >> p_target.y;
+        p_stream >> c;
+        p_stream >> p_target.z;
+        p_stream >> c;
+
+        return p_stream;
+    }
+
+    LIBMATHS_INLINE_API FVec3 operator/(float p_scalar, const FVec3& p_target)
+    {
+        return FVec3
+        (
+            p_target.x / p_scalar,
+            p_target.y / p_scalar,
+            p_target.z / p_scalar
+        );
+    }
+
+    LIBMATHS_INLINE_API FVec3 operator*(const FVec3& p_vec, const FVec3& p_vec2)
+    {
+        return FVec3
+        (
+            p_vec.x * p_vec2.x,
+            p_vec.y * p_vec2.y,
+            p_vec.z * p_vec2.z
+        );
+    }
+
+    LIBMATHS_INLINE_API FVec3 operator/= (FVec3& p_left, const FVec3& p_right)
+    {
+        p_left.x /= p_right.x;
+        p_left.y /= p_right.y;
+        p_left.z /= p_right.z;
+
+        return p_left;
+    }
+
+    LIBMATHS_INLINE_API FVec3 operator*= (FVec3& p_left, const FVec3& p_right)
+    {
+        p_left.x *= p_right.x;
+        p_left.y *= p_right.y;
+        p_left.z *= p_right.z;
+
+        return p_left;
+    }
+
+    LIBMATHS_INLINE_API bool operator==(const FVec3& p_left, const  FVec3& p_right)
+    {
+        return p_left.x == p_right.x && p_left.y == p_right.y && p_left.z == p_right.z;
+    }
+
+    LIBMATHS_INLINE_API bool operator!=(const FVec3& p_left, const  FVec3& p_right)
+    {
+        return p_left.x != p_right.x || p_left.y != p_right.y || p_left.z != p_right.z;
+    }
+}
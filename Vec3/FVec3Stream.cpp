@@ -0,0 +1,177 @@
+#include "FVec3Stream.hpp"
+#include "../SIMD/Dispatch.hpp"
+
+#include <stdexcept>
+
+using namespace lm;
+
+static constexpr int s_components = 3;
+
+lm::FVec3Stream::Reference::operator FVec3() const
+{
+    return FVec3(x, y, z);
+}
+
+FVec3Stream::Reference& lm::FVec3Stream::Reference::operator=(const FVec3& p_value)
+{
+    x = p_value.x;
+    y = p_value.y;
+    z = p_value.z;
+    return *this;
+}
+
+FVec3Stream::Reference& lm::FVec3Stream::Reference::operator=(const Reference& p_other)
+{
+    return *this = static_cast<FVec3>(p_other);
+}
+
+lm::FVec3Stream::FVec3Stream() : m_lanes(s_components)
+{
+}
+
+lm::FVec3Stream::FVec3Stream(size_t p_size) : m_lanes(s_components)
+{
+    m_lanes.Resize(p_size);
+}
+
+lm::FVec3Stream::FVec3Stream(std::span<const FVec3> p_values) : m_lanes(s_components)
+{
+    Load(p_values);
+}
+
+FVec3Stream::Reference lm::FVec3Stream::operator[](size_t p_index)
+{
+    if (p_index >= Size())
+    {
+        throw std::out_of_range("FVec3Stream: index out of range");
+    }
+
+    return Reference{ X()[p_index], Y()[p_index], Z()[p_index] };
+}
+
+FVec3 lm::FVec3Stream::operator[](size_t p_index) const
+{
+    if (p_index >= Size())
+    {
+        throw std::out_of_range("FVec3Stream: index out of range");
+    }
+
+    return FVec3(X()[p_index], Y()[p_index], Z()[p_index]);
+}
+
+size_t lm::FVec3Stream::Size() const
+{
+    return m_lanes.Size();
+}
+
+void lm::FVec3Stream::Resize(size_t p_size)
+{
+    m_lanes.Resize(p_size);
+}
+
+float* lm::FVec3Stream::X() { return m_lanes.Lane(0); }
+float* lm::FVec3Stream::Y() { return m_lanes.Lane(1); }
+float* lm::FVec3Stream::Z() { return m_lanes.Lane(2); }
+const float* lm::FVec3Stream::X() const { return m_lanes.Lane(0); }
+const float* lm::FVec3Stream::Y() const { return m_lanes.Lane(1); }
+const float* lm::FVec3Stream::Z() const { return m_lanes.Lane(2); }
+
+void lm::FVec3Stream::Load(std::span<const FVec3> p_values)
+{
+    m_lanes.Resize(p_values.size());
+
+    float* const lanes[] = { X(), Y(), Z() };
+    simd::Kernels().streamDeinterleave(reinterpret_cast<const float*>(p_values.data()), s_components, lanes, p_values.size());
+}
+
+void lm::FVec3Stream::Store(std::span<FVec3> p_result) const
+{
+    if (p_result.size() != Size())
+    {
+        throw std::logic_error("FVec3Stream::Store: span must have the size of the stream");
+    }
+
+    const float* const lanes[] = { X(), Y(), Z() };
+    simd::Kernels().streamInterleave(lanes, s_components, reinterpret_cast<float*>(p_result.data()), p_result.size());
+}
+
+void lm::FVec3Stream::Add(const FVec3Stream& p_left, const FVec3Stream& p_right, FVec3Stream& p_result)
+{
+    if (p_left.Size() != p_right.Size())
+    {
+        throw std::logic_error("FVec3Stream::Add: streams must have the same size");
+    }
+
+    p_result.Resize(p_left.Size());
+
+    for (int lane = 0; lane < s_components; lane++)
+        simd::Kernels().streamAdd(p_left.m_lanes.Lane(lane), p_right.m_lanes.Lane(lane), p_result.m_lanes.Lane(lane), p_result.m_lanes.PaddedSize());
+}
+
+void lm::FVec3Stream::Scale(const FVec3Stream& p_values, float p_scale, FVec3Stream& p_result)
+{
+    p_result.Resize(p_values.Size());
+
+    for (int lane = 0; lane < s_components; lane++)
+        simd::Kernels().streamScale(p_values.m_lanes.Lane(lane), p_scale, p_result.m_lanes.Lane(lane), p_result.m_lanes.PaddedSize());
+}
+
+void lm::FVec3Stream::Dot(const FVec3Stream& p_left, const FVec3Stream& p_right, std::span<float> p_result)
+{
+    if (p_left.Size() != p_right.Size() || p_left.Size() != p_result.size())
+    {
+        throw std::logic_error("FVec3Stream::Dot: streams and result must have the same size");
+    }
+
+    const float* const left[] = { p_left.X(), p_left.Y(), p_left.Z() };
+    const float* const right[] = { p_right.X(), p_right.Y(), p_right.Z() };
+    simd::Kernels().streamDot(left, right, s_components, p_result.data(), p_result.size());
+}
+
+void lm::FVec3Stream::Cross(const FVec3Stream& p_left, const FVec3Stream& p_right, FVec3Stream& p_result)
+{
+    if (p_left.Size() != p_right.Size())
+    {
+        throw std::logic_error("FVec3Stream::Cross: streams must have the same size");
+    }
+
+    p_result.Resize(p_left.Size());
+
+    const float* const left[] = { p_left.X(), p_left.Y(), p_left.Z() };
+    const float* const right[] = { p_right.X(), p_right.Y(), p_right.Z() };
+    float* const result[] = { p_result.X(), p_result.Y(), p_result.Z() };
+    simd::Kernels().streamCross(left, right, result, p_result.m_lanes.PaddedSize());
+}
+
+void lm::FVec3Stream::Length(const FVec3Stream& p_values, std::span<float> p_result)
+{
+    if (p_values.Size() != p_result.size())
+    {
+        throw std::logic_error("FVec3Stream::Length: stream and result must have the same size");
+    }
+
+    const float* const values[] = { p_values.X(), p_values.Y(), p_values.Z() };
+    simd::Kernels().streamLength(values, s_components, p_result.data(), p_result.size());
+}
+
+void lm::FVec3Stream::Normalize(const FVec3Stream& p_values, FVec3Stream& p_result)
+{
+    p_result.Resize(p_values.Size());
+
+    const float* const values[] = { p_values.X(), p_values.Y(), p_values.Z() };
+    float* const result[] = { p_result.X(), p_result.Y(), p_result.Z() };
+    simd::Kernels().streamNormalize(values, s_components, result, p_result.m_lanes.PaddedSize());
+}
+
+void lm::FVec3Stream::Lerp(const FVec3Stream& p_start, const FVec3Stream& p_end, float p_alpha, FVec3Stream& p_result)
+{
+    if (p_start.Size() != p_end.Size())
+    {
+        throw std::logic_error("FVec3Stream::Lerp: streams must have the same size");
+    }
+
+    p_result.Resize(p_start.Size());
+
+    for (int lane = 0; lane < s_components; lane++)
+        simd::Kernels().streamLerp(p_start.m_lanes.Lane(lane), p_end.m_lanes.Lane(lane), p_alpha, p_result.m_lanes.Lane(lane), p_result.m_lanes.PaddedSize());
+}
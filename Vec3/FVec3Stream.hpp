@@ -0,0 +1,138 @@
+#pragma once
+
+#include <span>
+
+#include "FVec3.hpp"
+#include "../SIMD/LaneBuffer.hpp"
+
+namespace lm
+{
+    /**
+     * Structure of arrays storage of FVec3: the x, y and z components live in 3 aligned arrays
+     * @note The operations run VFloat::Width elements at a time on the batch kernels
+    */
+    struct FVec3Stream
+    {
+        /**
+         * Proxy to one element, reads and writes go to the component arrays
+        */
+        struct Reference
+        {
+            float& x;
+            float& y;
+            float& z;
+
+            operator FVec3() const;
+            Reference& operator=(const FVec3& p_value);
+            Reference& operator=(const Reference& p_other);
+        };
+
+        /**
+         * @brief Creates an empty stream
+        */
+        FVec3Stream();
+
+        /**
+         * @brief Creates a stream of p_size zero vectors
+         * @param p_size The number of elements
+        */
+        explicit FVec3Stream(size_t p_size);
+
+        /**
+         * @brief Creates a stream from an array of vectors
+         * @param p_values The vectors to copy
+        */
+        explicit FVec3Stream(std::span<const FVec3> p_values);
+
+        Reference operator[](size_t p_index);
+        FVec3 operator[](size_t p_index) const;
+
+        /**
+         * @brief Returns the number of elements
+        */
+        size_t Size() const;
+
+        /**
+         * @brief Changes the number of elements, new elements are zero vectors
+         * @param p_size The number of elements
+        */
+        void Resize(size_t p_size);
+
+        float* X();
+        float* Y();
+        float* Z();
+        const float* X() const;
+        const float* Y() const;
+        const float* Z() const;
+
+        /**
+         * @brief Replaces the elements with an array of vectors
+         * @param p_values The vectors to copy
+        */
+        void Load(std::span<const FVec3> p_values);
+
+        /**
+         * @brief Copies the elements to an array of vectors
+         * @param p_result Receives the vectors, must have the size of the stream
+        */
+        void Store(std::span<FVec3> p_result) const;
+
+        /**
+         * @brief Adds two streams element-wise
+         * @param p_left The first stream
+         * @param p_right The second stream, must have the size of p_left
+         * @param p_result Receives the sums, resized to p_left and allowed to be either operand
+        */
+        static void Add(const FVec3Stream& p_left, const FVec3Stream& p_right, FVec3Stream& p_result);
+
+        /**
+         * @brief Multiplies every element by a scalar
+         * @param p_values The stream to scale
+         * @param p_scale The scalar
+         * @param p_result Receives the scaled vectors, may be p_values
+        */
+        static void Scale(const FVec3Stream& p_values, float p_scale, FVec3Stream& p_result);
+
+        /**
+         * @brief Computes the dot product of each pair of elements
+         * @param p_left The first stream
+         * @param p_right The second stream, must have the size of p_left
+         * @param p_result Receives the dot products, must have the size of p_left
+        */
+        static void Dot(const FVec3Stream& p_left, const FVec3Stream& p_right, std::span<float> p_result);
+
+        /**
+         * @brief Computes the cross product of each pair of elements
+         * @param p_left The first stream
+         * @param p_right The second stream, must have the size of p_left
+         * @param p_result Receives the cross products, may be either operand
+        */
+        static void Cross(const FVec3Stream& p_left, const FVec3Stream& p_right, FVec3Stream& p_result);
+
+        /**
+         * @brief Computes the length of each element
+         * @param p_values The stream
+         * @param p_result Receives the lengths, must have the size of p_values
+        */
+        static void Length(const FVec3Stream& p_values, std::span<float> p_result);
+
+        /**
+         * @brief Normalizes each element, zero vectors stay zero
+         * @param p_values The stream
+         * @param p_result Receives the unit vectors, may be p_values
+        */
+        static void Normalize(const FVec3Stream& p_values, FVec3Stream& p_result);
+
+        /**
+         * @brief Interpolates each pair of elements
+         * @param p_start The stream at p_alpha = 0
+         * @param p_end The stream at p_alpha = 1, must have the size of p_start
+         * @param p_alpha The interpolation factor
+         * @param p_result Receives the interpolated vectors, may be either operand
+        */
+        static void Lerp(const FVec3Stream& p_start, const FVec3Stream& p_end, float p_alpha, FVec3Stream& p_result);
+
+    private:
+        simd::FLaneBuffer m_lanes;
+    };
+}
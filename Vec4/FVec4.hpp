@@ -1,18 +1,38 @@
 #pragma once
-#include <iostream >
+#include <iostream>
+#include <type_traits>
+
+#include "../SIMD/SIMD.h"
+#include "../LibMathsConfig.h"
+
 namespace lm
 {
-    struct FVec4
+    /**
+     * A 16 bytes aligned 4 components vector
+     * @note On SSE targets the components share their storage with a __m128 register
+    */
+    struct alignas(16) FVec4
     {
         static const FVec4 One;
         static const FVec4 Zero;
         static const FVec4 Forward;
         static const FVec4 Right;
         static const FVec4 Up;
-        float x;
-        float y;
-        float z;
-        float w;
+
+        union
+        {
+            struct
+            {
+                float x;
+                float y;
+                float z;
+                float w;
+            };
+
+#if LIBMATHS_USE_SSE
+            __m128 m_simd;
+#endif
+        };
 
         /**
         * Default constructor
@@ -21,17 +41,17 @@ namespace lm
         * @param p_z
         * @param p_w
         */
-        FVec4(float p_x, float p_y, float p_z, float p_w = 0.0f);
+        constexpr FVec4(float p_x, float p_y, float p_z, float p_w = 0.0f) : x(p_x), y(p_y), z(p_z), w(p_w) {}
 
-        FVec4();
+        constexpr FVec4();
 
-        FVec4(float p_value);
+        constexpr FVec4(float p_value);
 
         /**
         * Copy constructor
         * @param p_toCopy
         */
-        FVec4(const FVec4& p_toCopy);
+        constexpr FVec4(const FVec4& p_toCopy) = default;
 
         /**
         * Move constructor
@@ -41,52 +61,60 @@ namespace lm
 
         FVec4(const struct FVec3& p_toCopy, float p_w = 0.0f);
 
+#if LIBMATHS_USE_SSE
+        /**
+        * Create a vector from a SSE register
+        * @param p_simd
+        */
+        explicit FVec4(__m128 p_simd);
+#endif
+
         /**
         * Negation
         */
-        FVec4 operator-() const;
+        constexpr FVec4 operator-() const;
 
         /**
         * Copy assignment
         * @param p_other
         */
-        FVec4 operator=(const FVec4& p_other);
+        constexpr FVec4& operator=(const FVec4& p_other) = default;
 
         /**
         * Calculate the sum of two vectors
         * @param p_other
         */
-        FVec4 operator+(const FVec4& p_other) const;
+        constexpr FVec4 operator+(const FVec4& p_other) const;
 
         /**
         * Add the right vector to the left one
         * @param p_other
         */
-        FVec4& operator+=(const FVec4& p_other);
+        constexpr FVec4& operator+=(const FVec4& p_other);
 
         /**
         * Calculate the substraction of two vectors
         * @param p_other
         */
-        FVec4 operator-(const FVec4& p_other) const;
+        constexpr FVec4 operator-(const FVec4& p_other) const;
 
         /**
         * Remove the right vector from the left one
         * @param p_other
         */
-        FVec4& operator-=(const FVec4& p_other);
+        constexpr FVec4& operator-=(const FVec4& p_other);
 
         /**
         * Calcualte the multiplication of a vector with a scalar
         * @param p_scalar
         */
-        FVec4 operator*(float p_scalar) const;
+        constexpr FVec4 operator*(float p_scalar) const;
 
         /**
         * Multiply the vector by a scalar
         * @param p_scalar
         */
-        FVec4& operator*=(float p_scalar);
+        constexpr FVec4& operator*=(float p_scalar);
 
         /**
         * Return the division of scalar and actual vector
@@ -141,21 +169,21 @@ namespace lm
             * @param p_left (First vector)
             * @param p_right (Second vector)
             */
-        static FVec4 Add(const FVec4& p_left, const FVec4& p_right);
+        static constexpr FVec4 Add(const FVec4& p_left, const FVec4& p_right);
 
         /**
         * Calculate the substraction of two vectors
         * @param p_left (First vector)
         * @param p_right (Second vector)
         */
-        static FVec4 Substract(const FVec4& p_left, const FVec4& p_right);
+        static constexpr FVec4 Substract(const FVec4& p_left, const FVec4& p_right);
 
         /**
         * Calculate the multiplication of a vector with a scalar
         * @param p_target
         * @param p_scalar
         */
-        static FVec4 Multiply(const FVec4& p_target, float p_scalar);
+        static constexpr FVec4 Multiply(const FVec4& p_target, float p_scalar);
 
         /**
         * Divide scalar to vector left
@@ -175,7 +203,7 @@ namespace lm
         * @param p_left
         * @param p_right
         */
-        static float Dot(const FVec4& p_left, const FVec4& p_right);
+        static constexpr float Dot(const FVec4& p_left, const FVec4& p_right);
 
         static float Distance(const FVec4& p_left, const FVec4& p_right);
 
@@ -252,7 +280,7 @@ namespace lm
      * @param p_scalar
      * @param p_vec
     */
-    FVec4 operator*(float p_scalar, const FVec4& p_vec);
+    constexpr FVec4 operator*(float p_scalar, const FVec4& p_vec);
 
     /**
      * Return the division of scalar and actual vector
@@ -276,4 +304,131 @@ namespace lm
     FVec4 operator*(const FVec4& p_left, const FVec4& p_right);
 
     FVec4 operator/(const FVec4& p_left, const FVec4& p_right);
-} // namespace Math
\ No newline at end of file
+} // namespace Math
+
+namespace lm
+{
+    inline constexpr FVec4 FVec4::One(1.0f, 1.0f, 1.0f, 1.0f);
+    inline constexpr FVec4 FVec4::Zero(0.0f, 0.0f, 0.0f, 0.0f);
+    inline constexpr FVec4 FVec4::Forward(0.0f, 0.0f, 1.0f, 0.0f);
+    inline constexpr FVec4 FVec4::Right(1.0f, 0.0f, 0.0f, 0.0f);
+    inline constexpr FVec4 FVec4::Up(0.0f, 1.0f, 0.0f, 0.0f);
+
+    constexpr FVec4::FVec4(float p_init) : x(p_init), y(p_init), z(p_init), w(p_init)
+    {
+    }
+
+    constexpr FVec4::FVec4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f)
+    {
+    }
+
+    constexpr FVec4 FVec4::operator-() const
+    {
+#if LIBMATHS_USE_SSE
+        if (!std::is_constant_evaluated())
+            return FVec4(_mm_xor_ps(m_simd, _mm_set1_ps(-0.0f)));
+#endif
+
+        return operator*(-1);
+    }
+
+    constexpr FVec4 FVec4::operator+(const FVec4& p_other) const
+    {
+        return Add(*this, p_other);
+    }
+
+    constexpr FVec4& FVec4::operator+=(const FVec4& p_other)
+    {
+        *this = Add(*this, p_other);
+        return *this;
+    }
+
+    constexpr FVec4 FVec4::operator-(const FVec4& p_other) const
+    {
+        return Substract(*this, p_other);
+    }
+
+    constexpr FVec4& FVec4::operator-=(const FVec4& p_other)
+    {
+        *this = Substract(*this, p_other);
+        return *this;
+    }
+
+    constexpr FVec4 FVec4::operator*(float p_scalar) const
+    {
+        return Multiply(*this, p_scalar);
+    }
+
+    constexpr FVec4& FVec4::operator*=(float p_scalar)
+    {
+        *this = Multiply(*this, p_scalar);
+        return *this;
+    }
+
+    constexpr FVec4 FVec4::Add(const FVec4& p_left, const FVec4& p_right)
+    {
+#if LIBMATHS_USE_SSE
+        if (!std::is_constant_evaluated())
+            return FVec4(_mm_add_ps(p_left.m_simd, p_right.m_simd));
+#endif
+
+        return FVec4
+        (
+            p_left.x + p_right.x,
+            p_left.y + p_right.y,
+            p_left.z + p_right.z,
+            p_left.w + p_right.w
+        );
+    }
+
+    constexpr FVec4 FVec4::Substract(const FVec4& p_left, const FVec4& p_right)
+    {
+#if LIBMATHS_USE_SSE
+        if (!std::is_constant_evaluated())
+            return FVec4(_mm_sub_ps(p_left.m_simd, p_right.m_simd));
+#endif
+
+        return FVec4
+        (
+            p_left.x - p_right.x,
+            p_left.y - p_right.y,
+            p_left.z - p_right.z,
+            p_left.w - p_right.w
+        );
+    }
+
+    constexpr FVec4 FVec4::Multiply(const FVec4& p_target, float p_scalar)
+    {
+#if LIBMATHS_USE_SSE
+        if (!std::is_constant_evaluated())
+            return FVec4(_mm_mul_ps(p_target.m_simd, _mm_set1_ps(p_scalar)));
+#endif
+
+        return FVec4
+        (
+            p_target.x * p_scalar,
+            p_target.y * p_scalar,
+            p_target.z * p_scalar,
+            p_target.w * p_scalar
+        );
+    }
+
+    constexpr float FVec4::Dot(const FVec4& p_left, const FVec4& p_right)
+    {
+#if LIBMATHS_USE_SSE
+        if (!std::is_constant_evaluated())
+            return _mm_cvtss_f32(simd::Dot4(p_left.m_simd, p_right.m_simd));
+#endif
+
+        return p_left.x * p_right.x + p_left.y * p_right.y + p_left.z * p_right.z + p_left.w * p_right.w;
+    }
+
+    constexpr FVec4 operator*(float p_scalar, const FVec4& p_vec)
+    {
+        return FVec4::Multiply(p_vec, p_scalar);
+    }
+}
+
+#if LIBMATHS_INLINE
+#include "FVec4.inl"
+#endif
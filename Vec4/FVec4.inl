@@ -0,0 +1,316 @@
+#pragma once
+
+/**
+ * Definitions of the FVec4 functions: included by FVec4.hpp when LIBMATHS_INLINE is
+ * set, compiled once by FVec4.cpp otherwise
+*/
+
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+#include <limits>
+
+#include "../LibMathsConfig.h"
+#include "FVec4.hpp"
+#include "../Vec3/FVec3.hpp"
+#include "../Utilities.h"
+
+namespace lm
+{
+#if LIBMATHS_USE_SSE
+    LIBMATHS_INLINE_API FVec4::FVec4(__m128 p_simd) : m_simd(p_simd)
+    {
+    }
+#endif
+
+    LIBMATHS_INLINE_API FVec4::FVec4(const FVec3& p_toCopy, float p_w) : x(p_toCopy.x), y(p_toCopy.y), z(p_toCopy.z), w(p_w)
+    {
+    }
+
+    LIBMATHS_INLINE_API FVec4 FVec4::operator/(float p_scalar) const
+    {
+        return Divide(*this, p_scalar);
+    }
+
+    LIBMATHS_INLINE_API FVec4& FVec4::operator/=(float p_scalar)
+    {
+        *this = Divide(*this, p_scalar);
+        return *this;
+    }
+
+    LIBMATHS_INLINE_API bool FVec4::operator==(const FVec4& p_other)
+    {
+        return lm::operator==(*this, p_other);
+    }
+
+    LIBMATHS_INLINE_API bool FVec4::operator!=(const FVec4& p_other)
+    {
+        return !operator==(p_other);
+    }
+
+    LIBMATHS_INLINE_API const float& FVec4::operator[](int p_index) const
+    {
+        switch (p_index)
+        {
+        case 0:	return x;
+        case 1:	return y;
+        case 2:	return z;
+        case 3:	return w;
+        default: throw std::out_of_range("Index out of range");
+        }
+    }
+
+    LIBMATHS_INLINE_API float& FVec4::operator[](int p_index)
+    {
+        switch (p_index)
+        {
+        case 0:	return x;
+        case 1:	return y;
+        case 2:	return z;
+        case 3:	return w;
+        default: throw std::out_of_range("Index out of range");
+        }
+    }
+
+    LIBMATHS_INLINE_API const float& FVec4::operator()(int p_index) const
+    {
+        switch (p_index)
+        {
+        case 0:	return x;
+        case 1:	return y;
+        case 2:	return z;
+        case 3:	return w;
+        default: throw std::out_of_range("Index out of range");
+        }
+    }
+
+    LIBMATHS_INLINE_API float& FVec4::operator()(int p_index)
+    {
+        switch (p_index)
+        {
+        case 0:	return x;
+        case 1:	return y;
+        case 2:	return z;
+        case 3:	return w;
+        default: throw std::out_of_range("Index out of range");
+        }
+    }
+
+    LIBMATHS_INLINE_API FVec4 FVec4::Divide(const FVec4& p_left, float p_scalar)
+    {
+        if (p_scalar == 0)
+            throw std::logic_error("Division by 0");
+
+#if LIBMATHS_USE_SSE
+        return FVec4(_mm_div_ps(p_left.m_simd, _mm_set1_ps(p_scalar)));
+#else
+        FVec4 result(p_left);
+
+        result.x /= p_scalar;
+        result.y /= p_scalar;
+        result.z /= p_scalar;
+        result.w /= p_scalar;
+
+        return result;
+#endif
+    }
+
+    LIBMATHS_INLINE_API float FVec4::Length(const FVec4& p_target)
+    {
+#if LIBMATHS_USE_SSE
+        return _mm_cvtss_f32(_mm_sqrt_ss(simd::Dot4(p_target.m_simd, p_target.m_simd)));
+#else
+        return sqrtf(Dot(p_target, p_target));
+#endif
+    }
+
+    LIBMATHS_INLINE_API float FVec4::Distance(const FVec4& p_left, const FVec4& p_right)
+    {
+        return Length(p_right - p_left);
+    }
+
+    LIBMATHS_INLINE_API FVec4 FVec4::Normalize(const FVec4& p_target)
+    {
+#if LIBMATHS_USE_SSE
+        const __m128 length2 = simd::Dot4(p_target.m_simd, p_target.m_simd);
+
+        if (_mm_cvtss_f32(length2) > 0.0f)
+        {
+            return FVec4(_mm_div_ps(p_target.m_simd, _mm_sqrt_ps(length2)));
+        }
+
+        return FVec4::Zero;
+#else
+        float length = Length(p_target);
+
+        if (length > 0.0f)
+        {
+            float targetLength = 1.0f / length;
+
+            return FVec4
+            (
+                p_target.x * targetLength,
+                p_target.y * targetLength,
+                p_target.z * targetLength,
+                p_target.w * targetLength
+            );
+        }
+        else
+        {
+            return FVec4::Zero;
+        }
+#endif
+    }
+
+    LIBMATHS_INLINE_API FVec4 FVec4::Lerp(const FVec4& p_start, const FVec4& p_end, float p_alpha)
+    {
+#if LIBMATHS_USE_SSE
+        const __m128 delta = _mm_sub_ps(p_end.m_simd, p_start.m_simd);
+        return FVec4(simd::MulAdd(delta, _mm_set1_ps(p_alpha), p_start.m_simd));
+#else
+        return (p_start + (p_end - p_start) * p_alpha);
+#endif
+    }
+
+    LIBMATHS_INLINE_API FVec4 FVec4::Slerp(const FVec4& p_start, const FVec4& p_end, float p_alpha)
+    {
+        float dot = Dot(p_start, p_end);
+
+        if (dot > 0.9995f)
+        {
+            return Lerp(p_start, p_end, p_alpha);
+        }
+
+        dot = clamp(dot, -1.0f, 1.0f);
+
+        float theta = acosf(dot) * p_alpha;
+        FVec4 relativeVec = Normalize(p_end - p_start * dot);
+        return ((p_start * cosf(theta)) + (relativeVec * sinf(theta)));
+    }
+
+    LIBMATHS_INLINE_API FVec4 FVec4::Clamp(const FVec4& p_target, const FVec4& p_min, const FVec4& p_max)
+    {
+#if LIBMATHS_USE_SSE
+        return FVec4(_mm_max_ps(_mm_min_ps(p_target.m_simd, p_max.m_simd), p_min.m_simd));
+#else
+        return FVec4
+        (
+            clamp(p_target.x, p_min.x, p_max.x),
+            clamp(p_target.y, p_min.y, p_max.y),
+            clamp(p_target.z, p_min.z, p_max.z),
+            clamp(p_target.w, p_min.w, p_max.w)
+        );
+#endif
+    }
+
+    LIBMATHS_INLINE_API FVec4 FVec4::Project(const FVec4& p_target, const FVec4& p_normal)
+    {
+        float aDotb = Dot(p_target, p_normal);
+
+        float bDotB = Dot(p_normal, p_normal);
+
+        if (bDotB == 0.0f)
+        {
+            return FVec4::Zero;
+        }
+
+        return (aDotb / bDotB) * p_normal;
+    }
+
+    LIBMATHS_INLINE_API void FVec4::Homogenize()
+    {
+        if (w != 0.0f)
+        {
+            x /= w;
+            y /= w;
+            z /= w;
+            w = 1.0f;
+        }
+    }
+
+    LIBMATHS_INLINE_API bool FVec4::IsHomogenized() const
+    {
+        return (w == 1.0f);
+    }
+
+    LIBMATHS_INLINE_API bool FVec4::IsZero() const
+    {
+        return (x == 0.0f && y == 0.0f && z == 0.0f && w == 0.0f);
+    }
+
+    LIBMATHS_INLINE_API bool FVec4::IsUnit() const
+    {
+        return std::abs(Length(*this) - 1.0f) <= std::numeric_limits<float>::epsilon() ||
+            std::abs(Length(*this) - 1.0f) <= std::numeric_limits<float>::epsilon() *
+            std::max(std::abs(Length(*this)), std::abs(1.0f));
+    }
+
+    LIBMATHS_INLINE_API std::ostream& operator<<(std::ostream& p_stream, const FVec4& p_target)
+    {
+        p_stream << "FVec4(" << p_target.x << ", " << p_target.y << ", " << p_target.z << ", " << p_target.w << ")";
+        return p_stream;
+    }
+
+    LIBMATHS_INLINE_API std::istream& operator>>(std::istream& p_stream, FVec4& p_target)
+    {
+        p_stream >> p_target.x >> p_target.y >> p_target.z >> p_target.w;
+        return p_stream;
+    }
+
+    LIBMATHS_INLINE_API FVec4 operator/(float p_scalar, const FVec4& p_vec)
+    {
+        return FVec4::Divide(p_vec, p_scalar);
+    }
+
+    LIBMATHS_INLINE_API bool operator==(const FVec4& p_left, const FVec4& p_right)
+    {
+#if LIBMATHS_USE_SSE
+        return _mm_movemask_ps(_mm_cmpeq_ps(p_left.m_simd, p_right.m_simd)) == 0xF;
+#else
+        return (p_left.x == p_right.x && p_left.y == p_right.y && p_left.z == p_right.z && p_left.w == p_right.w);
+#endif
+    }
+
+    LIBMATHS_INLINE_API bool operator!=(const FVec4& p_left, const FVec4& p_right)
+    {
+        return !(p_left == p_right);
+    }
+
+    LIBMATHS_INLINE_API FVec4 operator*(const FVec4& p_left, const FVec4& p_right)
+    {
+#if LIBMATHS_USE_SSE
+        return FVec4(_mm_mul_ps(p_left.m_simd, p_right.m_simd));
+#else
+        return FVec4(p_left.x * p_right.x, p_left.y * p_right.y, p_left.z * p_right.z, p_left.w * p_right.w);
+#endif
+    }
+
+    LIBMATHS_INLINE_API FVec4 operator/(const FVec4& p_left, const FVec4& p_right)
+    {
+#if LIBMATHS_USE_SSE
+        return FVec4(_mm_div_ps(p_left.m_simd, p_right.m_simd));
+#else
+        return FVec4(p_left.x / p_right.x, p_left.y / p_right.y, p_left.z / p_right.z, p_left.w / p_right.w);
+#endif
+    }
+
+    LIBMATHS_INLINE_API FVec4 operator+=(const FVec4& p_left, const FVec4& p_right)
+    {
+        return FVec4::Add(p_left, p_right);
+    }
+
+    LIBMATHS_INLINE_API FVec4 operator-=(const FVec4& p_left, const FVec4& p_right)
+    {
+        return FVec4::Substract(p_left, p_right);
+    }
+
+    LIBMATHS_INLINE_API FVec4 operator*=(FVec4& p_left, const FVec4& p_right)
+    {
+        return p_left = p_left * p_right;
+    }
+
+    LIBMATHS_INLINE_API FVec4 operator/=(FVec4& p_left, const FVec4& p_right)
+    {
+        return p_left = p_left / p_right;
+    }
+}
@@ -0,0 +1,165 @@
+#include "FVec4Stream.hpp"
+#include "../SIMD/Dispatch.hpp"
+
+#include <stdexcept>
+
+using namespace lm;
+
+static constexpr int s_components = 4;
+
+lm::FVec4Stream::Reference::operator FVec4() const
+{
+    return FVec4(x, y, z, w);
+}
+
+FVec4Stream::Reference& lm::FVec4Stream::Reference::operator=(const FVec4& p_value)
+{
+    x = p_value.x;
+    y = p_value.y;
+    z = p_value.z;
+    w = p_value.w;
+    return *this;
+}
+
+FVec4Stream::Reference& lm::FVec4Stream::Reference::operator=(const Reference& p_other)
+{
+    return *this = static_cast<FVec4>(p_other);
+}
+
+lm::FVec4Stream::FVec4Stream() : m_lanes(s_components)
+{
+}
+
+lm::FVec4Stream::FVec4Stream(size_t p_size) : m_lanes(s_components)
+{
+    m_lanes.Resize(p_size);
+}
+
+lm::FVec4Stream::FVec4Stream(std::span<const FVec4> p_values) : m_lanes(s_components)
+{
+    Load(p_values);
+}
+
+FVec4Stream::Reference lm::FVec4Stream::operator[](size_t p_index)
+{
+    if (p_index >= Size())
+    {
+        throw std::out_of_range("FVec4Stream: index out of range");
+    }
+
+    return Reference{ X()[p_index], Y()[p_index], Z()[p_index], W()[p_index] };
+}
+
+FVec4 lm::FVec4Stream::operator[](size_t p_index) const
+{
+    if (p_index >= Size())
+    {
+        throw std::out_of_range("FVec4Stream: index out of range");
+    }
+
+    return FVec4(X()[p_index], Y()[p_index], Z()[p_index], W()[p_index]);
+}
+
+size_t lm::FVec4Stream::Size() const
+{
+    return m_lanes.Size();
+}
+
+void lm::FVec4Stream::Resize(size_t p_size)
+{
+    m_lanes.Resize(p_size);
+}
+
+float* lm::FVec4Stream::X() { return m_lanes.Lane(0); }
+float* lm::FVec4Stream::Y() { return m_lanes.Lane(1); }
+float* lm::FVec4Stream::Z() { return m_lanes.Lane(2); }
+float* lm::FVec4Stream::W() { return m_lanes.Lane(3); }
+const float* lm::FVec4Stream::X() const { return m_lanes.Lane(0); }
+const float* lm::FVec4Stream::Y() const { return m_lanes.Lane(1); }
+const float* lm::FVec4Stream::Z() const { return m_lanes.Lane(2); }
+const float* lm::FVec4Stream::W() const { return m_lanes.Lane(3); }
+
+void lm::FVec4Stream::Load(std::span<const FVec4> p_values)
+{
+    m_lanes.Resize(p_values.size());
+
+    float* const lanes[] = { X(), Y(), Z(), W() };
+    simd::Kernels().streamDeinterleave(reinterpret_cast<const float*>(p_values.data()), s_components, lanes, p_values.size());
+}
+
+void lm::FVec4Stream::Store(std::span<FVec4> p_result) const
+{
+    if (p_result.size() != Size())
+    {
+        throw std::logic_error("FVec4Stream::Store: span must have the size of the stream");
+    }
+
+    const float* const lanes[] = { X(), Y(), Z(), W() };
+    simd::Kernels().streamInterleave(lanes, s_components, reinterpret_cast<float*>(p_result.data()), p_result.size());
+}
+
+void lm::FVec4Stream::Add(const FVec4Stream& p_left, const FVec4Stream& p_right, FVec4Stream& p_result)
+{
+    if (p_left.Size() != p_right.Size())
+    {
+        throw std::logic_error("FVec4Stream::Add: streams must have the same size");
+    }
+
+    p_result.Resize(p_left.Size());
+
+    for (int lane = 0; lane < s_components; lane++)
+        simd::Kernels().streamAdd(p_left.m_lanes.Lane(lane), p_right.m_lanes.Lane(lane), p_result.m_lanes.Lane(lane), p_result.m_lanes.PaddedSize());
+}
+
+void lm::FVec4Stream::Scale(const FVec4Stream& p_values, float p_scale, FVec4Stream& p_result)
+{
+    p_result.Resize(p_values.Size());
+
+    for (int lane = 0; lane < s_components; lane++)
+        simd::Kernels().streamScale(p_values.m_lanes.Lane(lane), p_scale, p_result.m_lanes.Lane(lane), p_result.m_lanes.PaddedSize());
+}
+
+void lm::FVec4Stream::Dot(const FVec4Stream& p_left, const FVec4Stream& p_right, std::span<float> p_result)
+{
+    if (p_left.Size() != p_right.Size() || p_left.Size() != p_result.size())
+    {
+        throw std::logic_error("FVec4Stream::Dot: streams and result must have the same size");
+    }
+
+    const float* const left[] = { p_left.X(), p_left.Y(), p_left.Z(), p_left.W() };
+    const float* const right[] = { p_right.X(), p_right.Y(), p_right.Z(), p_right.W() };
+    simd::Kernels().streamDot(left, right, s_components, p_result.data(), p_result.size());
+}
+
+void lm::FVec4Stream::Length(const FVec4Stream& p_values, std::span<float> p_result)
+{
+    if (p_values.Size() != p_result.size())
+    {
+        throw std::logic_error("FVec4Stream::Length: stream and result must have the same size");
+    }
+
+    const float* const values[] = { p_values.X(), p_values.Y(), p_values.Z(), p_values.W() };
+    simd::Kernels().streamLength(values, s_components, p_result.data(), p_result.size());
+}
+
+void lm::FVec4Stream::Normalize(const FVec4Stream& p_values, FVec4Stream& p_result)
+{
+    p_result.Resize(p_values.Size());
+
+    const float* const values[] = { p_values.X(), p_values.Y(), p_values.Z(), p_values.W() };
+    float* const result[] = { p_result.X(), p_result.Y(), p_result.Z(), p_result.W() };
+    simd::Kernels().streamNormalize(values, s_components, result, p_result.m_lanes.PaddedSize());
+}
+
+void lm::FVec4Stream::Lerp(const FVec4Stream& p_start, const FVec4Stream& p_end, float p_alpha, FVec4Stream& p_result)
+{
+    if (p_start.Size() != p_end.Size())
+    {
+        throw std::logic_error("FVec4Stream::Lerp: streams must have the same size");
+    }
+
+    p_result.Resize(p_start.Size());
+
+    for (int lane = 0; lane < s_components; lane++)
+        simd::Kernels().streamLerp(p_start.m_lanes.Lane(lane), p_end.m_lanes.Lane(lane), p_alpha, p_result.m_lanes.Lane(lane), p_result.m_lanes.PaddedSize());
+}
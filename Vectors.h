@@ -2,7 +2,10 @@
 
 #include "Vec2/Vec2.h"
 #include "Vec2/FVec2.hpp"
+#include "Vec2/FVec2Stream.hpp"
 #include "Vec3/Vec3.h"
 #include "Vec3/FVec3.hpp"
+#include "Vec3/FVec3Stream.hpp"
 #include "Vec4/Vec4.h"
 #include "Vec4/FVec4.hpp"
+#include "Vec4/FVec4Stream.hpp"